@@ -2,6 +2,8 @@ use std::ffi::{CString, c_char};
 use std::fs::File;
 use std::io::{Error, Read, Result};
 use std::path::{Path, PathBuf};
+use std::ptr::NonNull;
+use std::sync::{Arc, OnceLock};
 
 use serde::{Deserialize, Serialize};
 
@@ -18,6 +20,18 @@ pub struct QualityChain {
     pub chain_links: [u64; NUM_CHAIN_LINKS],
 }
 
+/// Opaque plot handle, see `plot_open` in src/api.cpp
+#[repr(C)]
+struct CPlotHandle {
+    _private: [u8; 0],
+}
+
+/// Opaque chunk cache, see `chunk_cache_new` in src/api.cpp
+#[repr(C)]
+struct CChunkCache {
+    _private: [u8; 0],
+}
+
 unsafe extern "C" {
     // these C functions are defined in src/api.cpp
 
@@ -38,6 +52,21 @@ unsafe extern "C" {
         num_outputs: u32,
     ) -> u32;
 
+    fn chunk_cache_new(capacity_bytes: u64) -> *mut CChunkCache;
+
+    fn chunk_cache_free(cache: *mut CChunkCache);
+
+    fn plot_open(plot_file: *const c_char, cache: *const CChunkCache) -> *mut CPlotHandle;
+
+    fn plot_close(plot: *mut CPlotHandle);
+
+    fn qualities_for_challenge_h(
+        plot: *mut CPlotHandle,
+        challenge: *const u8,
+        output: *mut QualityChain,
+        num_outputs: u32,
+    ) -> u32;
+
     // proof must point to exactly 16 proof fragments (each a uint64_t)
     // plot ID must point to exactly 32 bytes
     // output must point to exactly 512 32 bit integers
@@ -242,6 +271,62 @@ pub fn serialize_quality(
     ret
 }
 
+/// A cache of decoded plot chunks, shared by every `Prover` it is attached to
+/// (see `Prover::set_chunk_cache`), so challenges of different signage points
+/// that land in the same chunks decode them once. Clones share the cache.
+#[derive(Clone)]
+pub struct ChunkCache(Arc<ChunkCacheHandle>);
+
+struct ChunkCacheHandle(NonNull<CChunkCache>);
+
+// SAFETY: the C++ cache is not tied to a thread and locks internally
+unsafe impl Send for ChunkCacheHandle {}
+unsafe impl Sync for ChunkCacheHandle {}
+
+impl ChunkCache {
+    /// A cache holding up to `capacity_bytes` of decoded proof fragments
+    pub fn new(capacity_bytes: u64) -> Result<ChunkCache> {
+        // SAFETY: no requirements; a null result is handled below
+        let cache = unsafe { chunk_cache_new(capacity_bytes) };
+        match NonNull::new(cache) {
+            Some(cache) => Ok(ChunkCache(Arc::new(ChunkCacheHandle(cache)))),
+            None => Err(Error::other("failed to create chunk cache")),
+        }
+    }
+}
+
+impl Drop for ChunkCacheHandle {
+    fn drop(&mut self) {
+        // SAFETY: the pointer came from chunk_cache_new and is freed exactly
+        // once; plots opened with it keep their own reference
+        unsafe { chunk_cache_free(self.0.as_ptr()) }
+    }
+}
+
+/// A plot kept open by the C++ library, closed on drop
+struct PlotHandle(NonNull<CPlotHandle>);
+
+// SAFETY: the handle is not tied to the thread that opened it, and
+// qualities_for_challenge_h may be called on it from several threads at once
+unsafe impl Send for PlotHandle {}
+unsafe impl Sync for PlotHandle {}
+
+impl PlotHandle {
+    fn open(plot_path: &CString, cache: Option<&ChunkCache>) -> Option<PlotHandle> {
+        let cache = cache.map_or(std::ptr::null(), |cache| cache.0.0.as_ptr().cast_const());
+        // SAFETY: plot_file must be a null-terminated string, cache null or
+        // from chunk_cache_new
+        NonNull::new(unsafe { plot_open(plot_path.as_ptr(), cache) }).map(PlotHandle)
+    }
+}
+
+impl Drop for PlotHandle {
+    fn drop(&mut self) {
+        // SAFETY: the pointer came from plot_open and is closed exactly once
+        unsafe { plot_close(self.0.as_ptr()) }
+    }
+}
+
 /// Farmer wide state for prover
 #[derive(Serialize, Deserialize)]
 pub struct Prover {
@@ -252,16 +337,28 @@ pub struct Prover {
     index: u16,
     meta_group: u8,
     size: u8,
+    /// The plot stays open across challenges once it has been opened. Until
+    /// then each challenge tries to open it again, and falls back to opening
+    /// the plot for that challenge alone, so a plot that could not be opened
+    /// once (e.g. a disk not yet mounted) is not left on the slow path.
+    #[serde(skip)]
+    handle: OnceLock<PlotHandle>,
+    /// Decoded chunks are looked up in and added to this cache, if set.
+    #[serde(skip)]
+    chunk_cache: Option<ChunkCache>,
 }
 
 impl Prover {
     pub fn new(plot_path: &Path) -> Result<Prover> {
         let mut file = File::open(plot_path)?;
 
-        // Read PlotData from a binary file. The v2 plot header format is as
+        // Read PlotData from a binary file. The v3 plot header format is as
         // follows:
         // 4 bytes:  "pos2"
-        // 1 byte:   version. 0=invalid, 1=fat plots, 2=benesh plots (compressed)
+        // 1 byte:   version. 0=invalid, 1=compressed chunks, 2=seekable
+        //           compressed chunks (a seek block size byte follows the memo),
+        //           3=seekable with a delta codec byte after the seek block size
+        //           (codec 3, fse-shared, is followed by its u16-sized FSE table)
         // 32 bytes: plot ID
         // 1 byte:   k-size
         // 1 byte:   strength, defaults to 2
@@ -277,7 +374,7 @@ impl Prover {
             return Err(Error::other("Not a plotfile"));
         }
         offset += 4;
-        if header[offset] != 1 {
+        if !(1..=3).contains(&header[offset]) {
             return Err(Error::other("unsupported plot version"));
         }
         offset += 1;
@@ -314,15 +411,30 @@ impl Prover {
             index,
             meta_group,
             size,
+            handle: OnceLock::new(),
+            chunk_cache: None,
         })
     }
 
+    /// Shares decoded chunks through `cache` with the other provers it is set
+    /// on. The plot is opened again with it for the next challenge.
+    pub fn set_chunk_cache(&mut self, cache: ChunkCache) {
+        self.chunk_cache = Some(cache);
+        self.handle = OnceLock::new();
+    }
+
     pub fn get_qualities_for_challenge(&self, challenge: &Bytes32) -> Result<Vec<QualityChain>> {
         let Some(plot_path) = self.path.to_str() else {
             return Err(Error::other("invalid path"));
         };
 
         let plot_path = CString::new(plot_path)?;
+        let handle = match self.handle.get() {
+            Some(handle) => Some(handle),
+            // if another thread opened it meanwhile, `opened` is closed again
+            None => PlotHandle::open(&plot_path, self.chunk_cache.as_ref())
+                .map(|opened| self.handle.get_or_init(|| opened)),
+        };
 
         let mut results = Vec::<QualityChain>::with_capacity(10);
         // SAFETY: Calling into pos2 C++ library. See src/api.cpp for requirements
@@ -331,12 +443,20 @@ impl Prover {
         // plot_file must be a null-terminated string
         // output must point to "num_outputs" objects
         unsafe {
-            let num_results = qualities_for_challenge(
-                plot_path.as_ptr(),
-                challenge.as_ptr(),
-                results.as_mut_ptr(),
-                10,
-            );
+            let num_results = match handle {
+                Some(handle) => qualities_for_challenge_h(
+                    handle.0.as_ptr(),
+                    challenge.as_ptr(),
+                    results.as_mut_ptr(),
+                    10,
+                ),
+                None => qualities_for_challenge(
+                    plot_path.as_ptr(),
+                    challenge.as_ptr(),
+                    results.as_mut_ptr(),
+                    10,
+                ),
+            };
             results.set_len(num_results as usize);
         }
         Ok(results)
@@ -412,7 +532,11 @@ mod tests {
             .expect("create_v2_plot");
         }
 
-        let prover = Prover::new(&plot_path).expect("open prover");
+        let mut prover = Prover::new(&plot_path).expect("open prover");
+        // half the cases read through a chunk cache, which must not change any result
+        if meta_group != 0 {
+            prover.set_chunk_cache(ChunkCache::new(64 << 20).expect("chunk cache"));
+        }
         assert_eq!(prover.size(), k);
         assert_eq!(prover.get_strength(), strength);
         assert_eq!(prover.get_plot_index(), index);
@@ -65,6 +65,80 @@ catch (std::exception const&) {
     return 0;
 }
 
+// A bounded cache of decoded chunks (see ChunkCache), shared by every plot opened with it, so
+// challenges of different signage points that land in the same chunks decode them once.
+struct PlotChunkCache {
+    std::shared_ptr<ChunkCache> cache;
+};
+
+// Creates a chunk cache holding up to capacity_bytes of decoded fragments.
+// returns nullptr on failure; a non-null cache must be released with chunk_cache_free
+PlotChunkCache* chunk_cache_new(uint64_t const capacity_bytes)
+try {
+    return new PlotChunkCache { std::make_shared<ChunkCache>(capacity_bytes) };
+}
+catch (std::exception const&) {
+    return nullptr;
+}
+
+// cache may be nullptr; plots opened with it keep using it until they are closed
+void chunk_cache_free(PlotChunkCache* cache) { delete cache; }
+
+// An open plot: header and chunk offsets parsed once and checked against the file size, and the
+// file kept open. Chunks are read from it with pread (not mapped, so a failing disk is an error,
+// not SIGBUS), with no shared file position, so one handle can serve several threads at once.
+struct PlotHandle {
+    PlotHandle(char const* plot_file, PlotChunkCache const* cache) : prover(plot_file)
+    {
+        prover.getProofParams();
+        if (cache != nullptr)
+            prover.setChunkCache(cache->cache);
+    }
+
+    Prover prover;
+};
+
+// Opens a plot for repeated qualities_for_challenge_h calls.
+// plot_file must be a null-terminated string
+// cache may be nullptr, or a cache from chunk_cache_new to share decoded chunks through
+// returns nullptr on failure; a non-null handle must be released with plot_close
+PlotHandle* plot_open(char const* plot_file, PlotChunkCache const* cache)
+try {
+    if (plot_file == nullptr)
+        return nullptr;
+    return new PlotHandle(plot_file, cache);
+}
+catch (std::exception const&) {
+    return nullptr;
+}
+
+// plot may be nullptr
+void plot_close(PlotHandle* plot) { delete plot; }
+
+// Like qualities_for_challenge, on a plot opened with plot_open. Safe to call concurrently on the
+// same handle.
+// challenge must point to 32 bytes
+// output must point to "num_outputs" objects
+uint32_t qualities_for_challenge_h(PlotHandle* plot,
+    uint8_t const* challenge,
+    QualityChain* output,
+    uint32_t const num_outputs)
+try {
+    if (plot == nullptr || challenge == nullptr || output == nullptr)
+        return 0;
+    if (num_outputs == 0)
+        return 0;
+
+    std::span<uint8_t const, 32> const challenge_arr(challenge, challenge + 32);
+    std::vector<QualityChain> ret = plot->prover.prove(challenge_arr);
+    uint32_t const num_results = std::min(static_cast<uint32_t>(ret.size()), num_outputs);
+    std::copy(ret.begin(), ret.begin() + num_results, output);
+    return num_results;
+}
+catch (std::exception const&) {
+    return 0;
+}
+
 // Converts full proof bytes to quality string (does not validate the proof).
 // plot_id must point to 32 bytes
 // proof must point to 128 uint32_t values
@@ -1,19 +1,28 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iterator>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
+#include "common/TraceHooks.hpp"
 #include "common/thread.hpp"
 
 // A small, self-contained parallel_for_range utility.
 // - Iterates over [first, last) and calls fn(element) for each element.
 // - Provides overloads for iterator ranges and numeric index ranges.
+// - parallel_for_dynamic hands out indices on demand instead of in static chunks.
+// - parallel_for_ordered computes results on workers and hands them to the caller in order.
+// - Each worker is a span on its thread's lane when a trace is recorded (see TraceHooks.hpp).
 
 // Iterator-based overloads
 template <typename It, typename Fn>
@@ -52,6 +61,7 @@ std::enable_if_t<!std::is_integral<It>::value, void> parallel_for_range(
         It e = std::next(first, end);
 
         workers.emplace_back([b, e, &fn]() {
+            TraceWorkerSpan span("parallel_for");
             for (It it = b; it != e; ++it)
                 fn(*it);
         });
@@ -87,8 +97,166 @@ std::enable_if_t<std::is_integral_v<T>, void> parallel_for_range(
         T e = static_cast<T>(start + local_end);
 
         workers.emplace_back([b, e, &fn]() {
+            TraceWorkerSpan span("parallel_for");
             for (T i = b; i < e; ++i)
                 fn(i);
         });
     }
 }
+
+// Numeric index range [start, stop), handed out dynamically: workers repeatedly claim the next
+// `grain` indices from a shared counter, so uneven per-index cost does not leave threads idle
+// behind the slowest static chunk.
+template <typename T, typename Fn>
+std::enable_if_t<std::is_integral_v<T>, void> parallel_for_dynamic(T start,
+    T stop,
+    Fn fn,
+    unsigned max_threads = std::thread::hardware_concurrency(),
+    T grain = 1)
+{
+    T total = (stop > start) ? (stop - start) : 0;
+    if (total <= 0)
+        return;
+    if (grain < 1)
+        grain = 1;
+
+    unsigned num_threads = max_threads == 0 ? 1u : max_threads;
+    num_threads = static_cast<unsigned>(std::min<T>(num_threads, (total + grain - 1) / grain));
+
+    if (num_threads <= 1) {
+        for (T i = start; i < stop; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<T> next { start };
+    auto worker = [&]() {
+        TraceWorkerSpan span("parallel_for_dynamic");
+        for (;;) {
+            T const b = next.fetch_add(grain, std::memory_order_relaxed);
+            if (b >= stop)
+                return;
+            T const e = (stop - b > grain) ? static_cast<T>(b + grain) : stop;
+            for (T i = b; i < e; ++i)
+                fn(i);
+        }
+    };
+
+    std::vector<thread> workers;
+    workers.reserve(num_threads);
+    for (unsigned t = 0; t < num_threads; ++t)
+        workers.emplace_back(worker);
+}
+
+// Numeric index range [start, stop) as an ordered pipeline: workers claim indices in order and
+// compute produce(i), and the calling thread passes each result to consume(i, result) in index
+// order while the workers go on with the next ones. At most `window` results (default: two per
+// thread) are claimed and not yet consumed at any time, which bounds the memory they hold. An
+// exception from produce or consume stops the pipeline and is rethrown here once the workers
+// have finished.
+template <typename T, typename Produce, typename Consume>
+std::enable_if_t<std::is_integral_v<T>, void> parallel_for_ordered(T start,
+    T stop,
+    Produce produce,
+    Consume consume,
+    unsigned max_threads = std::thread::hardware_concurrency(),
+    std::size_t window = 0)
+{
+    using Result = std::invoke_result_t<Produce&, T>;
+    T const total = (stop > start) ? (stop - start) : 0;
+    if (total <= 0)
+        return;
+
+    unsigned num_threads = max_threads == 0 ? 1u : max_threads;
+    num_threads = static_cast<unsigned>(std::min<T>(num_threads, total));
+    if (window == 0)
+        window = 2 * std::size_t(num_threads);
+    window = std::max<std::size_t>(window, num_threads);
+
+    if (num_threads <= 1) {
+        for (T i = start; i < stop; ++i)
+            consume(i, produce(i));
+        return;
+    }
+
+    // result i waits in slot (i - start) % window; claiming i needs i - window consumed
+    std::vector<std::optional<Result>> slots(window);
+    std::mutex mutex;
+    std::condition_variable produced;
+    std::condition_variable consumed;
+    T next = start;
+    T next_consumed = start;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    auto const fail = [&](std::exception_ptr e) {
+        {
+            std::lock_guard lock(mutex);
+            if (!error)
+                error = std::move(e);
+            stopping = true;
+        }
+        produced.notify_all();
+        consumed.notify_all();
+    };
+
+    auto worker = [&]() {
+        TraceWorkerSpan span("parallel_for_ordered");
+        for (;;) {
+            T i;
+            {
+                std::unique_lock lock(mutex);
+                consumed.wait(lock, [&] {
+                    return stopping || next == stop
+                        || static_cast<std::size_t>(next - next_consumed) < window;
+                });
+                if (stopping || next == stop)
+                    return;
+                i = next++;
+            }
+            try {
+                std::optional<Result> result(std::in_place, produce(i));
+                {
+                    std::lock_guard lock(mutex);
+                    slots[static_cast<std::size_t>(i - start) % window] = std::move(result);
+                }
+                produced.notify_all();
+            }
+            catch (...) {
+                fail(std::current_exception());
+                return;
+            }
+        }
+    };
+
+    {
+        std::vector<thread> workers;
+        workers.reserve(num_threads);
+        for (unsigned t = 0; t < num_threads; ++t)
+            workers.emplace_back(worker);
+
+        try {
+            for (T i = start; i < stop; ++i) {
+                std::optional<Result> result;
+                {
+                    std::unique_lock lock(mutex);
+                    std::optional<Result>& slot
+                        = slots[static_cast<std::size_t>(i - start) % window];
+                    produced.wait(lock, [&] { return stopping || slot.has_value(); });
+                    if (stopping)
+                        break; // a worker failed
+                    result = std::move(slot);
+                    slot.reset();
+                    ++next_consumed;
+                }
+                consumed.notify_all();
+                consume(i, std::move(*result));
+            }
+        }
+        catch (...) {
+            fail(std::current_exception());
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "common/ParallelForRange.hpp"
+
+// Offsets from per-thread histograms, as used by counting scatters (radix sort passes, table
+// bucketing).
+//
+// counts holds num_rows histograms of `radix` buckets each, row t counted over the t-th index
+// range of the input. On return:
+//   bucket_start[r]                = number of elements in buckets below r (radix + 1 entries)
+//   row_offsets[t * radix + r]     = bucket_start[r] + counts of bucket r in rows before t
+// so row t scatters bucket r from row_offsets[t * radix + r] on, keeping the scatter stable.
+// row_offsets may be empty when only the bucket starts are needed.
+//
+// The work is a column sum per bucket plus one scan, O(num_rows * radix). With many threads and
+// wide digits that is no longer negligible, so large tables are split into bucket blocks: each
+// block sums its columns in parallel, the block totals are scanned serially, and each block then
+// adds its base in parallel.
+template <typename Count, typename Offset>
+void histogram_offsets(std::span<Count const> counts,
+    std::size_t num_rows,
+    std::size_t radix,
+    std::span<Offset> bucket_start,
+    std::span<Offset> row_offsets = {},
+    unsigned max_threads = std::thread::hardware_concurrency())
+{
+    // Below this many cells the serial loop beats thread startup.
+    constexpr std::size_t kMinParallelCells = std::size_t(1) << 16;
+    constexpr std::size_t kMinBucketsPerBlock = 64;
+
+    bool const with_rows = !row_offsets.empty();
+
+    // Writes the in-column offsets of [r_begin, r_end) and returns the buckets' total count;
+    // bucket_start[r] temporarily holds the column total.
+    auto const sum_columns = [&](std::size_t r_begin, std::size_t r_end) {
+        Offset block_total = 0;
+        for (std::size_t r = r_begin; r < r_end; ++r) {
+            Offset running = 0;
+            for (std::size_t t = 0; t < num_rows; ++t) {
+                if (with_rows)
+                    row_offsets[t * radix + r] = running;
+                running += static_cast<Offset>(counts[t * radix + r]);
+            }
+            bucket_start[r] = running;
+            block_total += running;
+        }
+        return block_total;
+    };
+    // Turns the column totals of [r_begin, r_end) into bucket starts, beginning at base.
+    auto const add_base = [&](std::size_t r_begin, std::size_t r_end, Offset base) {
+        for (std::size_t r = r_begin; r < r_end; ++r) {
+            Offset const total = bucket_start[r];
+            bucket_start[r] = base;
+            if (with_rows) {
+                for (std::size_t t = 0; t < num_rows; ++t)
+                    row_offsets[t * radix + r] += base;
+            }
+            base += total;
+        }
+        return base;
+    };
+
+    std::size_t num_blocks = std::min<std::size_t>(
+        max_threads == 0 ? 1 : max_threads, radix / kMinBucketsPerBlock);
+    if (num_rows * radix < kMinParallelCells || num_blocks <= 1) {
+        sum_columns(0, radix);
+        bucket_start[radix] = add_base(0, radix, 0);
+        return;
+    }
+
+    auto const block_begin = [&](std::size_t b) { return radix * b / num_blocks; };
+    std::vector<Offset> block_base(num_blocks + 1, 0);
+    parallel_for_range(
+        std::size_t(0),
+        num_blocks,
+        [&](std::size_t b) { block_base[b + 1] = sum_columns(block_begin(b), block_begin(b + 1)); },
+        static_cast<unsigned>(num_blocks));
+    for (std::size_t b = 0; b < num_blocks; ++b)
+        block_base[b + 1] += block_base[b];
+    parallel_for_range(
+        std::size_t(0),
+        num_blocks,
+        [&](std::size_t b) { add_base(block_begin(b), block_begin(b + 1), block_base[b]); },
+        static_cast<unsigned>(num_blocks));
+    bucket_start[radix] = block_base[num_blocks];
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define POS2_HAVE_PERF_EVENTS 1
+#else
+#define POS2_HAVE_PERF_EVENTS 0
+#endif
+
+// Hardware performance counters (Linux perf_event_open) for the phases Timer measures.
+//
+// While a PerfCounterSession is alive, each Timer start()/stop() pair also takes the counter
+// deltas (Timer::counters()); they are summed per table phase in the constructor Timings, go
+// into PlotReport, and are attached to the phase's trace span. The counters follow the thread
+// that opened the session and every thread it starts afterwards (the parallel_for workers), so
+// they cover the work of a phase on all cores, but also anything else that runs concurrently.
+//
+// Memory bandwidth has no per-process counter (the memory controller counters are system-wide);
+// llc_miss_bytes() gives the line fills behind the LLC misses as a lower bound on the traffic.
+// Counters the kernel, CPU or hypervisor does not provide read as 0, and with no counter at all
+// (other OS, no PMU, perf_event_paranoid > 2) the values are not valid().
+struct PerfCounterValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llc_misses = 0;
+    uint64_t dtlb_misses = 0;
+    bool valid = false;
+
+    double ipc() const
+    {
+        return cycles ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.0;
+    }
+    uint64_t llc_miss_bytes() const { return llc_misses * 64; }
+
+    PerfCounterValues& operator+=(PerfCounterValues const& o)
+    {
+        if (!o.valid)
+            return *this;
+        cycles += o.cycles;
+        instructions += o.instructions;
+        llc_misses += o.llc_misses;
+        dtlb_misses += o.dtlb_misses;
+        valid = true;
+        return *this;
+    }
+
+    // Counts between two reads (this one the later).
+    PerfCounterValues since(PerfCounterValues const& start) const
+    {
+        if (!valid || !start.valid)
+            return {};
+        auto const diff = [](uint64_t a, uint64_t b) { return a > b ? a - b : 0; };
+        return { diff(cycles, start.cycles), diff(instructions, start.instructions),
+            diff(llc_misses, start.llc_misses), diff(dtlb_misses, start.dtlb_misses), true };
+    }
+
+    // JSON object members (no braces); empty when not valid.
+    std::string json_fields() const
+    {
+        if (!valid)
+            return {};
+        return "\"cycles\":" + std::to_string(cycles)
+            + ",\"instructions\":" + std::to_string(instructions)
+            + ",\"ipc\":" + std::to_string(ipc()) + ",\"llc_misses\":" + std::to_string(llc_misses)
+            + ",\"llc_miss_bytes\":" + std::to_string(llc_miss_bytes())
+            + ",\"dtlb_misses\":" + std::to_string(dtlb_misses);
+    }
+};
+
+class PerfCounterSession;
+
+namespace perf_detail {
+inline std::atomic<PerfCounterSession*> active { nullptr };
+} // namespace perf_detail
+
+// The session Timer reads, or nullptr when counters are off.
+inline PerfCounterSession* active_perf_counters() noexcept
+{
+    return perf_detail::active.load(std::memory_order_acquire);
+}
+
+// Opens the counters for the calling thread and the threads it creates from now on, and makes
+// them the active ones while alive, if any could be opened. Not nestable.
+class PerfCounterSession {
+public:
+    PerfCounterSession()
+    {
+#if POS2_HAVE_PERF_EVENTS
+        constexpr uint64_t kDtlbReadMiss = PERF_COUNT_HW_CACHE_DTLB
+            | (uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8)
+            | (uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+        fds_[0] = open_(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds_[1] = open_(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fds_[2] = open_(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+        fds_[3] = open_(PERF_TYPE_HW_CACHE, kDtlbReadMiss);
+        for (int fd: fds_)
+            available_ = available_ || fd >= 0;
+#endif
+        if (available_)
+            perf_detail::active.store(this, std::memory_order_release);
+    }
+
+    ~PerfCounterSession()
+    {
+        PerfCounterSession* self = this;
+        perf_detail::active.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+#if POS2_HAVE_PERF_EVENTS
+        for (int fd: fds_) {
+            if (fd >= 0)
+                close(fd);
+        }
+#endif
+    }
+
+    PerfCounterSession(PerfCounterSession const&) = delete;
+    PerfCounterSession& operator=(PerfCounterSession const&) = delete;
+
+    // False when no counter could be opened; the session is then inert.
+    bool available() const noexcept { return available_; }
+
+    // Running totals since the session was opened.
+    PerfCounterValues read() const noexcept
+    {
+        PerfCounterValues v;
+        if (!available_)
+            return v;
+        v.valid = true;
+        v.cycles = read_(fds_[0]);
+        v.instructions = read_(fds_[1]);
+        v.llc_misses = read_(fds_[2]);
+        v.dtlb_misses = read_(fds_[3]);
+        return v;
+    }
+
+private:
+#if POS2_HAVE_PERF_EVENTS
+    static int open_(uint32_t type, uint64_t config)
+    {
+        perf_event_attr attr {};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.inherit = 1; // threads created later count too
+        attr.exclude_kernel = 1; // allowed at perf_event_paranoid 2
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        long const fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+        return static_cast<int>(fd);
+    }
+
+    // Scaled for multiplexing when the PMU has fewer counters than events.
+    static uint64_t read_(int fd) noexcept
+    {
+        if (fd < 0)
+            return 0;
+        uint64_t buf[3] = {}; // value, time enabled, time running
+        if (::read(fd, buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[2] == 0)
+            return 0;
+        if (buf[2] >= buf[1])
+            return buf[0];
+        double const scale = static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+        return static_cast<uint64_t>(static_cast<double>(buf[0]) * scale);
+    }
+#else
+    static uint64_t read_(int) noexcept { return 0; }
+#endif
+
+    std::array<int, 4> fds_ { -1, -1, -1, -1 };
+    bool available_ = false;
+};
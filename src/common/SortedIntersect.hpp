@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define POS2_HAVE_AVX2_KERNELS 1
+#else
+#define POS2_HAVE_AVX2_KERNELS 0
+#endif
+
+// Merge intersection of two ascending key sequences, shared by the plotter's pair finding and
+// the solver's T1 matching.
+//
+// Keys are read through a SortedKeys view, so the same kernel serves contiguous uint32_t arrays
+// (stride 1) and the match_info field of candidate structs (stride sizeof(T) / 4, with an
+// optional mask). The scalar merge mispredicts on nearly every step, since which side advances
+// is a coin flip for near-uniform keys, so two strategies replace it:
+//   - lists of similar length advance branchlessly (i += ka < kb; j += kb < ka) and only branch
+//     on equal keys;
+//   - skewed lists skip all keys below the other side's key in blocks of eight (AVX2 for
+//     contiguous keys and 8-byte entries, picked at runtime), so the short side barely moves.
+struct SortedKeys {
+    uint32_t const* base = nullptr; // key of element 0
+    std::size_t stride = 1; // in uint32_t words
+    std::size_t size = 0;
+    uint32_t mask = ~uint32_t(0);
+
+    uint32_t operator[](std::size_t i) const { return base[i * stride] & mask; }
+
+    static SortedKeys of(std::span<uint32_t const> keys, uint32_t mask = ~uint32_t(0))
+    {
+        return { keys.data(), 1, keys.size(), mask };
+    }
+
+    // View of the match_info field of each element.
+    template <typename T>
+    static SortedKeys match_info_of(std::span<T const> elems, uint32_t mask = ~uint32_t(0))
+    {
+        static_assert(sizeof(T) % sizeof(uint32_t) == 0 && alignof(T) >= alignof(uint32_t));
+        static_assert(std::is_same_v<decltype(T::match_info), uint32_t>);
+        // The AVX2 skips (elements of up to two words) read 8 * sizeof(T) bytes starting at an
+        // element's match_info, which stays inside those 8 elements only at offset 0.
+        static_assert(sizeof(T) > 2 * sizeof(uint32_t) || offsetof(T, match_info) == 0,
+            "match_info must lead elements of 8 bytes or less");
+        if (elems.empty())
+            return { nullptr, sizeof(T) / sizeof(uint32_t), 0, mask };
+        return { &elems.data()->match_info, sizeof(T) / sizeof(uint32_t), elems.size(), mask };
+    }
+};
+
+namespace sorted_intersect_detail {
+
+// Above this length ratio the longer list is skipped through instead of stepped through.
+inline constexpr std::size_t kSkewedRatio = 4;
+// Keys this close are found with scalar compares before a block skip; most gaps are short.
+inline constexpr std::size_t kScalarProbe = 4;
+
+// Emits the equal-key run at (i, j) and moves both cursors past it.
+template <typename Emit>
+inline void emit_run_(SortedKeys const& a, SortedKeys const& b, std::size_t& i, std::size_t& j,
+    uint32_t key, Emit& emit)
+{
+    std::size_t run_end = i + 1;
+    while (run_end < a.size && a[run_end] == key)
+        ++run_end;
+    for (; j < b.size && b[j] == key; ++j)
+        emit(i, run_end, j);
+    i = run_end;
+}
+
+template <typename Emit>
+inline void merge_branchless_(SortedKeys const& a, SortedKeys const& b, Emit& emit)
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.size && j < b.size) {
+        uint32_t const ka = a[i];
+        uint32_t const kb = b[j];
+        if (ka == kb) [[unlikely]] {
+            emit_run_(a, b, i, j, ka, emit);
+            continue;
+        }
+        i += static_cast<std::size_t>(ka < kb);
+        j += static_cast<std::size_t>(kb < ka);
+    }
+}
+
+// First index >= i whose key is not below key.
+inline std::size_t skip_below_scalar(SortedKeys const& v, std::size_t i, uint32_t key)
+{
+    while (i < v.size && v[i] < key)
+        ++i;
+    return i;
+}
+
+struct SkipBelowScalar {
+    std::size_t operator()(SortedKeys const& v, std::size_t i, uint32_t key) const
+    {
+        return skip_below_scalar(v, i, key);
+    }
+};
+
+template <typename SkipA, typename SkipB, typename Emit>
+inline void merge_skipping_(
+    SortedKeys const& a, SortedKeys const& b, SkipA skip_a, SkipB skip_b, Emit& emit)
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.size && j < b.size) {
+        uint32_t const ka = a[i];
+        uint32_t const kb = b[j];
+        if (ka < kb)
+            i = skip_a(a, i + 1, kb);
+        else if (kb < ka)
+            j = skip_b(b, j + 1, ka);
+        else
+            emit_run_(a, b, i, j, ka, emit);
+    }
+}
+
+#if POS2_HAVE_AVX2_KERNELS
+// Block compares for contiguous keys and 8-byte entries (stride <= 2). No gathers: they are
+// microcoded on CPUs with the GDS mitigation and cost far more than the scalar walk.
+__attribute__((target("avx2"))) inline std::size_t skip_below_avx2(
+    SortedKeys const& v, std::size_t i, uint32_t key)
+{
+    // Unsigned order through signed compares: flip the sign bit on both sides.
+    __m256i const bias = _mm256_set1_epi32(int32_t(0x80000000u));
+    __m256i const vkey = _mm256_xor_si256(_mm256_set1_epi32(int32_t(key)), bias);
+    __m256i const vmask = _mm256_set1_epi32(int32_t(v.mask));
+    __m256i const even_lo = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    while (i + 8 <= v.size) {
+        __m256i const* p = reinterpret_cast<__m256i const*>(v.base + i * v.stride);
+        __m256i keys;
+        if (v.stride == 1) {
+            keys = _mm256_loadu_si256(p);
+        }
+        else {
+            __m256i const lo = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(p), even_lo);
+            __m256i const hi = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(p + 1), even_lo);
+            keys = _mm256_blend_epi32(lo, hi, 0xF0);
+        }
+        keys = _mm256_xor_si256(_mm256_and_si256(keys, vmask), bias);
+        // lanes below key form a prefix, since the keys ascend
+        unsigned const below = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(vkey, keys))));
+        if (below != 0xFFu)
+            return i + static_cast<std::size_t>(__builtin_popcount(below));
+        i += 8;
+    }
+    return skip_below_scalar(v, i, key);
+}
+
+// Only the skip is compiled for AVX2. The merge loop and emit stay generic code, so the
+// caller's per-match work is not re-vectorized for AVX2 behind its back (e.g. the software AES
+// tables into gathers).
+struct SkipBelowAvx2 {
+    std::size_t operator()(SortedKeys const& v, std::size_t i, uint32_t key) const
+    {
+        for (std::size_t n = 0; n < kScalarProbe && i < v.size; ++n, ++i) {
+            if (v[i] >= key)
+                return i;
+        }
+        return skip_below_avx2(v, i, key);
+    }
+};
+
+inline bool cpu_has_avx2()
+{
+    static bool const has = __builtin_cpu_supports("avx2");
+    return has;
+}
+#endif
+
+inline bool skewed_(SortedKeys const& a, SortedKeys const& b)
+{
+    return a.size > kSkewedRatio * b.size || b.size > kSkewedRatio * a.size;
+}
+
+} // namespace sorted_intersect_detail
+
+// Portable kernel (no AVX2 skips); same results as intersect_sorted.
+template <typename Emit>
+void intersect_sorted_scalar(SortedKeys const& a, SortedKeys const& b, Emit&& emit)
+{
+    using namespace sorted_intersect_detail;
+    if (skewed_(a, b))
+        merge_skipping_(a, b, SkipBelowScalar {}, SkipBelowScalar {}, emit);
+    else
+        merge_branchless_(a, b, emit);
+}
+
+// True when intersect_sorted can use AVX2 block skips on this CPU.
+inline bool intersect_sorted_uses_avx2()
+{
+#if POS2_HAVE_AVX2_KERNELS
+    return sorted_intersect_detail::cpu_has_avx2();
+#else
+    return false;
+#endif
+}
+
+// For every entry j of b whose key also occurs in a, calls emit(a_begin, a_end, j), where
+// [a_begin, a_end) is the run of a with that key. Both sequences must ascend (after masking).
+template <typename Emit>
+void intersect_sorted(SortedKeys const& a, SortedKeys const& b, Emit&& emit)
+{
+#if POS2_HAVE_AVX2_KERNELS
+    using namespace sorted_intersect_detail;
+    if (skewed_(a, b) && cpu_has_avx2()) {
+        // only the longer side needs block skips
+        bool const simd_a = a.size > b.size && a.stride <= 2;
+        bool const simd_b = b.size > a.size && b.stride <= 2;
+        if (simd_a)
+            merge_skipping_(a, b, SkipBelowAvx2 {}, SkipBelowScalar {}, emit);
+        else if (simd_b)
+            merge_skipping_(a, b, SkipBelowScalar {}, SkipBelowAvx2 {}, emit);
+        else
+            merge_skipping_(a, b, SkipBelowScalar {}, SkipBelowScalar {}, emit);
+        return;
+    }
+#endif
+    intersect_sorted_scalar(a, b, emit);
+}
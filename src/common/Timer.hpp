@@ -2,6 +2,10 @@
 
 #include <chrono>
 #include <iostream>
+#include <string>
+
+#include "common/PerfCounters.hpp"
+#include "common/Trace.hpp"
 
 class Timer {
 public:
@@ -11,12 +15,20 @@ public:
 
     std::chrono::steady_clock::time_point now() { return std::chrono::steady_clock::now(); }
 
+    // A named phase is also recorded as a span on the calling thread's lane while a trace is
+    // being recorded (see Trace.hpp). While hardware counters are on (see PerfCounters.hpp) each
+    // start()/stop() also takes their deltas.
     void start(std::string msg = "")
     {
         if (debugOut && msg != "") {
             this->message = msg;
             std::cout << message << std::endl;
         }
+        else if (msg != "" && active_trace() != nullptr) {
+            this->message = std::move(msg);
+        }
+        PerfCounterSession* perf = active_perf_counters();
+        start_counters = perf ? perf->read() : PerfCounterValues {};
         start_time_point = now();
     }
 
@@ -24,14 +36,26 @@ public:
     {
         std::chrono::steady_clock::time_point end_time_point = now();
         std::chrono::duration<double, std::milli> duration = end_time_point - start_time_point;
+        PerfCounterSession* perf = start_counters.valid ? active_perf_counters() : nullptr;
+        last_counters = perf ? perf->read().since(start_counters) : PerfCounterValues {};
+        if (message != "") {
+            if (TraceRecorder* trace = active_trace())
+                trace->span(message, "phase", current_trace_lane(), start_time_point,
+                    end_time_point, last_counters.json_fields());
+        }
         if (debugOut && message != "") {
             std::cout << message << " took " << duration.count() << "ms" << std::endl;
-            message = "";
         }
+        message = "";
         return duration.count();
     }
 
+    // Counter deltas of the last start()/stop(); not valid() while counters are off.
+    PerfCounterValues const& counters() const { return last_counters; }
+
 private:
     std::chrono::steady_clock::time_point start_time_point;
     std::string message;
+    PerfCounterValues start_counters;
+    PerfCounterValues last_counters;
 };
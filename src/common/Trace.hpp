@@ -0,0 +1,246 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/TraceHooks.hpp"
+
+// Timeline recording in the Chrome trace-event format, which chrome://tracing and Perfetto
+// (ui.perfetto.dev) open directly.
+//
+// Spans are recorded into the process-wide active TraceRecorder, if any (ScopedTraceRecording);
+// with none active, recording costs one atomic load. Spans are placed on lanes (trace
+// "threads"): lane 0 is the thread that drives plotting or solving, and each parallel_for worker
+// thread gets a lane of its own (see TraceHooks.hpp), so a worker's span shows which share of a
+// parallel loop it ran and when it finished, also when loops run concurrently.
+//
+// Sources: parallel_for workers, named Timer phases (the plotter's table phases and the solver
+// phases behind ProofSolverTimings) and progress events through ChromeTraceSink.
+class TraceRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t kMainLane = 0;
+
+    TraceRecorder()
+        : origin_(clock::now())
+    {
+    }
+
+    TraceRecorder(TraceRecorder const&) = delete;
+    TraceRecorder& operator=(TraceRecorder const&) = delete;
+
+    // A span ("complete" event). args_json is a JSON object body without braces, e.g.
+    // "\"items\":12", or empty.
+    void span(std::string_view name,
+        char const* category,
+        uint32_t lane,
+        clock::time_point begin,
+        clock::time_point end,
+        std::string args_json = {})
+    {
+        Event e { std::string(name), category, lane, us_(begin), us_(end) - us_(begin),
+            std::move(args_json), 'X' };
+        std::lock_guard lock(mutex_);
+        events_.push_back(std::move(e));
+    }
+
+    // A point in time ("instant" event), e.g. a note.
+    void instant(std::string_view name, char const* category, uint32_t lane, clock::time_point at,
+        std::string args_json = {})
+    {
+        Event e { std::string(name), category, lane, us_(at), 0.0, std::move(args_json), 'i' };
+        std::lock_guard lock(mutex_);
+        events_.push_back(std::move(e));
+    }
+
+    // Lanes are named "main" and "worker <n>" unless named here.
+    void name_lane(uint32_t lane, std::string name)
+    {
+        std::lock_guard lock(mutex_);
+        lane_names_[lane] = std::move(name);
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard lock(mutex_);
+        return events_.size();
+    }
+
+    void write(std::ostream& os) const
+    {
+        std::lock_guard lock(mutex_);
+        std::map<uint32_t, std::string> names = lane_names_;
+        for (Event const& e: events_) {
+            if (!names.count(e.lane))
+                names[e.lane] = e.lane == kMainLane ? "main"
+                                                    : "worker " + std::to_string(e.lane - 1);
+        }
+
+        os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        for (auto const& [lane, name]: names) {
+            os << (first ? "" : ",") << "\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << lane
+               << ",\"name\":\"thread_name\",\"args\":{\"name\":\"" << json_escape(name) << "\"}}";
+            os << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << lane
+               << ",\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":" << lane << "}}";
+            first = false;
+        }
+        std::ostringstream num;
+        num.precision(3);
+        num << std::fixed;
+        for (Event const& e: events_) {
+            num.str({});
+            num << e.ts_us;
+            os << (first ? "" : ",") << "\n{\"ph\":\"" << e.phase << "\",\"pid\":1,\"tid\":"
+               << e.lane << ",\"ts\":" << num.str();
+            if (e.phase == 'X') {
+                num.str({});
+                num << e.dur_us;
+                os << ",\"dur\":" << num.str();
+            }
+            else {
+                os << ",\"s\":\"t\"";
+            }
+            os << ",\"cat\":\"" << e.category << "\",\"name\":\"" << json_escape(e.name) << "\"";
+            if (!e.args_json.empty())
+                os << ",\"args\":{" << e.args_json << "}";
+            os << "}";
+            first = false;
+        }
+        os << "\n]}\n";
+    }
+
+    std::string to_json() const
+    {
+        std::ostringstream os;
+        write(os);
+        return os.str();
+    }
+
+    void write_file(std::string const& path) const
+    {
+        std::ofstream out(path, std::ios::binary);
+        write(out);
+        out.flush();
+        if (!out)
+            throw std::runtime_error("TraceRecorder: could not write " + path);
+    }
+
+    // Escapes a string for use inside a JSON string, e.g. in args_json.
+    static std::string json_escape(std::string_view s)
+    {
+        std::string out;
+        out.reserve(s.size());
+        for (char c: s) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                out += ' ';
+            }
+            else {
+                out += c;
+            }
+        }
+        return out;
+    }
+
+private:
+    struct Event {
+        std::string name;
+        char const* category;
+        uint32_t lane;
+        double ts_us;
+        double dur_us;
+        std::string args_json;
+        char phase;
+    };
+
+    double us_(clock::time_point t) const
+    {
+        return std::chrono::duration<double, std::micro>(t - origin_).count();
+    }
+
+    clock::time_point const origin_;
+    mutable std::mutex mutex_;
+    std::vector<Event> events_;
+    std::map<uint32_t, std::string> lane_names_;
+};
+
+// The recorder spans go to, or nullptr when nothing is being traced.
+inline TraceRecorder* active_trace() noexcept
+{
+    return trace_detail::active.load(std::memory_order_acquire);
+}
+
+// Lane of the calling thread: its worker lane inside a parallel_for worker, else kMainLane.
+static_assert(TraceRecorder::kMainLane == 0, "trace_detail::lane starts on the main lane");
+inline uint32_t current_trace_lane() noexcept { return trace_detail::lane; }
+
+// Makes `recorder` the active one for its lifetime. Not nestable.
+class ScopedTraceRecording {
+public:
+    explicit ScopedTraceRecording(TraceRecorder& recorder)
+    {
+        trace_detail::record_span.store(
+            [](TraceRecorder& r, char const* name, char const* category, uint32_t lane,
+                TraceRecorder::clock::time_point begin, TraceRecorder::clock::time_point end) {
+                r.span(name, category, lane, begin, end);
+            },
+            std::memory_order_relaxed);
+        trace_detail::active.store(&recorder, std::memory_order_release);
+    }
+    ~ScopedTraceRecording() { trace_detail::active.store(nullptr, std::memory_order_release); }
+
+    ScopedTraceRecording(ScopedTraceRecording const&) = delete;
+    ScopedTraceRecording& operator=(ScopedTraceRecording const&) = delete;
+};
+
+// Records the enclosing scope as a span on `lane`, which also becomes the calling thread's lane
+// for the scope. Does nothing when no recorder is active at construction.
+class TraceSpan {
+public:
+    TraceSpan(char const* name, char const* category, uint32_t lane)
+        : recorder_(active_trace())
+    {
+        if (recorder_ == nullptr)
+            return;
+        name_ = name;
+        category_ = category;
+        lane_ = lane;
+        saved_lane_ = std::exchange(trace_detail::lane, lane);
+        begin_ = TraceRecorder::clock::now();
+    }
+
+    ~TraceSpan()
+    {
+        if (recorder_ == nullptr)
+            return;
+        recorder_->span(name_, category_, lane_, begin_, TraceRecorder::clock::now());
+        trace_detail::lane = saved_lane_;
+    }
+
+    TraceSpan(TraceSpan const&) = delete;
+    TraceSpan& operator=(TraceSpan const&) = delete;
+
+private:
+    TraceRecorder* recorder_;
+    char const* name_ = nullptr;
+    char const* category_ = nullptr;
+    uint32_t lane_ = 0;
+    uint32_t saved_lane_ = 0;
+    TraceRecorder::clock::time_point begin_ {};
+};
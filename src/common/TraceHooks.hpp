@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// The part of tracing that core code such as parallel_for needs: the active recorder, the calling
+// thread's lane and worker spans. The recorder itself lives in Trace.hpp, which hot headers do
+// not have to include; spans reach it through the function ScopedTraceRecording installs.
+class TraceRecorder;
+
+namespace trace_detail {
+using clock = std::chrono::steady_clock;
+using SpanFn = void (*)(TraceRecorder&, char const* name, char const* category, uint32_t lane,
+    clock::time_point begin, clock::time_point end);
+
+inline std::atomic<TraceRecorder*> active { nullptr };
+inline std::atomic<SpanFn> record_span { nullptr };
+inline thread_local uint32_t lane = 0;
+
+// Worker lanes 1, 2, ... for OS threads. A thread takes the lowest free lane the first time it
+// records a worker span and gives it back when it exits, so threads alive at the same time never
+// share a lane, while the fresh threads of successive parallel loops reuse the same few lanes.
+class LanePool {
+public:
+    uint32_t acquire()
+    {
+        std::lock_guard lock(mutex_);
+        std::size_t i = 0;
+        while (i < used_.size() && used_[i])
+            ++i;
+        if (i == used_.size())
+            used_.push_back(false);
+        used_[i] = true;
+        return static_cast<uint32_t>(1 + i);
+    }
+
+    void release(uint32_t lane)
+    {
+        std::lock_guard lock(mutex_);
+        used_[lane - 1] = false;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<bool> used_;
+};
+
+inline LanePool lane_pool;
+
+struct ThreadLane {
+    uint32_t id = 0;
+    ~ThreadLane()
+    {
+        if (id != 0)
+            lane_pool.release(id);
+    }
+};
+
+inline uint32_t thread_worker_lane()
+{
+    thread_local ThreadLane lane;
+    if (lane.id == 0)
+        lane.id = lane_pool.acquire();
+    return lane.id;
+}
+} // namespace trace_detail
+
+// Records the enclosing scope as a span on the calling thread's worker lane, which also becomes
+// its lane for the scope. Does nothing when no recorder is active at construction.
+class TraceWorkerSpan {
+public:
+    explicit TraceWorkerSpan(char const* name)
+        : recorder_(trace_detail::active.load(std::memory_order_acquire))
+    {
+        if (recorder_ == nullptr)
+            return;
+        name_ = name;
+        lane_ = trace_detail::thread_worker_lane();
+        saved_lane_ = std::exchange(trace_detail::lane, lane_);
+        begin_ = trace_detail::clock::now();
+    }
+
+    ~TraceWorkerSpan()
+    {
+        if (recorder_ == nullptr)
+            return;
+        trace_detail::record_span.load(std::memory_order_relaxed)(
+            *recorder_, name_, "parallel", lane_, begin_, trace_detail::clock::now());
+        trace_detail::lane = saved_lane_;
+    }
+
+    TraceWorkerSpan(TraceWorkerSpan const&) = delete;
+    TraceWorkerSpan& operator=(TraceWorkerSpan const&) = delete;
+
+private:
+    TraceRecorder* recorder_;
+    char const* name_ = nullptr;
+    uint32_t lane_ = 0;
+    uint32_t saved_lane_ = 0;
+    trace_detail::clock::time_point begin_ {};
+};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+
+#include "Progress.hpp"
+#include "common/thread.hpp"
+
+// Decouples the plotting threads from a slow sink (console, logging, a C/Rust callback).
+//
+// on_event() copies the event into a bounded ring and returns; a consumer thread hands the
+// events to `next` in the order they were posted. Posting is lock-free and safe from any number
+// of threads (Vyukov's bounded queue: each slot carries a sequence number, producers claim a
+// position with one CAS). When the ring is full the event is dropped and counted in dropped(),
+// so a stalled consumer never stalls plotting.
+//
+// msg is copied into a fixed buffer in the slot, so posting does not allocate; only a message too
+// long for it (the PlotReport JSON sent once at the end of a plot) takes a heap copy. `next` sees
+// a pointer that stays valid for the duration of its call, as with a direct call. `next` cannot
+// cancel synchronously: a false return is seen by the events posted after it. Destruction
+// delivers the events still queued before it returns.
+//
+// A C or Rust callback gets the same decoupling through an IProgressSink with on_event_proc set
+// as `next`.
+class AsyncProgressSink final : public IProgressSink {
+public:
+    static constexpr std::size_t kDefaultCapacity = 4096;
+    // Messages up to this length (with the terminating NUL) are copied without allocating.
+    static constexpr std::size_t kInlineMsgBytes = 256;
+
+    explicit AsyncProgressSink(IProgressSink& next, std::size_t capacity = kDefaultCapacity)
+        : next_(next)
+        , capacity_(round_up_pow2_(capacity))
+        , slots_(new Slot[capacity_])
+    {
+        for (std::size_t i = 0; i < capacity_; ++i)
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        worker_.emplace([this]() { consume_(); });
+    }
+
+    AsyncProgressSink(AsyncProgressSink const&) = delete;
+    AsyncProgressSink& operator=(AsyncProgressSink const&) = delete;
+
+    ~AsyncProgressSink() override
+    {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        worker_.reset();
+    }
+
+    bool on_event(ProgressEvent const& e) noexcept override
+    {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & (capacity_ - 1)];
+            std::size_t const seq = slot->seq.load(std::memory_order_acquire);
+            auto const diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) {
+                // the consumer has not freed this slot yet: full
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return !cancelled_.load(std::memory_order_relaxed);
+            }
+            else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->event = e;
+        if (e.msg != nullptr)
+            slot->event.msg = copy_msg_(*slot, e.msg);
+        // seq_cst pairs with the consumer's sleeping_ store, see wait_for_event_()
+        slot->seq.store(pos + 1, std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_seq_cst)) {
+            std::lock_guard lock(mutex_);
+            cv_.notify_one();
+        }
+        return !cancelled_.load(std::memory_order_relaxed);
+    }
+
+    // Waits until every event posted so far has been delivered (or dropped). Posting from other
+    // threads meanwhile may keep it waiting.
+    void flush() const
+    {
+        while (delivered_.load(std::memory_order_acquire) != head_.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    // Events lost because the ring was full.
+    uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> seq { 0 };
+        ProgressEvent event {}; // msg points into this slot
+        char msg[kInlineMsgBytes];
+        std::unique_ptr<char[]> long_msg; // freed by the consumer once delivered
+    };
+
+    // The slot's copy of msg; nullptr if a long one cannot be allocated.
+    static char const* copy_msg_(Slot& slot, char const* msg) noexcept
+    {
+        std::size_t const bytes = std::strlen(msg) + 1;
+        if (bytes <= kInlineMsgBytes) {
+            std::memcpy(slot.msg, msg, bytes);
+            return slot.msg;
+        }
+        slot.long_msg.reset(new (std::nothrow) char[bytes]);
+        if (slot.long_msg == nullptr)
+            return nullptr;
+        std::memcpy(slot.long_msg.get(), msg, bytes);
+        return slot.long_msg.get();
+    }
+
+    static std::size_t round_up_pow2_(std::size_t n)
+    {
+        std::size_t p = 2;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    bool ready_() const noexcept
+    {
+        return slots_[tail_ & (capacity_ - 1)].seq.load(std::memory_order_seq_cst) == tail_ + 1;
+    }
+
+    void consume_()
+    {
+        for (;;) {
+            while (ready_()) {
+                Slot& slot = slots_[tail_ & (capacity_ - 1)];
+                if (!next_.on_event(slot.event))
+                    cancelled_.store(true, std::memory_order_relaxed);
+                slot.long_msg.reset();
+                slot.seq.store(tail_ + capacity_, std::memory_order_release);
+                ++tail_;
+                delivered_.store(tail_, std::memory_order_release);
+            }
+            if (!wait_for_event_())
+                return;
+        }
+    }
+
+    // Sleeps until an event is ready; false once stopping with nothing left to deliver.
+    bool wait_for_event_()
+    {
+        std::unique_lock lock(mutex_);
+        // A producer publishes its slot and then reads sleeping_, while this stores sleeping_
+        // and then reads the slot (all seq_cst), so one of the two sees the other.
+        sleeping_.store(true, std::memory_order_seq_cst);
+        cv_.wait(lock, [&] { return stopping_ || ready_(); });
+        sleeping_.store(false, std::memory_order_relaxed);
+        return ready_();
+    }
+
+    IProgressSink& next_;
+    std::size_t const capacity_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) std::atomic<std::size_t> head_ { 0 }; // next position to claim
+    alignas(64) std::size_t tail_ = 0; // next position to deliver, consumer only
+    std::atomic<std::size_t> delivered_ { 0 };
+    std::atomic<uint64_t> dropped_ { 0 };
+    std::atomic<bool> cancelled_ { false };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> sleeping_ { false };
+    bool stopping_ = false; // guarded by mutex_
+
+    // Last member, so the consumer is joined before the state it uses goes away.
+    std::optional<thread> worker_;
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "Progress.hpp"
+#include "common/Trace.hpp"
+
+// Turns progress scopes into trace spans: plot, allocation, table, section pair, match key and
+// post-sort, each with its counts as args, and notes, warnings and errors into instant events.
+// Forwards every event to `next`.
+//
+// Spans end when the End event arrives and start `elapsed` before, so this must see the events
+// as they happen: put it in front of an AsyncProgressSink, not behind one.
+class ChromeTraceSink final : public IProgressSink {
+public:
+    explicit ChromeTraceSink(TraceRecorder& trace, IProgressSink& next = null_progress_sink())
+        : trace_(trace)
+        , next_(next)
+    {
+    }
+
+    bool on_event(ProgressEvent const& e) noexcept override
+    {
+        try {
+            record_(e);
+        }
+        catch (...) {
+            // tracing is best effort; never fail the plot over it
+        }
+        return next_.on_event(e);
+    }
+
+private:
+    void record_(ProgressEvent const& e)
+    {
+        auto const now = TraceRecorder::clock::now();
+        auto const begin = now - std::chrono::nanoseconds(e.elapsed);
+        uint32_t const lane = current_trace_lane();
+        std::string const t = "T" + std::to_string(e.table_id);
+
+        switch (e.kind) {
+        case EventKind::PlotEnd:
+            trace_.span("plot", "plot", lane, begin, now);
+            break;
+        case EventKind::AllocationEnd:
+            trace_.span("allocation", "plot", lane, begin, now);
+            break;
+        case EventKind::TableEnd:
+            trace_.span("table " + std::to_string(e.table_id), "table", lane, begin, now,
+                "\"items_in\":" + std::to_string(e.num_items_in));
+            break;
+        case EventKind::SectionEnd:
+            trace_.span(t + " sections " + std::to_string(e.section_l) + "-"
+                    + std::to_string(e.section_r),
+                "section", lane, begin, now);
+            break;
+        case EventKind::MatchKeyEnd:
+            trace_.span(t + " key " + std::to_string(e.match_key), "match_key", lane, begin, now,
+                "\"items_l\":" + std::to_string(e.items_l)
+                    + ",\"items_r\":" + std::to_string(e.items_r));
+            break;
+        case EventKind::PostSortEnd:
+            trace_.span(t + " post-sort", "post_sort", lane, begin, now,
+                "\"produced\":" + std::to_string(e.produced));
+            break;
+        case EventKind::Note:
+            trace_.instant(note_name_(e.note_id), "note", lane, now, note_args_(e));
+            break;
+        case EventKind::Warning:
+        case EventKind::Error:
+            trace_.instant(e.kind == EventKind::Error ? "error" : "warning", "note", lane, now,
+                msg_arg_(e));
+            break;
+        default:
+            break;
+        }
+    }
+
+    static char const* note_name_(NoteId id)
+    {
+        switch (id) {
+        case NoteId::LayoutTotalBytesAllocated:
+            return "layout allocated";
+        case NoteId::HasAESHardware:
+            return "AES hardware";
+        case NoteId::TableCapacityUsed:
+            return "table capacity used";
+        case NoteId::CheckpointWritten:
+            return "checkpoint written";
+        case NoteId::StreamingPass:
+            return "streaming pass";
+        case NoteId::PlotReport:
+            return "plot report";
+        default:
+            return "note";
+        }
+    }
+
+    static std::string note_args_(ProgressEvent const& e)
+    {
+        if (e.note_id == NoteId::PlotReport)
+            return {}; // the report is a JSON document of its own
+        std::string args = "\"u64_0\":" + std::to_string(e.u64_0)
+            + ",\"u64_1\":" + std::to_string(e.u64_1);
+        std::string const msg = msg_arg_(e);
+        return msg.empty() ? args : args + "," + msg;
+    }
+
+    static std::string msg_arg_(ProgressEvent const& e)
+    {
+        if (e.msg == nullptr)
+            return {};
+        return "\"msg\":\"" + TraceRecorder::json_escape(e.msg) + "\"";
+    }
+
+    TraceRecorder& trace_;
+    IProgressSink& next_;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "pos/ProofFragment.hpp"
+
+// Bounded LRU cache of decompressed plot chunks (or seek blocks), shared by any number of
+// PlotFiles and Provers and safe to use from several threads.
+//
+// Entries are keyed by plot ID, chunk index and seek block, so two PlotFiles of the same plot
+// share entries, and they are immutable: a hit hands out the decoded fragments without copying
+// them. Sized by the bytes of the fragments held; an entry larger than the whole cache is not
+// kept.
+class ChunkCache {
+public:
+    using Fragments = std::shared_ptr<std::vector<ProofFragment> const>;
+
+    // Marks an entry holding a whole chunk rather than one seek block.
+    static constexpr uint32_t kWholeChunk = UINT32_MAX;
+
+    struct Key {
+        std::array<uint8_t, 32> plot_id {};
+        uint64_t chunk = 0;
+        uint32_t block = kWholeChunk;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+
+        double hit_rate() const
+        {
+            uint64_t const lookups = hits + misses;
+            return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+    explicit ChunkCache(size_t capacity_bytes)
+        : capacity_bytes_(capacity_bytes)
+    {
+    }
+
+    ChunkCache(ChunkCache const&) = delete;
+    ChunkCache& operator=(ChunkCache const&) = delete;
+
+    // The cached fragments, or nullptr (a miss).
+    Fragments find(Key const& key)
+    {
+        std::lock_guard lock(mutex_);
+        auto const it = index_.find(key);
+        if (it == index_.end()) {
+            ++stats_.misses;
+            return nullptr;
+        }
+        ++stats_.hits;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->fragments;
+    }
+
+    // Adds (or replaces) an entry as the most recently used, evicting the least recently used
+    // entries to make room.
+    void insert(Key const& key, Fragments fragments)
+    {
+        size_t const bytes = fragments->size() * sizeof(ProofFragment);
+        std::lock_guard lock(mutex_);
+        if (auto const it = index_.find(key); it != index_.end()) {
+            stats_.bytes -= it->second->bytes;
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+        if (bytes > capacity_bytes_) {
+            return;
+        }
+        while (stats_.bytes + bytes > capacity_bytes_) {
+            Entry const& last = lru_.back();
+            stats_.bytes -= last.bytes;
+            index_.erase(last.key);
+            lru_.pop_back();
+            ++stats_.evictions;
+        }
+        lru_.push_front(Entry { key, std::move(fragments), bytes });
+        index_.emplace(key, lru_.begin());
+        stats_.bytes += bytes;
+    }
+
+    void clear()
+    {
+        std::lock_guard lock(mutex_);
+        lru_.clear();
+        index_.clear();
+        stats_.bytes = 0;
+    }
+
+    Stats stats() const
+    {
+        std::lock_guard lock(mutex_);
+        Stats s = stats_;
+        s.entries = index_.size();
+        return s;
+    }
+
+    size_t capacity_bytes() const { return capacity_bytes_; }
+
+private:
+    struct Entry {
+        Key key;
+        Fragments fragments;
+        size_t bytes;
+    };
+
+    struct KeyHash {
+        size_t operator()(Key const& key) const noexcept
+        {
+            uint64_t id = 0;
+            std::memcpy(&id, key.plot_id.data(), sizeof(id)); // plot IDs are hashes already
+            return static_cast<size_t>(
+                id ^ (key.chunk * 0x9e3779b97f4a7c15ULL) ^ (uint64_t(key.block) << 32));
+        }
+    };
+
+    size_t const capacity_bytes_;
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_; // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+    Stats stats_;
+};
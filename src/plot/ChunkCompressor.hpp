@@ -1,12 +1,28 @@
 #pragma once
 
-#include "fse.h" // adjust include path as needed
+#include "DeltaCodec.hpp"
 #include "pos/ProofCore.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <span>
+#include <utility>
 #include <stdexcept>
 #include <vector>
 
+// The AVX2 decode kernel is compiled for the avx2 target on its own and chosen at run time
+// (decodeUsesAvx2), as in SortedIntersect.hpp; the build does not target AVX2 as a whole.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define CHUNK_COMPRESSOR_AVX2 1
+#else
+#define CHUNK_COMPRESSOR_AVX2 0
+#endif
+
 // #define DEBUG_CHUNK_COMPRESSOR false
 
 class ChunkCompressor {
@@ -14,7 +30,8 @@ public:
     static std::vector<uint8_t> compressProofFragments(
         std::span<ProofFragment const> const proof_fragments,
         uint64_t const start_proof_fragment_range,
-        int const stub_bits)
+        int const stub_bits,
+        DeltaCoding const& coding = {})
     {
 #ifdef DEBUG_CHUNK_COMPRESSOR
         {
@@ -47,59 +64,234 @@ public:
             std::cout << "\n";
         }
 #endif
-        return compress(deltas, stubs, static_cast<uint8_t>(stub_bits));
+        return compress(deltas, stubs, static_cast<uint8_t>(stub_bits), coding);
     }
 
     static std::vector<ProofFragment> decompressProofFragments(
         std::span<uint8_t const> const compressed_data,
         uint64_t const start_proof_fragment_range,
-        int const stub_bits)
+        int const stub_bits,
+        DeltaCoding const& coding = {})
     {
-        std::vector<uint8_t> deltas;
-        std::vector<uint64_t> stubs;
-        decompress(compressed_data, static_cast<uint8_t>(stub_bits), deltas, stubs);
+        std::vector<ProofFragment> proof_fragments(fragmentCount(compressed_data));
+        decompressProofFragmentsInto(
+            compressed_data, start_proof_fragment_range, stub_bits, proof_fragments, coding);
 
 #ifdef DEBUG_CHUNK_COMPRESSOR
-        if (deltas.size() < 100) {
-            std::cout << "Decompressed Deltas:\n";
-            for (auto const& value: deltas) {
-                std::cout << static_cast<int>(value) << " ";
-            }
-            std::cout << "\nDecompressed Stubs:\n";
-            for (auto const& value: stubs) {
-                std::cout << value << " ";
+        if (proof_fragments.size() < 100) {
+            std::cout << "Reconstructed Proof Fragments:\n";
+            for (auto const& fragment: proof_fragments) {
+                std::cout << fragment << " ";
             }
             std::cout << "\n";
         }
 #endif
 
-        if (deltas.size() != stubs.size()) {
-            throw std::runtime_error("ChunkCompressor::decompressProofFragments: size mismatch "
-                                     "between deltas and stubs");
+        return proof_fragments;
+    }
+
+    // The number of fragments in a block produced by compress(), from its header alone.
+    static uint32_t fragmentCount(std::span<uint8_t const> const compressed_data)
+    {
+        uint8_t const* p = compressed_data.data();
+        return read_u32(p, compressed_data.data() + compressed_data.size());
+    }
+
+    // As decompressProofFragments, into `out`, which must hold exactly fragmentCount() fragments.
+    //
+    // Decodes in one pass over the output: the deltas are entropy-decoded into the tail of `out`
+    // itself and each stub is cut straight out of the packed bytes, so neither the deltas nor the
+    // stubs get a vector of their own (see reconstructFragments).
+    static void decompressProofFragmentsInto(std::span<uint8_t const> const compressed_data,
+        uint64_t const start_proof_fragment_range,
+        int const stub_bits,
+        std::span<ProofFragment> const out,
+        DeltaCoding const& coding = {})
+    {
+        decompressInto_(
+            compressed_data, start_proof_fragment_range, stub_bits, out, coding, decodeUsesAvx2());
+    }
+
+    // As decompressProofFragmentsInto, on the portable kernel only; same results.
+    static void decompressProofFragmentsIntoScalar(std::span<uint8_t const> const compressed_data,
+        uint64_t const start_proof_fragment_range,
+        int const stub_bits,
+        std::span<ProofFragment> const out,
+        DeltaCoding const& coding = {})
+    {
+        decompressInto_(compressed_data, start_proof_fragment_range, stub_bits, out, coding, false);
+    }
+
+    // True when decompressProofFragmentsInto rebuilds fragments with AVX2 on this CPU.
+    static bool decodeUsesAvx2()
+    {
+#if CHUNK_COMPRESSOR_AVX2
+        static bool const has = __builtin_cpu_supports("avx2");
+        return has;
+#else
+        return false;
+#endif
+    }
+
+    // ---- Seekable chunks ----
+    //
+    // A seekable chunk splits the chunk's fragment range into 2^num_blocks_bits equal sub-ranges
+    // and compresses each on its own (deltas from the sub-range start), so one sub-range can be
+    // decoded without the rest:
+    //   uint32_t num_blocks
+    //   uint32_t block_end[num_blocks]   end of each block, relative to the end of this table
+    //   block_0 ... (each as produced by compress())
+
+    static std::vector<uint8_t> compressSeekableProofFragments(
+        std::span<ProofFragment const> const proof_fragments,
+        uint64_t const start_proof_fragment_range,
+        int const block_range_bits,
+        int const num_blocks_bits,
+        int const stub_bits,
+        DeltaCoding const& coding = {})
+    {
+        uint32_t const num_blocks = 1u << num_blocks_bits;
+        uint64_t const block_range = 1ULL << block_range_bits;
+
+        std::vector<uint8_t> chunk(seekTableSize(num_blocks));
+        uint8_t* table = chunk.data();
+        write_u32(table, num_blocks);
+
+        size_t begin = 0;
+        for (uint32_t b = 0; b < num_blocks; ++b) {
+            uint64_t const block_start = start_proof_fragment_range + b * block_range;
+            size_t end = begin;
+            while (end < proof_fragments.size()
+                && (b + 1 == num_blocks || proof_fragments[end] < block_start + block_range)) {
+                ++end;
+            }
+            std::vector<uint8_t> const block = compressProofFragments(
+                proof_fragments.subspan(begin, end - begin), block_start, stub_bits, coding);
+            chunk.insert(chunk.end(), block.begin(), block.end());
+            table = chunk.data() + 4 + 4 * size_t(b);
+            write_u32(table, static_cast<uint32_t>(chunk.size() - seekTableSize(num_blocks)));
+            begin = end;
+        }
+        return chunk;
+    }
+
+    static constexpr size_t seekTableSize(uint32_t num_blocks)
+    {
+        return 4 + 4 * size_t(num_blocks);
+    }
+
+    // Where block `block` lies in a seekable chunk: {offset from chunk start, size}. `table` needs
+    // to hold only the first seekTableSize(num_blocks) bytes of the chunk.
+    static std::pair<uint64_t, uint64_t> seekBlockExtent(
+        std::span<uint8_t const> const table, uint32_t const num_blocks, uint32_t const block)
+    {
+        uint8_t const* p = table.data();
+        uint8_t const* const end = table.data() + table.size();
+        if (read_u32(p, end) != num_blocks || block >= num_blocks) {
+            throw std::runtime_error("ChunkCompressor::seekBlockExtent: bad seek table");
+        }
+        uint8_t const* q = p + 4 * size_t(block);
+        uint32_t const block_end = read_u32(q, end);
+        uint32_t block_begin = 0;
+        if (block > 0) {
+            q -= 8;
+            block_begin = read_u32(q, end);
+        }
+        if (block_end < block_begin) {
+            throw std::runtime_error("ChunkCompressor::seekBlockExtent: bad seek table");
         }
+        return { seekTableSize(num_blocks) + block_begin, block_end - block_begin };
+    }
 
-        std::vector<ProofFragment> proof_fragments;
-        proof_fragments.reserve(deltas.size());
+    static std::vector<ProofFragment> decompressSeekableProofFragments(
+        std::span<uint8_t const> const chunk,
+        uint64_t const start_proof_fragment_range,
+        int const block_range_bits,
+        int const num_blocks_bits,
+        int const stub_bits,
+        DeltaCoding const& coding = {})
+    {
+        std::vector<ProofFragment> proof_fragments(seekableFragmentCount(chunk, num_blocks_bits));
+        decompressSeekableProofFragmentsInto(chunk,
+            start_proof_fragment_range,
+            block_range_bits,
+            num_blocks_bits,
+            stub_bits,
+            proof_fragments,
+            coding);
+        return proof_fragments;
+    }
 
-        ProofFragment previous = start_proof_fragment_range;
-        for (size_t i = 0; i < deltas.size(); ++i) {
-            uint64_t delta = (static_cast<uint64_t>(deltas[i]) << stub_bits) | stubs[i];
-            ProofFragment fragment = previous + delta;
-            proof_fragments.push_back(fragment);
-            previous = fragment;
+    // The number of fragments in a seekable chunk, from the seek table and block headers alone.
+    static size_t seekableFragmentCount(
+        std::span<uint8_t const> const chunk, int const num_blocks_bits)
+    {
+        uint32_t const num_blocks = 1u << num_blocks_bits;
+        size_t count = 0;
+        for (uint32_t b = 0; b < num_blocks; ++b) {
+            count += fragmentCount(seekBlock(chunk, num_blocks, b));
         }
+        return count;
+    }
 
-#ifdef DEBUG_CHUNK_COMPRESSOR
-        if (proof_fragments.size() < 100) {
-            std::cout << "Reconstructed Proof Fragments:\n";
-            for (auto const& fragment: proof_fragments) {
-                std::cout << fragment << " ";
+    // As decompressSeekableProofFragments, into `out`, which must hold exactly
+    // seekableFragmentCount() fragments; each block decodes straight into its place.
+    static void decompressSeekableProofFragmentsInto(std::span<uint8_t const> const chunk,
+        uint64_t const start_proof_fragment_range,
+        int const block_range_bits,
+        int const num_blocks_bits,
+        int const stub_bits,
+        std::span<ProofFragment> const out,
+        DeltaCoding const& coding = {})
+    {
+        uint32_t const num_blocks = 1u << num_blocks_bits;
+        size_t begin = 0;
+        for (uint32_t b = 0; b < num_blocks; ++b) {
+            std::span<uint8_t const> const block = seekBlock(chunk, num_blocks, b);
+            size_t const count = fragmentCount(block);
+            if (count > out.size() - begin) {
+                break;
             }
-            std::cout << "\n";
+            decompressProofFragmentsInto(block,
+                start_proof_fragment_range + (uint64_t(b) << block_range_bits),
+                stub_bits,
+                out.subspan(begin, count),
+                coding);
+            begin += count;
         }
-#endif
+        if (begin != out.size()) {
+            throw std::invalid_argument("ChunkCompressor::decompressSeekableProofFragmentsInto: "
+                                        "output size differs from chunk");
+        }
+    }
 
-        return proof_fragments;
+    // Adds the deltas compressSeekableProofFragments codes for these fragments to `counts`, e.g.
+    // to train a SharedFseTable on them.
+    static void countSeekableDeltas(std::span<ProofFragment const> const proof_fragments,
+        uint64_t const start_proof_fragment_range,
+        int const block_range_bits,
+        int const num_blocks_bits,
+        int const stub_bits,
+        std::array<uint64_t, 256>& counts)
+    {
+        uint32_t const num_blocks = 1u << num_blocks_bits;
+        uint64_t const block_range = 1ULL << block_range_bits;
+        size_t i = 0;
+        for (uint32_t b = 0; b < num_blocks; ++b) {
+            uint64_t const block_start = start_proof_fragment_range + b * block_range;
+            ProofFragment previous = block_start;
+            for (; i < proof_fragments.size()
+                && (b + 1 == num_blocks || proof_fragments[i] < block_start + block_range);
+                ++i) {
+                uint64_t const delta_byte = (proof_fragments[i] - previous) >> stub_bits;
+                if (proof_fragments[i] < previous || delta_byte > 0xFF) {
+                    throw std::invalid_argument("ChunkCompressor::countSeekableDeltas: fragments "
+                                                "not non-decreasing or delta too large");
+                }
+                ++counts[delta_byte];
+                previous = proof_fragments[i];
+            }
+        }
     }
 
     static std::pair<std::vector<uint8_t>, std::vector<uint64_t>> deltifyAndStubProofFragments(
@@ -148,11 +340,13 @@ public:
     // - deltas: 1-byte per value (already computed)
     // - stubs: low bits for each value (uint64_t, but only stub_bits used)
     // - stub_bits: number of LSBs in each stub (1..56 typically)
+    // - coding: entropy coder for the deltas (and its table); the reader must pass the same one
     //
     // Returns: encoded chunk bytes
     static std::vector<uint8_t> compress(std::span<uint8_t const> const deltas,
         std::span<uint64_t const> const stubs,
-        uint8_t const stub_bits)
+        uint8_t const stub_bits,
+        DeltaCoding const& coding = {})
     {
         // deltas and stubs must have the same size
         assert(deltas.size() == stubs.size());
@@ -165,22 +359,18 @@ public:
             std::vector<uint8_t> chunk;
             chunk.reserve(12);
             append_u32(chunk, 0); // num_values
-            append_u32(chunk, 0); // fse_size
+            append_u32(chunk, 0); // deltas_size
             append_u32(chunk, 0); // stub_bytes_size
             return chunk;
         }
 
-        // 1) FSE-compress the deltas
-        size_t srcSize = deltas.size();
-        size_t maxDst = POS2_FSE_compressBound(srcSize);
-        std::vector<uint8_t> fse_data(maxDst);
-
-        size_t cSize = POS2_FSE_compress(fse_data.data(), maxDst, deltas.data(), srcSize);
-        if (POS2_FSE_isError(cSize)) {
-            throw std::runtime_error("ChunkCompressor::compress: FSE_compress failed");
+        // 1) Entropy-code the deltas
+        std::vector<uint8_t> delta_data = DeltaCoder::encode(coding, deltas);
+        // the codec could not shrink them: store the deltas as they are, marked by size 0
+        uint32_t const deltas_size = static_cast<uint32_t>(delta_data.size());
+        if (delta_data.empty()) {
+            delta_data.assign(deltas.begin(), deltas.end());
         }
-        fse_data.resize(cSize);
-        uint32_t const fse_size = static_cast<uint32_t>(cSize);
 
         // 2) Bit-pack stubs into bytes
         std::vector<uint8_t> stub_bytes = packStubs(stubs, stub_bits);
@@ -188,14 +378,14 @@ public:
 
         // 3) Build chunk blob
         std::vector<uint8_t> chunk;
-        chunk.reserve(12 + fse_size + stub_bytes_size);
+        chunk.reserve(12 + delta_data.size() + stub_bytes_size);
 
         append_u32(chunk, num_values);
-        append_u32(chunk, fse_size);
+        append_u32(chunk, deltas_size);
         append_u32(chunk, stub_bytes_size);
 
-        // fse data
-        chunk.insert(chunk.end(), fse_data.begin(), fse_data.end());
+        // delta data
+        chunk.insert(chunk.end(), delta_data.begin(), delta_data.end());
         // stub data
         chunk.insert(chunk.end(), stub_bytes.begin(), stub_bytes.end());
 
@@ -204,53 +394,248 @@ public:
 
     // Decompress a single chunk
     // - chunk: bytes produced by compress()
-    // - stub_bits: same as used during compression
+    // - stub_bits, coding: same as used during compression
     // Output:
     // - out_deltas: resized to num_values, filled with deltas
     // - out_stubs:  resized to num_values, filled with stub values
     static void decompress(std::span<uint8_t const> const chunk,
         uint8_t const stub_bits,
         std::vector<uint8_t>& out_deltas,
-        std::vector<uint64_t>& out_stubs)
+        std::vector<uint64_t>& out_stubs,
+        DeltaCoding const& coding = {})
+    {
+        EncodedBlock const block = parseBlock(chunk, stub_bits);
+
+        out_deltas.resize(block.num_values);
+        out_stubs.resize(block.num_values);
+        if (block.num_values == 0) {
+            return;
+        }
+
+        // 1) Entropy-decode deltas
+        decodeDeltas(block, coding, out_deltas.data());
+
+        // 2) Unpack stubs
+        unpackStubs(block.stubs.data(), block.stubs.size(), stub_bits, out_stubs);
+    }
+
+private:
+    // ---- Block parsing and decoding ----
+
+    // The decode behind decompressProofFragmentsInto, with the kernel chosen by the caller.
+    static void decompressInto_(std::span<uint8_t const> const compressed_data,
+        uint64_t const start_proof_fragment_range,
+        int const stub_bits,
+        std::span<ProofFragment> const out,
+        DeltaCoding const& coding,
+        bool const use_avx2)
+    {
+        EncodedBlock const block = parseBlock(compressed_data, static_cast<uint8_t>(stub_bits));
+        size_t const num_values = block.num_values;
+        if (out.size() != num_values) {
+            throw std::invalid_argument(
+                "ChunkCompressor::decompressProofFragmentsInto: output size differs from block");
+        }
+        if (num_values == 0) {
+            return;
+        }
+
+        // the last num_values bytes of the output; fragment i (bytes [8i, 8i + 8)) never
+        // overwrites a delta after delta i (at 7n + i)
+        uint8_t* const deltas = reinterpret_cast<uint8_t*>(out.data()) + 7 * num_values;
+        decodeDeltas(block, coding, deltas);
+        reconstructFragments(deltas,
+            block.stubs,
+            stub_bits,
+            start_proof_fragment_range,
+            out.data(),
+            num_values,
+            use_avx2);
+    }
+
+    // The bytes of block `block` of a seekable chunk.
+    static std::span<uint8_t const> seekBlock(
+        std::span<uint8_t const> const chunk, uint32_t const num_blocks, uint32_t const block)
+    {
+        if (chunk.size() < seekTableSize(num_blocks)) {
+            throw std::runtime_error("ChunkCompressor::decompressSeekable: chunk truncated");
+        }
+        auto const [offset, size] = seekBlockExtent(chunk, num_blocks, block);
+        if (offset + size > chunk.size()) {
+            throw std::runtime_error("ChunkCompressor::decompressSeekable: chunk truncated");
+        }
+        return chunk.subspan(offset, size);
+    }
+
+    // The parts of a block produced by compress().
+    struct EncodedBlock {
+        uint32_t num_values = 0;
+        std::span<uint8_t const> deltas; // coded deltas, or the deltas themselves when raw
+        bool raw_deltas = false;
+        std::span<uint8_t const> stubs;
+    };
+
+    static EncodedBlock parseBlock(std::span<uint8_t const> const chunk, uint8_t const stub_bits)
     {
-        assert(chunk.size() > 12); // don't use tiny chunks
+        assert(chunk.size() >= 12); // an empty chunk is just its header
         assert(stub_bits >= 0 && stub_bits < 56);
 
         uint8_t const* p = chunk.data();
         uint8_t const* const end = chunk.data() + chunk.size();
 
-        uint32_t num_values = read_u32(p, end);
-        uint32_t fse_size = read_u32(p, end);
-        uint32_t stub_bytes_size = read_u32(p, end);
+        EncodedBlock block;
+        block.num_values = read_u32(p, end);
+        uint32_t const coded_size = read_u32(p, end);
+        uint32_t const stub_bytes_size = read_u32(p, end);
+        if (block.num_values == 0) {
+            return block;
+        }
 
-        // Handle empty chunk
-        if (num_values == 0) {
-            out_deltas.clear();
-            out_stubs.clear();
+        // coded size 0: the deltas are stored uncompressed
+        block.raw_deltas = coded_size == 0;
+        size_t const deltas_size = block.raw_deltas ? block.num_values : coded_size;
+        if (static_cast<size_t>(end - p) < deltas_size + stub_bytes_size) {
+            throw std::runtime_error("ChunkCompressor::decompress: chunk truncated");
+        }
+        if (uint64_t(stub_bytes_size) * 8 < uint64_t(block.num_values) * stub_bits) {
+            throw std::runtime_error("ChunkCompressor::unpackStubs: not enough stub data");
+        }
+        block.deltas = { p, deltas_size };
+        block.stubs = { p + deltas_size, stub_bytes_size };
+        return block;
+    }
+
+    // Writes the block's num_values deltas to `out`.
+    static void decodeDeltas(
+        EncodedBlock const& block, DeltaCoding const& coding, uint8_t* const out)
+    {
+        if (block.raw_deltas) {
+            std::memcpy(out, block.deltas.data(), block.num_values);
             return;
         }
+        DeltaCoder::decode(coding, block.deltas, { out, block.num_values });
+    }
 
-        if (chunk.data() + chunk.size() < p + fse_size + stub_bytes_size) {
-            throw std::runtime_error("ChunkCompressor::decompress: chunk truncated");
+    // out[i] = previous + sum of (deltas[j] << stub_bits | stub j) for j <= i.
+    //
+    // A stub is cut out of one unaligned 64-bit load at its byte (stub_bits < 56 keeps it within
+    // the word), which is the fixed-width extract pext would do, without the bit-buffer loop;
+    // only the last few stubs, whose word would read past the stub bytes, load what is left.
+    // With AVX2, four fragments are built per step and summed with an in-register prefix sum.
+    //
+    // `deltas` may alias the bytes of `out` from out + 7n on: each step reads its deltas before
+    // it stores, and stores only below the deltas still to be read.
+    static void reconstructFragments(uint8_t const* const deltas,
+        std::span<uint8_t const> const stub_bytes,
+        int const stub_bits,
+        ProofFragment previous,
+        ProofFragment* const out,
+        size_t const num_values,
+        bool const use_avx2)
+    {
+        uint8_t const* const stubs = stub_bytes.data();
+        uint64_t const mask = (1ULL << stub_bits) - 1;
+        // stubs [0, full_words) can load a whole word
+        size_t full_words = 0;
+        if (stub_bits > 0 && stub_bytes.size() >= 8) {
+            full_words
+                = std::min<size_t>(num_values, ((stub_bytes.size() - 8) * 8 + 7) / stub_bits + 1);
         }
 
-        uint8_t const* fse_data = p;
-        uint8_t const* stub_bytes = p + fse_size;
+        size_t i = 0;
+#if CHUNK_COMPRESSOR_AVX2
+        if (use_avx2 && full_words >= 4) {
+            i = reconstructFragmentsAvx2(deltas, stubs, stub_bits, previous, out, full_words);
+        }
+#else
+        (void)use_avx2;
+#endif
+        for (; i < full_words; ++i) {
+            size_t const bit = i * stub_bits;
+            uint64_t const stub = (load_le64(stubs + bit / 8) >> (bit & 7)) & mask;
+            previous += (uint64_t(deltas[i]) << stub_bits) | stub;
+            out[i] = previous;
+        }
+        for (; i < num_values; ++i) {
+            size_t const bit = i * stub_bits;
+            uint64_t const word
+                = load_le64_partial(stubs + bit / 8, stub_bytes.size() - bit / 8);
+            previous += (uint64_t(deltas[i]) << stub_bits) | ((word >> (bit & 7)) & mask);
+            out[i] = previous;
+        }
+    }
 
-        // 1) FSE-decompress deltas
-        out_deltas.resize(num_values);
-        size_t dSize = POS2_FSE_decompress(out_deltas.data(), num_values, fse_data, fse_size);
-        if (POS2_FSE_isError(dSize) || dSize != num_values) {
-            throw std::runtime_error(
-                "ChunkCompressor::decompress: FSE_decompress failed or size mismatch");
+#if CHUNK_COMPRESSOR_AVX2
+    // Fragments [0, 4 * (full_words / 4)) four at a time; returns how many it built and leaves
+    // the last in `previous`.
+    __attribute__((target("avx2"))) static size_t reconstructFragmentsAvx2(
+        uint8_t const* const deltas,
+        uint8_t const* const stubs,
+        int const stub_bits,
+        ProofFragment& previous,
+        ProofFragment* const out,
+        size_t const full_words)
+    {
+        uint64_t const mask = (1ULL << stub_bits) - 1;
+        __m256i const stub_mask = _mm256_set1_epi64x(static_cast<int64_t>(mask));
+        __m128i const delta_shift = _mm_cvtsi32_si128(stub_bits);
+        __m256i const zero = _mm256_setzero_si256();
+        __m256i running = _mm256_set1_epi64x(static_cast<int64_t>(previous));
+        size_t i = 0;
+        for (; i + 4 <= full_words; i += 4) {
+            size_t const b0 = i * stub_bits;
+            size_t const b1 = b0 + stub_bits;
+            size_t const b2 = b1 + stub_bits;
+            size_t const b3 = b2 + stub_bits;
+            __m256i const words = _mm256_set_epi64x(load_le64(stubs + b3 / 8),
+                load_le64(stubs + b2 / 8),
+                load_le64(stubs + b1 / 8),
+                load_le64(stubs + b0 / 8));
+            __m256i const shifts = _mm256_set_epi64x(b3 & 7, b2 & 7, b1 & 7, b0 & 7);
+            __m256i const stub4 = _mm256_and_si256(_mm256_srlv_epi64(words, shifts), stub_mask);
+
+            uint32_t delta4;
+            std::memcpy(&delta4, deltas + i, sizeof(delta4));
+            __m256i const delta_high = _mm256_sll_epi64(
+                _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(int(delta4))), delta_shift);
+            __m256i x = _mm256_or_si256(delta_high, stub4);
+
+            // inclusive prefix sum of the four lanes, then carry in the running total
+            x = _mm256_add_epi64(
+                x, _mm256_blend_epi32(zero, _mm256_permute4x64_epi64(x, 0x90), 0xFC));
+            x = _mm256_add_epi64(
+                x, _mm256_blend_epi32(zero, _mm256_permute4x64_epi64(x, 0x40), 0xF0));
+            x = _mm256_add_epi64(x, running);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+            running = _mm256_permute4x64_epi64(x, 0xFF);
         }
+        previous = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm256_castsi256_si128(running)));
+        return i;
+    }
+#endif
 
-        // 2) Unpack stubs
-        out_stubs.resize(num_values);
-        unpackStubs(stub_bytes, stub_bytes_size, stub_bits, out_stubs);
+    static uint64_t load_le64(uint8_t const* p)
+    {
+        uint64_t v;
+        if constexpr (std::endian::native == std::endian::little) {
+            std::memcpy(&v, p, sizeof(v));
+        }
+        else {
+            v = load_le64_partial(p, 8);
+        }
+        return v;
+    }
+
+    // The up to 8 bytes at p of the `available` left, zero-extended.
+    static uint64_t load_le64_partial(uint8_t const* p, size_t available)
+    {
+        uint64_t v = 0;
+        for (size_t b = 0; b < std::min<size_t>(available, 8); ++b) {
+            v |= static_cast<uint64_t>(p[b]) << (8 * b);
+        }
+        return v;
     }
 
-private:
     // ---- Helpers for (de)serialization ----
 
     static void append_u32(std::vector<uint8_t>& buf, uint32_t v)
@@ -261,6 +646,14 @@ private:
         buf.push_back(static_cast<uint8_t>((v >> 24) & 0xFF));
     }
 
+    static void write_u32(uint8_t* p, uint32_t v)
+    {
+        p[0] = static_cast<uint8_t>(v & 0xFF);
+        p[1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+        p[2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+        p[3] = static_cast<uint8_t>((v >> 24) & 0xFF);
+    }
+
     static uint32_t read_u32(uint8_t const*& p, uint8_t const* end)
     {
         if (p + 4 > end) {
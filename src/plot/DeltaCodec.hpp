@@ -0,0 +1,625 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fse.h"
+#include "huf.h"
+
+// Entropy coder for the one-byte deltas of a chunk block. The codec is chosen per plot and
+// recorded in the plot header; every block of the plot uses it.
+//   Fse:     the vendored FSE (tANS), the best ratio; the default.
+//   Huffman: the vendored Huffman coder, four interleaved streams per 128 KB segment; a little
+//            larger, decodes faster.
+//   Rans:    four interleaved rANS states with 16-bit renormalization (below).
+//   FseShared: FSE with one table for the whole plot, kept in the plot header (SharedFseTable):
+//            blocks carry no table of their own and decoding one builds none.
+enum class DeltaCodec : uint8_t {
+    Fse = 0,
+    Huffman = 1,
+    Rans = 2,
+    FseShared = 3,
+};
+
+inline constexpr DeltaCodec kDeltaCodecs[]
+    = { DeltaCodec::Fse, DeltaCodec::Huffman, DeltaCodec::Rans, DeltaCodec::FseShared };
+
+inline char const* delta_codec_name(DeltaCodec codec)
+{
+    switch (codec) {
+    case DeltaCodec::Fse:
+        return "fse";
+    case DeltaCodec::Huffman:
+        return "huffman";
+    case DeltaCodec::Rans:
+        return "rans";
+    case DeltaCodec::FseShared:
+        return "fse-shared";
+    }
+    return "unknown";
+}
+
+inline std::optional<DeltaCodec> parse_delta_codec(std::string_view name)
+{
+    for (DeltaCodec codec: kDeltaCodecs) {
+        if (name == delta_codec_name(codec))
+            return codec;
+    }
+    return std::nullopt;
+}
+
+inline bool is_valid_delta_codec(uint8_t value)
+{
+    return value <= static_cast<uint8_t>(DeltaCodec::FseShared);
+}
+
+// The FSE table of a FseShared plot. The delta distribution hardly changes from block to block
+// (it depends on k and the stub bits), so one table trained on all of a plot's deltas codes each
+// block about as well as the block's own would, without the block storing it or a reader
+// rebuilding it per block. Immutable once built, so it can be shared by any number of threads.
+class SharedFseTable {
+public:
+    // The largest table FSE builds (FSE_MAX_TABLELOG): 4096 states, a 16 KB decoding table.
+    static constexpr unsigned kMaxTableLog = 12;
+
+    // Trained on a histogram of deltas; nullptr when fewer than two distinct deltas occur, which
+    // FSE has no table for.
+    static std::shared_ptr<SharedFseTable const> train(std::span<uint64_t const, 256> counts)
+    {
+        uint64_t total = 0;
+        for (uint64_t c: counts)
+            total += c;
+        // FSE counts are 32-bit: scale a large plot's histogram down, keeping every delta in it
+        int shift = 0;
+        while ((total >> shift) > UINT32_MAX / 2)
+            ++shift;
+        std::array<unsigned, 256> scaled {};
+        size_t scaled_total = 0;
+        unsigned max_symbol = 0;
+        for (size_t s = 0; s < 256; ++s) {
+            if (counts[s] == 0)
+                continue;
+            scaled[s] = std::max<unsigned>(1, static_cast<unsigned>(counts[s] >> shift));
+            scaled_total += scaled[s];
+            max_symbol = static_cast<unsigned>(s);
+        }
+        if (scaled_total == 0) {
+            return nullptr;
+        }
+
+        std::array<short, 256> normalized {};
+        unsigned const table_log = POS2_FSE_optimalTableLog(kMaxTableLog, scaled_total, max_symbol);
+        size_t const result = POS2_FSE_normalizeCount(
+            normalized.data(), table_log, scaled.data(), scaled_total, max_symbol);
+        if (POS2_FSE_isError(result)) {
+            throw std::runtime_error("SharedFseTable::train: FSE_normalizeCount failed");
+        }
+        if (result == 0) {
+            return nullptr; // a single delta value
+        }
+        return std::shared_ptr<SharedFseTable const>(
+            new SharedFseTable(normalized, max_symbol, table_log));
+    }
+
+    // The table serialized() stored; throws std::runtime_error when the bytes are not one.
+    static std::shared_ptr<SharedFseTable const> deserialize(std::span<uint8_t const> bytes)
+    {
+        std::array<short, 256> normalized {};
+        unsigned max_symbol = 255;
+        unsigned table_log = 0;
+        size_t const size = POS2_FSE_readNCount(
+            normalized.data(), &max_symbol, &table_log, bytes.data(), bytes.size());
+        if (POS2_FSE_isError(size) || size != bytes.size() || table_log > kMaxTableLog) {
+            throw std::runtime_error("SharedFseTable::deserialize: invalid FSE table");
+        }
+        return std::shared_ptr<SharedFseTable const>(
+            new SharedFseTable(normalized, max_symbol, table_log));
+    }
+
+    // The normalized counts in FSE's compact form, as the plot header stores them.
+    std::span<uint8_t const> serialized() const { return serialized_; }
+
+    // Whether `delta` has a code; a table can only encode the deltas it was trained on.
+    bool encodes(uint8_t delta) const { return normalized_[delta] != 0; }
+
+    FSE_CTable const* ctable() const { return ctable_.get(); }
+    FSE_DTable const* dtable() const { return dtable_.get(); }
+
+private:
+    SharedFseTable(
+        std::array<short, 256> const& normalized, unsigned max_symbol, unsigned table_log)
+        : normalized_(normalized)
+        , ctable_(POS2_FSE_createCTable(max_symbol, table_log))
+        , dtable_(POS2_FSE_createDTable(table_log))
+    {
+        if (!ctable_ || !dtable_) {
+            throw std::bad_alloc();
+        }
+        if (POS2_FSE_isError(
+                POS2_FSE_buildCTable(ctable_.get(), normalized_.data(), max_symbol, table_log))
+            || POS2_FSE_isError(
+                POS2_FSE_buildDTable(dtable_.get(), normalized_.data(), max_symbol, table_log))) {
+            throw std::runtime_error("SharedFseTable: invalid FSE table");
+        }
+        serialized_.resize(POS2_FSE_NCountWriteBound(max_symbol, table_log));
+        size_t const size = POS2_FSE_writeNCount(
+            serialized_.data(), serialized_.size(), normalized_.data(), max_symbol, table_log);
+        if (POS2_FSE_isError(size)) {
+            throw std::runtime_error("SharedFseTable: FSE_writeNCount failed");
+        }
+        serialized_.resize(size);
+    }
+
+    struct FreeCTable {
+        void operator()(FSE_CTable* table) const { POS2_FSE_freeCTable(table); }
+    };
+    struct FreeDTable {
+        void operator()(FSE_DTable* table) const { POS2_FSE_freeDTable(table); }
+    };
+
+    std::array<short, 256> normalized_;
+    std::unique_ptr<FSE_CTable, FreeCTable> ctable_;
+    std::unique_ptr<FSE_DTable, FreeDTable> dtable_;
+    std::vector<uint8_t> serialized_;
+};
+
+// How a block's deltas are coded: the plot's codec and, for FseShared, the plot's table (owned
+// by the caller, e.g. the PlotFile, and alive for the call).
+struct DeltaCoding {
+    DeltaCodec codec = DeltaCodec::Fse;
+    SharedFseTable const* fse_table = nullptr;
+
+    DeltaCoding(DeltaCodec const codec = DeltaCodec::Fse,
+        SharedFseTable const* const fse_table = nullptr)
+        : codec(codec)
+        , fse_table(fse_table)
+    {
+    }
+};
+
+class DeltaCoder {
+public:
+    // The encoded deltas, or an empty vector when the codec cannot store them in fewer bytes than
+    // the deltas themselves (the caller then stores them raw).
+    static std::vector<uint8_t> encode(DeltaCoding const& coding, std::span<uint8_t const> deltas)
+    {
+        switch (coding.codec) {
+        case DeltaCodec::Fse:
+            return encodeFse(deltas);
+        case DeltaCodec::Huffman:
+            return encodeHuffman(deltas);
+        case DeltaCodec::Rans:
+            return encodeRans(deltas);
+        case DeltaCodec::FseShared:
+            return encodeFseShared(deltas, sharedTable(coding));
+        }
+        throw std::invalid_argument("DeltaCoder::encode: unknown codec");
+    }
+
+    // Decodes exactly out.size() deltas; throws when `encoded` does not hold that many.
+    static void decode(
+        DeltaCoding const& coding, std::span<uint8_t const> encoded, std::span<uint8_t> out)
+    {
+        switch (coding.codec) {
+        case DeltaCodec::Fse:
+            return decodeFse(encoded, out);
+        case DeltaCodec::Huffman:
+            return decodeHuffman(encoded, out);
+        case DeltaCodec::Rans:
+            return decodeRans(encoded, out);
+        case DeltaCodec::FseShared:
+            return decodeFseShared(encoded, out, sharedTable(coding));
+        }
+        throw std::invalid_argument("DeltaCoder::decode: unknown codec");
+    }
+
+private:
+    // ---- FSE ----
+
+    static std::vector<uint8_t> encodeFse(std::span<uint8_t const> deltas)
+    {
+        std::vector<uint8_t> out(POS2_FSE_compressBound(deltas.size()));
+        size_t const size = POS2_FSE_compress(out.data(), out.size(), deltas.data(), deltas.size());
+        if (POS2_FSE_isError(size)) {
+            throw std::runtime_error("ChunkCompressor::compress: FSE_compress failed");
+        }
+        // 0: not compressible, 1: a single repeated symbol (small blocks)
+        out.resize(size <= 1 ? 0 : size);
+        return out;
+    }
+
+    static void decodeFse(std::span<uint8_t const> encoded, std::span<uint8_t> out)
+    {
+        size_t const size
+            = POS2_FSE_decompress(out.data(), out.size(), encoded.data(), encoded.size());
+        if (POS2_FSE_isError(size) || size != out.size()) {
+            throw std::runtime_error(
+                "ChunkCompressor::decompress: FSE_decompress failed or size mismatch");
+        }
+    }
+
+    // ---- FSE, shared table ----
+    //
+    // Just the FSE bit stream: the table is the plot's. Up to two deltas do not make a stream
+    // (FSE_compress_usingCTable returns 0) and are stored raw.
+
+    static SharedFseTable const& sharedTable(DeltaCoding const& coding)
+    {
+        if (!coding.fse_table) {
+            throw std::invalid_argument("DeltaCoder: fse-shared needs the plot's FSE table");
+        }
+        return *coding.fse_table;
+    }
+
+    static std::vector<uint8_t> encodeFseShared(
+        std::span<uint8_t const> deltas, SharedFseTable const& table)
+    {
+        for (uint8_t d: deltas) {
+            if (!table.encodes(d)) {
+                throw std::invalid_argument(
+                    "ChunkCompressor::compress: delta not in the shared FSE table");
+            }
+        }
+        // FSE_compressBound assumes the table fits the data; a plot's table may not fit a block,
+        // and a delta costs at most table_log <= 12 bits (the bit stream is written unchecked)
+        std::vector<uint8_t> out(deltas.size() * 2 + 16);
+        size_t const size = POS2_FSE_compress_usingCTable(
+            out.data(), out.size(), deltas.data(), deltas.size(), table.ctable());
+        if (POS2_FSE_isError(size)) {
+            throw std::runtime_error("ChunkCompressor::compress: FSE_compress_usingCTable failed");
+        }
+        out.resize(size >= deltas.size() ? 0 : size);
+        return out;
+    }
+
+    static void decodeFseShared(
+        std::span<uint8_t const> encoded, std::span<uint8_t> out, SharedFseTable const& table)
+    {
+        size_t const size = POS2_FSE_decompress_usingDTable(
+            out.data(), out.size(), encoded.data(), encoded.size(), table.dtable());
+        if (POS2_FSE_isError(size) || size != out.size()) {
+            throw std::runtime_error("ChunkCompressor::decompress: FSE_decompress_usingDTable "
+                                     "failed or size mismatch");
+        }
+    }
+
+    // ---- Huffman ----
+    //
+    // The deltas are cut into HUF_BLOCKSIZE_MAX segments, each compressed on its own. Every
+    // segment but the last is preceded by its u32 encoded size; a segment stored as its own
+    // bytes (encoded size == segment size) or as one byte (a single repeated symbol) is
+    // understood by POS2_HUF_decompress as it is.
+
+    static std::vector<uint8_t> encodeHuffman(std::span<uint8_t const> deltas)
+    {
+        std::vector<uint8_t> out;
+        std::vector<uint8_t> segment(POS2_HUF_compressBound(HUF_BLOCKSIZE_MAX));
+        for (size_t begin = 0; begin < deltas.size(); begin += HUF_BLOCKSIZE_MAX) {
+            size_t const length = std::min<size_t>(HUF_BLOCKSIZE_MAX, deltas.size() - begin);
+            size_t size = POS2_HUF_compress(
+                segment.data(), segment.size(), deltas.data() + begin, length);
+            if (POS2_HUF_isError(size)) {
+                throw std::runtime_error("ChunkCompressor::compress: HUF_compress failed");
+            }
+            if (size == 0 || size >= length) {
+                std::memcpy(segment.data(), deltas.data() + begin, length);
+                size = length;
+            }
+            if (begin + length < deltas.size()) {
+                append_u32(out, static_cast<uint32_t>(size));
+            }
+            out.insert(out.end(), segment.begin(), segment.begin() + size);
+        }
+        if (out.size() >= deltas.size()) {
+            out.clear();
+        }
+        return out;
+    }
+
+    static void decodeHuffman(std::span<uint8_t const> encoded, std::span<uint8_t> out)
+    {
+        uint8_t const* p = encoded.data();
+        uint8_t const* const end = encoded.data() + encoded.size();
+        for (size_t begin = 0; begin < out.size(); begin += HUF_BLOCKSIZE_MAX) {
+            size_t const length = std::min<size_t>(HUF_BLOCKSIZE_MAX, out.size() - begin);
+            size_t size = static_cast<size_t>(end - p);
+            if (begin + length < out.size()) {
+                size = read_u32(p, end);
+                if (size > static_cast<size_t>(end - p)) {
+                    throw std::runtime_error("ChunkCompressor::decompress: chunk truncated");
+                }
+            }
+            size_t const decoded = POS2_HUF_decompress(out.data() + begin, length, p, size);
+            if (POS2_HUF_isError(decoded) || decoded != length) {
+                throw std::runtime_error(
+                    "ChunkCompressor::decompress: HUF_decompress failed or size mismatch");
+            }
+            p += size;
+        }
+    }
+
+    // ---- rANS ----
+    //
+    // rANS with 32-bit states renormalized 16 bits at a time (L = 2^16), so a delta reads at most
+    // one word and the decoder's renormalization is branch-free. Four states are interleaved to
+    // give the decoder four independent dependency chains: delta i is coded with state i % 4, and
+    // the states share one word stream. Layout:
+    //   u8  scale_bits                      frequencies sum to 2^scale_bits
+    //   u8  max_symbol
+    //   varint freq[max_symbol + 1]
+    //   u32 state[4]                        final encoder states, read first by the decoder
+    //   u16 renormalization words
+    // Decoding the last delta brings every state back to L, which the decoder checks.
+
+    static constexpr uint32_t kRansL = 1u << 16;
+    static constexpr int kRansStates = 4;
+
+    struct RansTable {
+        int scale_bits = 0;
+        std::array<uint32_t, 256> freq {};
+        std::array<uint32_t, 256> start {};
+    };
+
+    // Frequencies scaled to sum to 2^scale_bits, every symbol that occurs keeping at least 1.
+    static RansTable normalizeRans(std::span<uint8_t const> deltas)
+    {
+        std::array<uint64_t, 256> counts {};
+        for (uint8_t d: deltas)
+            ++counts[d];
+        size_t const distinct
+            = static_cast<size_t>(std::count_if(counts.begin(), counts.end(), [](uint64_t c) {
+                  return c != 0;
+              }));
+
+        RansTable table;
+        // about one slot per two deltas: larger tables cost more to build than they save
+        table.scale_bits = std::clamp(static_cast<int>(std::bit_width(deltas.size())) - 1, 9, 12);
+        while ((size_t(1) << table.scale_bits) < distinct)
+            ++table.scale_bits;
+        uint32_t const total = 1u << table.scale_bits;
+
+        uint32_t sum = 0;
+        for (size_t s = 0; s < 256; ++s) {
+            if (counts[s] == 0)
+                continue;
+            table.freq[s] = std::max<uint32_t>(
+                1, static_cast<uint32_t>(counts[s] * total / deltas.size()));
+            sum += table.freq[s];
+        }
+        // settle the rounding on the most frequent symbols, where it costs the least
+        while (sum != total) {
+            size_t best = 0;
+            for (size_t s = 1; s < 256; ++s) {
+                if (table.freq[s] > table.freq[best])
+                    best = s;
+            }
+            if (sum < total) {
+                uint32_t const add = total - sum;
+                table.freq[best] += add;
+                sum += add;
+            }
+            else {
+                uint32_t const take = std::min(sum - total, table.freq[best] - 1);
+                table.freq[best] -= take;
+                sum -= take;
+                if (take == 0) {
+                    // only ones left; cannot happen with 2^scale_bits >= distinct
+                    throw std::logic_error("DeltaCoder: rANS frequencies do not fit the scale");
+                }
+            }
+        }
+        uint32_t cumulative = 0;
+        for (size_t s = 0; s < 256; ++s) {
+            table.start[s] = cumulative;
+            cumulative += table.freq[s];
+        }
+        return table;
+    }
+
+    static std::vector<uint8_t> encodeRans(std::span<uint8_t const> deltas)
+    {
+        if (deltas.empty()) {
+            return {};
+        }
+        RansTable const table = normalizeRans(deltas);
+
+        // the stream is written back to front, at most one word per delta
+        std::vector<uint8_t> stream(deltas.size() * 2 + 4 * kRansStates);
+        uint8_t* p = stream.data() + stream.size();
+        std::array<uint32_t, kRansStates> states;
+        states.fill(kRansL);
+        for (size_t i = deltas.size(); i-- > 0;) {
+            uint32_t& x = states[i % kRansStates];
+            uint32_t const freq = table.freq[deltas[i]];
+            uint64_t const x_max = (uint64_t(kRansL >> table.scale_bits) << 16) * freq;
+            if (x >= x_max) {
+                p -= 2;
+                write_u16(p, static_cast<uint16_t>(x & 0xFFFF));
+                x >>= 16;
+            }
+            x = ((x / freq) << table.scale_bits) + (x % freq) + table.start[deltas[i]];
+        }
+        for (int s = kRansStates; s-- > 0;) {
+            p -= 4;
+            write_u32(p, states[s]);
+        }
+
+        std::vector<uint8_t> out;
+        out.push_back(static_cast<uint8_t>(table.scale_bits));
+        size_t max_symbol = 255;
+        while (table.freq[max_symbol] == 0)
+            --max_symbol;
+        out.push_back(static_cast<uint8_t>(max_symbol));
+        for (size_t s = 0; s <= max_symbol; ++s) {
+            for (uint32_t v = table.freq[s];; v >>= 7) {
+                out.push_back(static_cast<uint8_t>((v & 0x7F) | (v >= 0x80 ? 0x80 : 0)));
+                if (v < 0x80)
+                    break;
+            }
+        }
+        size_t const stream_size = static_cast<size_t>(stream.data() + stream.size() - p);
+        if (out.size() + stream_size >= deltas.size()) {
+            return {};
+        }
+        out.insert(out.end(), p, p + stream_size);
+        return out;
+    }
+
+    static void decodeRans(std::span<uint8_t const> encoded, std::span<uint8_t> out)
+    {
+        uint8_t const* p = encoded.data();
+        uint8_t const* const end = encoded.data() + encoded.size();
+        auto const corrupt = []() {
+            return std::runtime_error("ChunkCompressor::decompress: rANS data corrupt");
+        };
+
+        if (end - p < 2) {
+            throw corrupt();
+        }
+        int const scale_bits = *p++;
+        size_t const max_symbol = *p++;
+        if (scale_bits < 1 || scale_bits > 12) {
+            throw corrupt();
+        }
+        uint32_t const mask = (1u << scale_bits) - 1;
+
+        // per slot, packed so a step is one lookup: the symbol (bits 24..31), the slot minus the
+        // symbol's start (12..23) and the frequency minus 1 (0..11)
+        std::array<uint32_t, 1u << 12> slots;
+        uint32_t cumulative = 0;
+        for (size_t s = 0; s <= max_symbol; ++s) {
+            uint32_t v = 0;
+            for (int shift = 0;; shift += 7) {
+                if (p == end || shift > 14) {
+                    throw corrupt();
+                }
+                uint8_t const byte = *p++;
+                v |= uint32_t(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    break;
+            }
+            if (v > mask + 1 - cumulative) {
+                throw corrupt();
+            }
+            for (uint32_t slot = cumulative; slot < cumulative + v; ++slot) {
+                slots[slot] = (uint32_t(s) << 24) | ((slot - cumulative) << 12) | (v - 1);
+            }
+            cumulative += v;
+        }
+        if (cumulative != mask + 1) {
+            throw corrupt();
+        }
+
+        std::array<uint32_t, kRansStates> states;
+        for (uint32_t& x: states) {
+            x = read_u32(p, end);
+        }
+
+        // x -> the state before the delta at x's slot was coded
+        uint32_t const* const table = slots.data();
+        auto const advance = [table, mask, scale_bits](uint32_t x, uint8_t& symbol) {
+            uint32_t const slot = table[x & mask];
+            symbol = static_cast<uint8_t>(slot >> 24);
+            return ((slot & 0xFFF) + 1) * (x >> scale_bits) + ((slot >> 12) & 0xFFF);
+        };
+
+        // While a whole group's words (at most one per delta) are there, refill without a branch:
+        // the four states step first, then each takes its word at an offset counted from the
+        // states before it, so only the offsets are serial. The states and the read position stay
+        // in locals and a group's deltas are stored at once, since a byte store could alias them.
+        size_t i = 0;
+        size_t const n = out.size();
+        uint8_t const* q = p;
+        uint32_t x0 = states[0], x1 = states[1], x2 = states[2], x3 = states[3];
+        for (; i + kRansStates <= n && end - q >= 2 * kRansStates; i += kRansStates) {
+            uint8_t group[kRansStates];
+            x0 = advance(x0, group[0]);
+            x1 = advance(x1, group[1]);
+            x2 = advance(x2, group[2]);
+            x3 = advance(x3, group[3]);
+            std::memcpy(out.data() + i, group, kRansStates);
+            uint32_t const low0 = x0 < kRansL, low1 = x1 < kRansL, low2 = x2 < kRansL,
+                           low3 = x3 < kRansL;
+            uint32_t const o1 = 2 * low0, o2 = o1 + 2 * low1, o3 = o2 + 2 * low2;
+            uint32_t const w0 = read_u16(q), w1 = read_u16(q + o1), w2 = read_u16(q + o2),
+                           w3 = read_u16(q + o3);
+            x0 = low0 ? (x0 << 16) | w0 : x0;
+            x1 = low1 ? (x1 << 16) | w1 : x1;
+            x2 = low2 ? (x2 << 16) | w2 : x2;
+            x3 = low3 ? (x3 << 16) | w3 : x3;
+            q += o3 + 2 * low3;
+        }
+        states = { x0, x1, x2, x3 };
+        p = q;
+        for (; i < n; ++i) {
+            uint32_t& x = states[i % kRansStates];
+            x = advance(x, out[i]);
+            if (x < kRansL) {
+                if (end - p < 2) {
+                    throw corrupt();
+                }
+                x = (x << 16) | read_u16(p);
+                p += 2;
+            }
+        }
+        for (uint32_t x: states) {
+            if (x != kRansL) {
+                throw corrupt();
+            }
+        }
+        if (p != end) {
+            throw corrupt();
+        }
+    }
+
+    // ---- Helpers ----
+
+    static void append_u32(std::vector<uint8_t>& buf, uint32_t v)
+    {
+        uint8_t bytes[4];
+        write_u32(bytes, v);
+        buf.insert(buf.end(), bytes, bytes + 4);
+    }
+
+    static void write_u16(uint8_t* p, uint16_t v)
+    {
+        p[0] = static_cast<uint8_t>(v & 0xFF);
+        p[1] = static_cast<uint8_t>(v >> 8);
+    }
+
+    static uint16_t read_u16(uint8_t const* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    static void write_u32(uint8_t* p, uint32_t v)
+    {
+        p[0] = static_cast<uint8_t>(v & 0xFF);
+        p[1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+        p[2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+        p[3] = static_cast<uint8_t>((v >> 24) & 0xFF);
+    }
+
+    static uint32_t read_u32(uint8_t const*& p, uint8_t const* end)
+    {
+        if (end - p < 4) {
+            throw std::runtime_error("ChunkCompressor::decompress: chunk truncated");
+        }
+        uint32_t const v = uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16)
+            | (uint32_t(p[3]) << 24);
+        p += 4;
+        return v;
+    }
+};
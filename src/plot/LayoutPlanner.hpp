@@ -1,13 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <bit> // std::has_single_bit
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <memory_resource>
+#include <numeric>
 #include <span>
 #include <thread> // added
+#include <vector>
 
 // =====================================================================================
 // Minimal monotonic arena (PMR) used for scratch within a region of the main buffer.
@@ -66,6 +69,11 @@ public:
     // Peak value of used_bytes() ever observed for this arena object (across reset()/rebind()).
     std::size_t lifetime_high_watermark_bytes() const noexcept { return lifetime_high_watermark_; }
 
+    // Peak value of used_bytes() since the last reset_phase_peak(), across reset()/rebind().
+    // Plotting phases reset it when they take the arena, for per-table reporting.
+    std::size_t phase_high_watermark_bytes() const noexcept { return phase_high_watermark_; }
+    void reset_phase_peak() noexcept { phase_high_watermark_ = off_; }
+
 private:
     struct DetailedBadAlloc final : std::bad_alloc {
         enum class Reason : std::uint8_t {
@@ -144,6 +152,9 @@ private:
         if (off_ > lifetime_high_watermark_) {
             lifetime_high_watermark_ = off_;
         }
+        if (off_ > phase_high_watermark_) {
+            phase_high_watermark_ = off_;
+        }
         assert(off_ <= cap_);
         return base_ + aligned;
     }
@@ -168,6 +179,9 @@ private:
     // Tracks the maximum bump offset observed over the lifetime of this arena object.
     std::size_t lifetime_high_watermark_ = 0;
 
+    // Tracks the maximum bump offset since the last reset_phase_peak().
+    std::size_t phase_high_watermark_ = 0;
+
 #ifndef NDEBUG
     std::thread::id owner_ {};
     bool has_owner_ = false;
@@ -303,3 +317,124 @@ private:
     std::byte* base_ = nullptr;
     std::size_t size_ = 0;
 };
+
+// =====================================================================================
+// LivenessLayoutSolver
+//
+// Offline placement of buffers with known lifetimes inside one contiguous buffer. Buffers whose
+// lifetimes (inclusive step ranges) intersect never share bytes; all others may reuse the same
+// region. Placement is greedy by size: largest buffer first, each at the lowest aligned offset
+// that does not collide with an already placed, simultaneously live buffer.
+// =====================================================================================
+class LivenessLayoutSolver {
+public:
+    struct Buffer {
+        char const* name = "";
+        std::size_t bytes = 0;
+        int first_step = 0;
+        int last_step = 0;
+        std::size_t offset = 0;
+
+        bool live_with(Buffer const& other) const noexcept
+        {
+            return first_step <= other.last_step && other.first_step <= last_step;
+        }
+        std::size_t end() const noexcept { return offset + bytes; }
+    };
+
+    explicit LivenessLayoutSolver(std::size_t align = 64) : align_(align)
+    {
+        assert(std::has_single_bit(align));
+    }
+
+    // Returns the buffer id.
+    std::size_t add(char const* name, std::size_t bytes, int first_step, int last_step)
+    {
+        assert(first_step <= last_step);
+        buffers_.push_back(Buffer { name, align_up(bytes), first_step, last_step, 0 });
+        return buffers_.size() - 1;
+    }
+
+    // Assigns offsets and returns the total bytes required.
+    std::size_t solve()
+    {
+        std::vector<std::size_t> order(buffers_.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+            return buffers_[a].bytes > buffers_[b].bytes;
+        });
+
+        std::vector<std::size_t> placed;
+        placed.reserve(buffers_.size());
+        total_bytes_ = 0;
+        for (std::size_t id: order) {
+            Buffer& b = buffers_[id];
+
+            // Collisions sorted by offset; walk them to find the first gap that fits.
+            std::vector<Buffer const*> live;
+            for (std::size_t other: placed) {
+                if (buffers_[other].live_with(b))
+                    live.push_back(&buffers_[other]);
+            }
+            std::sort(live.begin(), live.end(),
+                [](Buffer const* x, Buffer const* y) { return x->offset < y->offset; });
+
+            std::size_t offset = 0;
+            for (Buffer const* o: live) {
+                if (offset + b.bytes <= o->offset)
+                    break;
+                offset = std::max(offset, o->end());
+            }
+            b.offset = offset;
+            total_bytes_ = std::max(total_bytes_, b.end());
+            placed.push_back(id);
+        }
+        return total_bytes_;
+    }
+
+    // Largest sum of simultaneously live bytes: no placement can be smaller than this.
+    std::size_t lower_bound_bytes() const
+    {
+        std::size_t best = 0;
+        for (Buffer const& b: buffers_) {
+            for (int step = b.first_step; step <= b.last_step; ++step)
+                best = std::max(best, live_bytes_at(step));
+        }
+        return best;
+    }
+
+    std::size_t live_bytes_at(int step) const
+    {
+        std::size_t sum = 0;
+        for (Buffer const& b: buffers_) {
+            if (b.first_step <= step && step <= b.last_step)
+                sum += b.bytes;
+        }
+        return sum;
+    }
+
+    // True if no two simultaneously live buffers share bytes.
+    bool valid() const
+    {
+        for (std::size_t i = 0; i < buffers_.size(); ++i) {
+            for (std::size_t j = i + 1; j < buffers_.size(); ++j) {
+                Buffer const& a = buffers_[i];
+                Buffer const& b = buffers_[j];
+                if (a.live_with(b) && a.offset < b.end() && b.offset < a.end())
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    Buffer const& buffer(std::size_t id) const { return buffers_[id]; }
+    std::span<Buffer const> buffers() const { return buffers_; }
+    std::size_t total_bytes() const noexcept { return total_bytes_; }
+
+private:
+    std::size_t align_up(std::size_t x) const { return (x + (align_ - 1)) & ~(align_ - 1); }
+
+    std::size_t align_;
+    std::vector<Buffer> buffers_;
+    std::size_t total_bytes_ = 0;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POS2_HAVE_MMAP 1
+#else
+#define POS2_HAVE_MMAP 0
+#endif
+
+// Read-only memory mapping of a whole file, for reading plot chunks in place.
+//
+// The mapping is advised MADV_RANDOM up front: harvesting reads a few scattered chunks per
+// challenge, and the kernel's default readahead around each fault would read data nobody asked
+// for. will_need() then requests the pages of a byte range that is about to be read in one go,
+// instead of one fault (and one small read) per page.
+//
+// A read from the mapping cannot report an error: an I/O error on a page, or the file shrinking
+// under the mapping, raises SIGBUS. range() checks only against the size at construction.
+//
+// Where mmap is not available, `supported` is false and construction throws; callers keep a
+// stream-based path for that case.
+class MappedFile {
+public:
+    static constexpr bool supported = POS2_HAVE_MMAP != 0;
+
+    explicit MappedFile(std::string const& path)
+    {
+#if POS2_HAVE_MMAP
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("Failed to open " + path);
+        try {
+            map_(fd, path);
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+        // the mapping keeps the file referenced
+        ::close(fd);
+#else
+        throw std::runtime_error("Memory-mapped files are not supported here: " + path);
+#endif
+    }
+
+    // Maps the file open as `fd`, which the caller keeps; `path` is for error messages.
+    MappedFile(int fd, std::string const& path)
+    {
+#if POS2_HAVE_MMAP
+        map_(fd, path);
+#else
+        (void)fd;
+        throw std::runtime_error("Memory-mapped files are not supported here: " + path);
+#endif
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            unmap_();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile() { unmap_(); }
+
+    std::size_t size() const noexcept { return size_; }
+
+    std::span<uint8_t const> bytes() const noexcept { return { data_, size_ }; }
+
+    // The bytes [offset, offset + length); throws when they are not all in the file.
+    std::span<uint8_t const> range(uint64_t offset, uint64_t length) const
+    {
+        if (offset > size_ || length > size_ - offset)
+            throw std::out_of_range("MappedFile: range [" + std::to_string(offset) + ", +"
+                + std::to_string(length) + ") is past the end of the file");
+        return { data_ + offset, static_cast<std::size_t>(length) };
+    }
+
+    // Asks the kernel to read [offset, offset + length) ahead of use. Only a hint.
+    void will_need(uint64_t offset, uint64_t length) const noexcept
+    {
+#if POS2_HAVE_MMAP
+        if (data_ == nullptr || offset >= size_)
+            return;
+        length = std::min<uint64_t>(length, size_ - offset);
+        uint64_t const page = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        uint64_t const begin = offset / page * page;
+        ::madvise(const_cast<uint8_t*>(data_) + begin,
+            static_cast<std::size_t>(offset + length - begin), MADV_WILLNEED);
+#else
+        (void)offset;
+        (void)length;
+#endif
+    }
+
+private:
+    void map_([[maybe_unused]] int fd, [[maybe_unused]] std::string const& path)
+    {
+#if POS2_HAVE_MMAP
+        struct stat st {};
+        if (::fstat(fd, &st) != 0)
+            throw std::runtime_error("Failed to stat " + path);
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ != 0) {
+            void* const p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                size_ = 0;
+                throw std::runtime_error("Failed to map " + path);
+            }
+            data_ = static_cast<uint8_t const*>(p);
+            ::madvise(p, size_, MADV_RANDOM);
+        }
+#endif
+    }
+
+    void unmap_() noexcept
+    {
+#if POS2_HAVE_MMAP
+        if (data_ != nullptr)
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    uint8_t const* data_ = nullptr;
+    std::size_t size_ = 0;
+};
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio> // std::remove
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "pos/ProofParams.hpp"
+
+// Stage after which a checkpoint was taken. The numeric value is the table id, so a checkpoint
+// for stage N holds the sorted output of table N (Xs being table 0).
+enum class CheckpointStage : uint8_t {
+    Xs = 0,
+    T1 = 1,
+    T2 = 2,
+    T3 = 3,
+};
+
+// Stream a completed table span to disk so a long plotting run can pick up from the last
+// finished table instead of starting over.
+//
+// On-disk layout (little-endian, native):
+//   "p2ck"                magic
+//   uint8_t  version
+//   uint8_t  stage        CheckpointStage
+//   uint8_t  plot_id[32]
+//   uint8_t  k
+//   uint8_t  strength
+//   uint8_t  testnet
+//   uint8_t  reserved     (0)
+//   uint32_t element_bytes
+//   uint64_t count
+//   count * element_bytes raw elements
+//
+// Files are written to "<path>.tmp", synced, renamed on success and the rename synced, so a crash
+// (even of the host) never leaves a truncated or unwritten checkpoint behind under the final name.
+class PlotCheckpoint {
+public:
+    static constexpr uint8_t FORMAT_VERSION = 1;
+
+    struct Header {
+        CheckpointStage stage;
+        uint8_t plot_id[32];
+        uint8_t k;
+        uint8_t strength;
+        uint8_t testnet;
+        uint32_t element_bytes;
+        uint64_t count;
+
+        ProofParams params() const { return ProofParams(plot_id, k, strength, testnet); }
+    };
+
+    // Canonical checkpoint file name for a given plot and stage inside `dir`.
+    static std::string path_for(
+        std::string const& dir, ProofParams const& params, CheckpointStage stage)
+    {
+        static char const* const hex = "0123456789abcdef";
+        std::string id;
+        id.reserve(64);
+        for (uint8_t b: params.get_plot_id()) {
+            id.push_back(hex[b >> 4]);
+            id.push_back(hex[b & 0xF]);
+        }
+        std::string name = "checkpoint_k" + std::to_string(params.get_k()) + "_"
+            + std::to_string(params.get_strength()) + (params.is_testnet() ? "_testnet_" : "_")
+            + id + "_t" + std::to_string(static_cast<int>(stage)) + ".bin";
+        return (std::filesystem::path(dir) / name).string();
+    }
+
+    // Most advanced checkpoint present in `dir` for this plot, if any.
+    static std::optional<std::string> find_latest(std::string const& dir, ProofParams const& params)
+    {
+        for (int s = static_cast<int>(CheckpointStage::T3); s >= 0; --s) {
+            std::string path = path_for(dir, params, static_cast<CheckpointStage>(s));
+            std::error_code ec;
+            if (std::filesystem::is_regular_file(path, ec))
+                return path;
+        }
+        return std::nullopt;
+    }
+
+    // Incremental writer: the table is appended in pieces (e.g. one per output pass) and the
+    // element count is patched into the header by finish().
+    template <typename T>
+    class Writer {
+    public:
+        static_assert(
+            std::is_trivially_copyable_v<T>, "checkpoint requires trivially copyable type");
+
+        Writer(std::string path, ProofParams const& params, CheckpointStage stage)
+            : path_(std::move(path))
+            , tmp_path_(path_ + ".tmp")
+            , out_(tmp_path_, std::ios::binary | std::ios::trunc)
+        {
+            if (!out_)
+                throw std::runtime_error("Failed to open " + tmp_path_);
+
+            out_.write("p2ck", 4);
+            out_.write(reinterpret_cast<char const*>(&FORMAT_VERSION), 1);
+
+            uint8_t const stage_byte = static_cast<uint8_t>(stage);
+            out_.write(reinterpret_cast<char const*>(&stage_byte), 1);
+            out_.write(reinterpret_cast<char const*>(params.get_plot_id_bytes()), 32);
+
+            uint8_t const fields[4] = { numeric_cast<uint8_t>(params.get_k()),
+                params.get_strength(), static_cast<uint8_t>(params.is_testnet() ? 1 : 0), 0 };
+            out_.write(reinterpret_cast<char const*>(fields), sizeof(fields));
+
+            uint32_t const element_bytes = static_cast<uint32_t>(sizeof(T));
+            out_.write(reinterpret_cast<char const*>(&element_bytes), sizeof(element_bytes));
+            count_pos_ = out_.tellp();
+            out_.write(reinterpret_cast<char const*>(&count_), sizeof(count_));
+            if (!out_)
+                throw std::runtime_error("Failed to write checkpoint " + tmp_path_);
+        }
+
+        Writer(Writer const&) = delete;
+        Writer& operator=(Writer const&) = delete;
+
+        ~Writer()
+        {
+            if (!finished_) {
+                out_.close();
+                std::remove(tmp_path_.c_str());
+            }
+        }
+
+        void append(std::span<T const> data)
+        {
+            if (data.empty())
+                return;
+            out_.write(reinterpret_cast<char const*>(data.data()),
+                static_cast<std::streamsize>(data.size_bytes()));
+            if (!out_)
+                throw std::runtime_error("Failed to write checkpoint " + tmp_path_);
+            count_ += data.size();
+        }
+
+        // Returns bytes written. `durable` syncs the data and the rename to disk, as a checkpoint a
+        // later run may resume from needs; a spill read back by the same run can skip it.
+        size_t finish(bool durable = true)
+        {
+            out_.seekp(count_pos_);
+            out_.write(reinterpret_cast<char const*>(&count_), sizeof(count_));
+            out_.flush();
+            if (!out_)
+                throw std::runtime_error("Failed to write checkpoint " + tmp_path_);
+            out_.close();
+            // the data must be on disk before the name is, or a host crash can leave a renamed
+            // checkpoint of zeros that resume would accept
+            if (durable)
+                sync_(tmp_path_, false);
+
+            std::error_code ec;
+            std::filesystem::rename(tmp_path_, path_, ec);
+            if (ec)
+                throw std::runtime_error(
+                    "Failed to finalize checkpoint " + path_ + ": " + ec.message());
+            finished_ = true;
+            if (durable) {
+                std::filesystem::path const dir = std::filesystem::path(path_).parent_path();
+                sync_(dir.empty() ? std::string(".") : dir.string(), true);
+            }
+            return header_bytes() + count_ * sizeof(T);
+        }
+
+        uint64_t count() const { return count_; }
+
+    private:
+        std::string path_;
+        std::string tmp_path_;
+        std::ofstream out_;
+        std::streampos count_pos_ {};
+        uint64_t count_ = 0;
+        bool finished_ = false;
+    };
+
+    // Returns bytes written.
+    template <typename T>
+    static size_t write(std::string const& path,
+        ProofParams const& params,
+        CheckpointStage stage,
+        std::span<T const> data)
+    {
+        Writer<T> writer(path, params, stage);
+        writer.append(data);
+        return writer.finish();
+    }
+
+    static Header read_header(std::string const& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("Failed to open " + path);
+        return read_header(in, path);
+    }
+
+    // Incremental reader, the counterpart of Writer: validates the header against `params`, the
+    // expected stage and the element type, then hands out the elements in pieces.
+    template <typename T>
+    class Reader {
+    public:
+        static_assert(
+            std::is_trivially_copyable_v<T>, "checkpoint requires trivially copyable type");
+
+        Reader(std::string path, ProofParams const& params, CheckpointStage stage)
+            : path_(std::move(path))
+            , in_(path_, std::ios::binary)
+        {
+            if (!in_)
+                throw std::runtime_error("Failed to open " + path_);
+
+            Header const h = read_header(in_, path_);
+            validate(h, params);
+            if (h.stage != stage)
+                throw std::runtime_error("Checkpoint " + path_ + " holds table "
+                    + std::to_string(static_cast<int>(h.stage)) + ", expected table "
+                    + std::to_string(static_cast<int>(stage)));
+            if (h.element_bytes != sizeof(T))
+                throw std::runtime_error("Checkpoint " + path_ + " element size "
+                    + std::to_string(h.element_bytes) + " does not match this build ("
+                    + std::to_string(sizeof(T)) + ")");
+            count_ = h.count;
+        }
+
+        uint64_t count() const { return count_; }
+
+        // Fills a prefix of `dest` with the next elements; returns it (empty at the end).
+        std::span<T> read(std::span<T> dest)
+        {
+            uint64_t const left = count_ - read_;
+            auto out = dest.first(static_cast<size_t>(std::min<uint64_t>(dest.size(), left)));
+            if (!out.empty()) {
+                in_.read(reinterpret_cast<char*>(out.data()),
+                    static_cast<std::streamsize>(out.size_bytes()));
+            }
+            if (!in_)
+                throw std::runtime_error("Checkpoint " + path_ + " is truncated");
+            read_ += out.size();
+            return out;
+        }
+
+    private:
+        std::string path_;
+        std::ifstream in_;
+        uint64_t count_ = 0;
+        uint64_t read_ = 0;
+    };
+
+    // Read the element payload into `dest` after validating the header against `params`, the
+    // expected stage and the element type. Returns the filled prefix of `dest`.
+    template <typename T>
+    static std::span<T> read(std::string const& path,
+        ProofParams const& params,
+        CheckpointStage stage,
+        std::span<T> dest)
+    {
+        Reader<T> reader(path, params, stage);
+        if (reader.count() > dest.size())
+            throw std::runtime_error("Checkpoint " + path + " holds "
+                + std::to_string(reader.count()) + " entries, more than the "
+                + std::to_string(dest.size()) + " available");
+        return reader.read(dest);
+    }
+
+    // Throws if the checkpoint was produced for a different plot.
+    static void validate(Header const& h, ProofParams const& params)
+    {
+        bool const matches = std::memcmp(h.plot_id, params.get_plot_id_bytes(), 32) == 0
+            && h.k == params.get_k() && h.strength == params.get_strength()
+            && (h.testnet != 0) == params.is_testnet();
+        if (!matches)
+            throw std::runtime_error("Checkpoint does not match plot parameters (plot id, k, "
+                                     "strength or testnet differ)");
+    }
+
+private:
+    // Flushes a file, or a directory's entries, to disk. A no-op where there is no fsync.
+    static void sync_(std::string const& path, bool directory)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        int const fd = ::open(path.c_str(), (directory ? O_DIRECTORY : 0) | O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("Failed to open " + path + " to sync it");
+        int const result = ::fsync(fd);
+        ::close(fd);
+        if (result != 0)
+            throw std::runtime_error("Failed to sync " + path);
+#else
+        (void)path;
+        (void)directory;
+#endif
+    }
+
+    static constexpr size_t header_bytes() { return 4 + 1 + 1 + 32 + 4 + 4 + 8; }
+
+    static Header read_header(std::ifstream& in, std::string const& path)
+    {
+        char magic[4] = {};
+        in.read(magic, sizeof(magic));
+        if (!in || std::memcmp(magic, "p2ck", 4) != 0)
+            throw std::runtime_error(path + " is not a plot checkpoint");
+
+        uint8_t version = 0;
+        in.read(reinterpret_cast<char*>(&version), sizeof(version));
+        if (version != FORMAT_VERSION)
+            throw std::runtime_error(
+                "Checkpoint format version " + std::to_string(version) + " is not supported.");
+
+        Header h {};
+        uint8_t stage_byte = 0;
+        in.read(reinterpret_cast<char*>(&stage_byte), 1);
+        if (stage_byte > static_cast<uint8_t>(CheckpointStage::T3))
+            throw std::runtime_error("Checkpoint " + path + " has invalid stage");
+        h.stage = static_cast<CheckpointStage>(stage_byte);
+
+        in.read(reinterpret_cast<char*>(h.plot_id), 32);
+        uint8_t fields[4] = {};
+        in.read(reinterpret_cast<char*>(fields), sizeof(fields));
+        h.k = fields[0];
+        h.strength = fields[1];
+        h.testnet = fields[2];
+        in.read(reinterpret_cast<char*>(&h.element_bytes), sizeof(h.element_bytes));
+        in.read(reinterpret_cast<char*>(&h.count), sizeof(h.count));
+        if (!in)
+            throw std::runtime_error("Checkpoint " + path + " header is truncated");
+        return h;
+    }
+};
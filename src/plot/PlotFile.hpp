@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <fstream>
+#include <memory>
+#include <numeric>
 #include <optional>
 #include <span>
 #include <stdexcept>
@@ -11,9 +16,13 @@
 #include <utility>
 #include <vector>
 
+#include "ChunkCache.hpp"
 #include "ChunkCompressor.hpp"
+#include "common/ParallelForRange.hpp"
+#include "MappedFile.hpp"
 #include "PlotData.hpp"
 #include "PlotIO.hpp"
+#include "PositionalFile.hpp"
 #include "pos/ProofParams.hpp"
 
 class PlotFile {
@@ -22,16 +31,44 @@ public:
     static constexpr int MINUS_STUB_BITS
         = 2; // proof fragments get k stub bits minus this many extra bits
 
+    // Version 2 chunks carry a seek table: each chunk is split into blocks of
+    // 2^(k + SEEK_BLOCK_RANGE_BITS) fragment range (16 chaining sets), compressed separately, so a
+    // chaining-set lookup decodes one block instead of the whole chunk. Smaller blocks cost plot
+    // size (per-block FSE tables): at k18, 2^(k+10) blocks add about 1.2%, one set per block 15%.
+    static constexpr int SEEK_BLOCK_RANGE_BITS = 10;
+
+    // Whole-plot scans (forEachChunk, readAllProofFragments) request the file this much at a time.
+    static constexpr uint64_t READ_EXTENT_BYTES = 16ULL << 20;
+
+    // getProofFragmentsInRanges reads and decodes at most this many seek blocks (or chunks) at a
+    // time: enough to keep a disk's queue busy, without a thread per read for large plans.
+    static constexpr unsigned MAX_CONCURRENT_READS = 16;
+
     // Current on-disk format version, update this when the format changes.
-    static constexpr uint8_t FORMAT_VERSION = 1;
+    // 1: whole-chunk compression; 2: seekable chunks; 3: delta codec in the header (still read: 1,
+    // 2, both FSE). A fse-shared plot also stores its FSE table after the codec.
+    static constexpr uint8_t FORMAT_VERSION = 3;
 
     struct PlotFileContents {
         ChunkedProofFragments data;
         ProofParams params;
     };
 
+    // How chunks are read. Stream reads each chunk (or seek block) when it is needed, with pread
+    // on the file opened with the header, which all threads share. Mapped reads them in place
+    // from a memory mapping of the file, and whole-plot scans request it in large extents; but an
+    // I/O error on a mapped page, or the file shrinking while it is open, then raises SIGBUS and
+    // ends the process instead of throwing. So Mapped is for tools scanning plots on local disks,
+    // not for harvesting. Where mmap is not available or the mapping fails, Mapped reads as
+    // Stream.
+    enum class ReadMethod : uint8_t { Stream, Mapped };
+
     // Construct a PlotFile bound to a specific filename (for reading).
-    explicit PlotFile(std::string filename) : filename_(std::move(filename)) {}
+    explicit PlotFile(std::string filename, ReadMethod read_method = ReadMethod::Stream)
+        : filename_(std::move(filename))
+        , read_method_(read_method)
+    {
+    }
 
     /// Write PlotData to disk, converting to chunked + compressed representation first.
     static size_t writeData(std::string const& filename,
@@ -39,12 +76,13 @@ public:
         ProofParams const& params,
         uint16_t const index,
         uint8_t const meta_group,
-        std::span<uint8_t const> const memo)
+        std::span<uint8_t const> const memo,
+        DeltaCodec const delta_codec = DeltaCodec::Fse)
     {
         uint64_t const range_per_chunk = (1ULL << (params.get_k() + CHUNK_SPAN_RANGE_BITS));
         ChunkedProofFragments chunked_data
             = ChunkedProofFragments::convertToChunkedProofFragments(data, range_per_chunk);
-        return writeData(filename, chunked_data, params, index, meta_group, memo);
+        return writeData(filename, chunked_data, params, index, meta_group, memo, delta_codec);
     }
 
     // returns bytes written
@@ -53,10 +91,46 @@ public:
         ProofParams const& params,
         uint16_t const index,
         uint8_t const meta_group,
-        std::span<uint8_t const> const memo)
+        std::span<uint8_t const> const memo,
+        DeltaCodec const delta_codec = DeltaCodec::Fse)
     {
         size_t bytes_written = 0;
 
+        int const stub_bits = params.get_k() - MINUS_STUB_BITS;
+        uint64_t const range_per_chunk = (1ULL << (params.get_k() + CHUNK_SPAN_RANGE_BITS));
+        int const block_range_bits = params.get_k() + SEEK_BLOCK_RANGE_BITS;
+        int const num_blocks_bits = CHUNK_SPAN_RANGE_BITS - SEEK_BLOCK_RANGE_BITS;
+
+        // fse-shared: the table is trained on every delta of the plot first; with a single
+        // distinct delta there is no table to share and the plot is written as plain fse
+        DeltaCodec codec = delta_codec;
+        std::shared_ptr<SharedFseTable const> fse_table;
+        if (codec == DeltaCodec::FseShared) {
+            std::array<uint64_t, 256> counts {};
+            parallel_for_ordered(
+                size_t(0),
+                data.proof_fragments_chunks.size(),
+                [&](size_t i) {
+                    std::array<uint64_t, 256> chunk_counts {};
+                    ChunkCompressor::countSeekableDeltas(data.proof_fragments_chunks[i],
+                        i * range_per_chunk,
+                        block_range_bits,
+                        num_blocks_bits,
+                        stub_bits,
+                        chunk_counts);
+                    return chunk_counts;
+                },
+                [&](size_t, std::array<uint64_t, 256> const& chunk_counts) {
+                    for (size_t d = 0; d < counts.size(); ++d)
+                        counts[d] += chunk_counts[d];
+                });
+            fse_table = SharedFseTable::train(counts);
+            if (!fse_table) {
+                codec = DeltaCodec::Fse;
+            }
+        }
+        DeltaCoding const coding(codec, fse_table.get());
+
         std::ofstream out(filename, std::ios::binary);
         if (!out)
             throw std::runtime_error("Failed to open " + filename);
@@ -80,9 +154,21 @@ public:
         out.write(reinterpret_cast<char const*>(&memo_size), 1);
         out.write(reinterpret_cast<char const*>(memo.data()), memo.size());
 
+        uint8_t const seek_block_range_bits = SEEK_BLOCK_RANGE_BITS;
+        out.write(reinterpret_cast<char const*>(&seek_block_range_bits), 1);
+        out.write(reinterpret_cast<char const*>(&codec), 1);
+        if (fse_table) {
+            uint16_t const table_size = static_cast<uint16_t>(fse_table->serialized().size());
+            out.write(reinterpret_cast<char const*>(&table_size), sizeof(table_size));
+            out.write(reinterpret_cast<char const*>(fse_table->serialized().data()), table_size);
+        }
+
         // Write chunk index + chunk bodies:
+        //  uint8_t seek_block_range_bits (above)
+        //  uint8_t delta_codec (above)
+        //  fse-shared only: uint16_t table size, the table (above)
         //  uint64_t num_chunks
-        //  num_chunks * uint64_t offsets (placeholders, overwritten later)
+        //  num_chunks * uint64_t offsets (placeholders, each filled in as its chunk is written)
         //  chunk_0 data...
         //  chunk_1 data...
         {
@@ -105,43 +191,36 @@ public:
                 throw std::runtime_error(
                     "Failed to write chunk offset placeholders to " + filename);
 
-            // Collect real offsets as we write chunks
-            std::vector<uint64_t> offsets(num_chunks);
-
-            int const stub_bits = params.get_k() - MINUS_STUB_BITS;
-            uint64_t const range_per_chunk = (1ULL << (params.get_k() + CHUNK_SPAN_RANGE_BITS));
-
-            for (uint64_t i = 0; i < num_chunks; ++i) {
-                // record offset for this chunk (absolute offset from file start)
-                std::streampos pos = out.tellp();
-                offsets[i] = static_cast<uint64_t>(pos);
-
-                uint64_t start_proof_fragment_range = i * range_per_chunk;
-                std::vector<uint8_t> compressed_chunk = ChunkCompressor::compressProofFragments(
-                    data.proof_fragments_chunks[i], start_proof_fragment_range, stub_bits);
-
-                writeVector(out, compressed_chunk);
-                if (!out) {
-                    throw std::runtime_error(
-                        "Failed to write chunk " + std::to_string(i) + " to " + filename);
-                }
-            }
+            // The chunks are compressed on all cores and written here in order as they come in,
+            // while the next ones compress; at most two compressed chunks per thread wait in
+            // memory. Each chunk's offset (absolute, from the file start) is filled in as soon as
+            // the chunk is written.
+            parallel_for_ordered(
+                uint64_t(0),
+                num_chunks,
+                [&](uint64_t i) {
+                    return ChunkCompressor::compressSeekableProofFragments(
+                        data.proof_fragments_chunks[i],
+                        i * range_per_chunk,
+                        block_range_bits,
+                        num_blocks_bits,
+                        stub_bits,
+                        coding);
+                },
+                [&](uint64_t i, std::vector<uint8_t> const& compressed_chunk) {
+                    uint64_t const offset = static_cast<uint64_t>(out.tellp());
+                    writeVector(out, compressed_chunk);
+                    out.seekp(offsets_start_pos
+                        + static_cast<std::streamoff>(i * sizeof(offset)));
+                    out.write(reinterpret_cast<char const*>(&offset), sizeof(offset));
+                    out.seekp(0, std::ios::end);
+                    if (!out) {
+                        throw std::runtime_error(
+                            "Failed to write chunk " + std::to_string(i) + " to " + filename);
+                    }
+                });
 
             bytes_written = static_cast<size_t>(out.tellp());
-
-            // Seek back and overwrite placeholders with actual offsets
-            out.seekp(offsets_start_pos);
-            if (!out)
-                throw std::runtime_error("Failed to seek to chunk offsets in " + filename);
-
-            for (uint64_t i = 0; i < num_chunks; ++i) {
-                out.write(reinterpret_cast<char const*>(&offsets[i]), sizeof(offsets[i]));
-            }
-            if (!out)
-                throw std::runtime_error("Failed to write chunk offsets to " + filename);
-
-            // Seek back to end so file finalization is consistent
-            out.seekp(0, std::ios::end);
         }
 
         if (!out)
@@ -153,17 +232,29 @@ public:
     // -------- Instance reading API --------
 
     // Read header + xs (if present) + chunk index (num_chunks + offsets) and cache locally.
-    // Safe to call multiple times; only does work once.
+    // Safe to call multiple times; only does work once. Once it has run, the reading functions
+    // below no longer modify the PlotFile and may be called from several threads at once.
     void readHeadersAndIndexes()
     {
         if (plot_file_header_) {
             return; // already loaded
         }
 
-        std::ifstream in(filename_, std::ios::binary);
-        if (!in) {
-            throw std::runtime_error("Failed to open " + filename_);
-        }
+        // The header is read through the descriptor the chunks are read through later, so both
+        // come from the same file even if the name is replaced meanwhile.
+        auto file = std::make_shared<PositionalFile const>(filename_);
+        // reads the header in order, like a stream: once a read falls short, `in` is false
+        struct HeaderReader {
+            PositionalFile const& file;
+            uint64_t pos = 0;
+            bool ok = true;
+            void read(void* out, size_t size)
+            {
+                ok = ok && file.read_at(pos, std::span(static_cast<uint8_t*>(out), size));
+                pos += size;
+            }
+            explicit operator bool() const { return ok; }
+        } in { *file };
 
         char magic[4] = {};
         in.read(magic, sizeof(magic));
@@ -171,61 +262,127 @@ public:
             throw std::runtime_error("Plot file invalid magic bytes, not a plot file");
         }
 
-        uint8_t version;
-        in.read(reinterpret_cast<char*>(&version), sizeof(version));
-        if (version != FORMAT_VERSION) {
+        uint8_t version = 0;
+        in.read(&version, sizeof(version));
+        if (version < 1 || version > FORMAT_VERSION) {
             throw std::runtime_error(
                 "Plot file format version " + std::to_string(version) + " is not supported.");
         }
 
         uint8_t plot_id_bytes[32];
-        in.read(reinterpret_cast<char*>(plot_id_bytes), 32);
+        in.read(plot_id_bytes, 32);
 
         uint8_t k;
-        in.read(reinterpret_cast<char*>(&k), sizeof(k));
+        in.read(&k, sizeof(k));
 
         uint8_t strength;
-        in.read(reinterpret_cast<char*>(&strength), sizeof(strength));
+        in.read(&strength, sizeof(strength));
 
         uint16_t index;
-        in.read(reinterpret_cast<char*>(&index), sizeof(index));
+        in.read(&index, sizeof(index));
 
         uint8_t meta_group;
-        in.read(reinterpret_cast<char*>(&meta_group), sizeof(meta_group));
+        in.read(&meta_group, sizeof(meta_group));
 
         ProofParams params(plot_id_bytes, k, strength, 0);
 
         uint8_t memo_length = 0;
-        in.read(reinterpret_cast<char*>(&memo_length), sizeof(memo_length));
-        // skip memo
-        in.seekg(memo_length, std::ifstream::cur);
+        in.read(&memo_length, sizeof(memo_length));
+        in.pos += memo_length; // skip memo
 
         PlotFileHeader header(params);
+        header.version = version;
         header.index = index;
         header.meta_group = meta_group;
+        if (version >= 2) {
+            in.read(&header.seek_block_range_bits, 1);
+            if (header.seek_block_range_bits > CHUNK_SPAN_RANGE_BITS) {
+                throw std::runtime_error("Plot file seek block size invalid in " + filename_);
+            }
+        }
+        if (version >= 3) {
+            uint8_t delta_codec = 0;
+            in.read(&delta_codec, 1);
+            if (!is_valid_delta_codec(delta_codec)) {
+                throw std::runtime_error("Plot file delta codec unknown in " + filename_);
+            }
+            header.delta_codec = static_cast<DeltaCodec>(delta_codec);
+        }
+        if (header.delta_codec == DeltaCodec::FseShared) {
+            // built here once; every chunk and seek block of the plot decodes with it
+            uint16_t table_size = 0;
+            in.read(&table_size, sizeof(table_size));
+            std::vector<uint8_t> table(table_size);
+            in.read(table.data(), table_size);
+            if (!in) {
+                throw std::runtime_error("Failed to read shared FSE table in " + filename_);
+            }
+            try {
+                header.fse_table = SharedFseTable::deserialize(table);
+            }
+            catch (std::runtime_error const&) {
+                throw std::runtime_error("Plot file shared FSE table invalid in " + filename_);
+            }
+        }
 
         // Read number of chunks
         uint64_t num_chunks = 0;
-        in.read(reinterpret_cast<char*>(&num_chunks), sizeof(num_chunks));
+        in.read(&num_chunks, sizeof(num_chunks));
         if (!in) {
             throw std::runtime_error("Failed to read number of chunks in " + filename_);
         }
 
+        // Every chunk needs an offset and a length, which bounds the count by the file size.
+        uint64_t const offsets_start = in.pos;
+        uint64_t const file_size = file->size();
+        if (offsets_start > file_size
+            || num_chunks > (file_size - offsets_start) / (2 * sizeof(uint64_t))) {
+            throw std::runtime_error("Plot file chunk count invalid in " + filename_);
+        }
+
         header.num_chunks = num_chunks;
+        header.file_size = file_size;
 
         // Read offsets
         header.offsets.resize(num_chunks);
-        for (uint64_t i = 0; i < num_chunks; ++i) {
-            in.read(reinterpret_cast<char*>(&header.offsets[i]), sizeof(header.offsets[i]));
-        }
+        in.read(header.offsets.data(), num_chunks * sizeof(uint64_t));
         if (!in) {
             throw std::runtime_error("Failed to read chunk offsets in " + filename_);
         }
 
+        // The chunks follow the offsets in order, each a u64 length and its bytes. With the
+        // offsets checked here, each chunk is bounded by the next one (see chunkCapacity_), so
+        // no read reaches past the end of the file as it was when opened.
+        uint64_t chunk_min = offsets_start + num_chunks * sizeof(uint64_t);
+        for (uint64_t const offset: header.offsets) {
+            if (offset < chunk_min || offset > file_size - sizeof(uint64_t)) {
+                throw std::runtime_error("Plot file chunk offsets invalid in " + filename_);
+            }
+            chunk_min = offset + sizeof(uint64_t);
+        }
+
         plot_file_header_ = std::move(header);
+        file_ = std::move(file);
+
+        // Mapped: chunk reads go through a mapping of the file, with no read call per chunk, and
+        // the compressed bytes are decompressed in place rather than copied out first.
+        if constexpr (MappedFile::supported) {
+            if (read_method_ == ReadMethod::Mapped) {
+                try {
+                    mapping_
+                        = std::make_shared<MappedFile const>(file_->native_handle(), filename_);
+                }
+                catch (std::exception const&) {
+                    mapping_.reset(); // e.g. address space limits; the stream path still works
+                }
+                if (mapping_ && mapping_->size() != file_size) {
+                    mapping_.reset(); // changed since the offsets were checked
+                }
+            }
+        }
     }
 
-    // Reads all chunked data + params.
+    // Reads all chunked data + params, decoding the chunks on all cores (see forEachChunk).
     PlotFileContents readAllChunkedData()
     {
         readHeadersAndIndexes();
@@ -233,41 +390,91 @@ public:
             throw std::runtime_error("PlotFileHeader not loaded");
         }
 
-        auto const& header = *plot_file_header_;
-
         ChunkedProofFragments chunked;
+        chunked.proof_fragments_chunks.resize(plot_file_header_->num_chunks);
+        forEachChunk([&](uint64_t chunk_index, std::vector<ProofFragment>&& fragments) {
+            chunked.proof_fragments_chunks[chunk_index] = std::move(fragments);
+        });
+        return { .data = std::move(chunked), .params = plot_file_header_->params };
+    }
 
-        uint64_t const num_chunks = header.num_chunks;
-        chunked.proof_fragments_chunks.clear();
-        chunked.proof_fragments_chunks.resize(num_chunks);
-
-        std::ifstream in(filename_, std::ios::binary);
-        if (!in) {
-            throw std::runtime_error("Failed to open " + filename_);
+    // Every fragment of the plot in one vector, in order (as PlotData::t3_proof_fragments). A
+    // first pass takes each chunk's fragment count from its block headers, then the chunks are
+    // decoded concurrently, each straight into its place in the preallocated output. Through the
+    // mapping both passes read the file in extents (see forEachChunk) and the second finds the
+    // pages still cached unless the plot is larger than memory. Without a mapping the first pass
+    // keeps each chunk's bytes for the second, so the file is read once, at the cost of holding
+    // the compressed plot (about a third of the output) until its chunks are decoded.
+    std::vector<ProofFragment> readAllProofFragments()
+    {
+        readHeadersAndIndexes();
+        uint64_t const num_chunks = plot_file_header_->num_chunks;
+
+        std::vector<size_t> chunk_starts(num_chunks + 1, 0);
+        auto const add_count = [&](uint64_t chunk_index, size_t count) {
+            chunk_starts[chunk_index + 1] = chunk_starts[chunk_index] + count;
+        };
+        std::vector<std::vector<uint8_t>> compressed_chunks;
+        if (mapping_) {
+            scanChunks_(
+                [this](uint64_t, std::span<uint8_t const> compressed_chunk) {
+                    return fragmentCount_(compressed_chunk);
+                },
+                add_count);
+        } else {
+            compressed_chunks.resize(num_chunks);
+            parallel_for_ordered(
+                uint64_t(0),
+                num_chunks,
+                [this](uint64_t chunk_index) {
+                    std::vector<uint8_t> compressed_chunk = readChunkBytes_(chunk_index);
+                    size_t const count = fragmentCount_(compressed_chunk);
+                    return std::pair(count, std::move(compressed_chunk));
+                },
+                [&](uint64_t chunk_index, std::pair<size_t, std::vector<uint8_t>>&& counted) {
+                    add_count(chunk_index, counted.first);
+                    compressed_chunks[chunk_index] = std::move(counted.second);
+                });
         }
 
-        int const stub_bits = header.params.get_k() - MINUS_STUB_BITS;
-        uint64_t const range_per_chunk = (1ULL << (header.params.get_k() + CHUNK_SPAN_RANGE_BITS));
-
-        for (uint64_t i = 0; i < num_chunks; ++i) {
-            in.seekg(static_cast<std::streamoff>(header.offsets[i]), std::ios::beg);
-            if (!in) {
-                throw std::runtime_error(
-                    "Failed to seek to chunk " + std::to_string(i) + " in " + filename_);
-            }
-
-            uint64_t start_proof_fragment_range = i * range_per_chunk;
-            std::vector<uint8_t> compressed_chunk = readVector<uint8_t>(in);
-            if (!in) {
-                throw std::runtime_error(
-                    "Failed to read compressed chunk " + std::to_string(i) + " from " + filename_);
-            }
-
-            chunked.proof_fragments_chunks[i] = ChunkCompressor::decompressProofFragments(
-                compressed_chunk, start_proof_fragment_range, stub_bits);
+        std::vector<ProofFragment> fragments(chunk_starts[num_chunks]);
+        auto const decode = [&](uint64_t chunk_index, std::span<uint8_t const> compressed_chunk) {
+            size_t const begin = chunk_starts[chunk_index];
+            decompressChunkInto_(compressed_chunk,
+                chunk_index,
+                std::span(fragments).subspan(begin, chunk_starts[chunk_index + 1] - begin));
+            return true;
+        };
+        if (mapping_) {
+            scanChunks_(decode, [](uint64_t, bool) {});
+        } else {
+            parallel_for_ordered(
+                uint64_t(0),
+                num_chunks,
+                [&](uint64_t chunk_index) {
+                    return decode(chunk_index, compressed_chunks[chunk_index]);
+                },
+                [&](uint64_t chunk_index, bool) {
+                    compressed_chunks[chunk_index] = {}; // decoded, free its bytes
+                });
         }
+        return fragments;
+    }
 
-        return { .data = std::move(chunked), .params = header.params };
+    // Calls fn(chunk_index, fragments) for every chunk in chunk order, on the calling thread, with
+    // the fragments as an rvalue fn may keep. Meanwhile the next chunks are read and decoded on
+    // all cores; at most two decoded chunks per thread are held at a time, never the whole plot.
+    template <typename Fn>
+    void forEachChunk(Fn&& fn)
+    {
+        readHeadersAndIndexes();
+        scanChunks_(
+            [this](uint64_t chunk_index, std::span<uint8_t const> compressed_chunk) {
+                return decompressChunk_(compressed_chunk, chunk_index);
+            },
+            [&fn](uint64_t chunk_index, std::vector<ProofFragment>&& fragments) {
+                fn(chunk_index, std::move(fragments));
+            });
     }
 
     // Read a single chunk's decompressed proof fragments by index.
@@ -284,30 +491,17 @@ public:
             throw std::out_of_range("chunk_index out of range");
         }
 
-        std::ifstream in(filename_, std::ios::binary);
-        if (!in) {
-            throw std::runtime_error("Failed to open " + filename_);
-        }
-
-        in.seekg(static_cast<std::streamoff>(header.offsets[chunk_index]), std::ios::beg);
-        if (!in) {
-            throw std::runtime_error(
-                "Failed to seek to chunk " + std::to_string(chunk_index) + " in " + filename_);
+        if (chunk_cache_) {
+            return *cachedRead_({ chunk_index, kWholeChunk });
         }
+        return decodeChunk_(chunk_index);
+    }
 
-        int const stub_bits = header.params.get_k() - MINUS_STUB_BITS;
-        uint64_t const range_per_chunk = (1ULL << (header.params.get_k() + CHUNK_SPAN_RANGE_BITS));
-        uint64_t const start_proof_fragment_range = chunk_index * range_per_chunk;
-
-        std::vector<uint8_t> compressed_chunk = readVector<uint8_t>(in);
-        if (!in) {
-            throw std::runtime_error(
-                "Failed to read chunk " + std::to_string(chunk_index) + " from " + filename_);
-        }
+    // Decoded chunks and seek blocks are looked up in (and added to) `cache` from now on; nullptr
+    // turns caching off. The cache may be shared with other PlotFiles, of this or other plots.
+    void setChunkCache(std::shared_ptr<ChunkCache> cache) { chunk_cache_ = std::move(cache); }
 
-        return ChunkCompressor::decompressProofFragments(
-            compressed_chunk, start_proof_fragment_range, stub_bits);
-    }
+    std::shared_ptr<ChunkCache> const& chunkCache() const { return chunk_cache_; }
 
     // -------- Static convenience wrappers for reading --------
 
@@ -332,6 +526,38 @@ public:
         return plot_file_header_->params;
     }
 
+    uint64_t getNumChunks()
+    {
+        readHeadersAndIndexes();
+        return plot_file_header_->num_chunks;
+    }
+
+    // The entropy coder of the plot's chunk deltas (FSE for plots before version 3).
+    DeltaCodec getDeltaCodec()
+    {
+        readHeadersAndIndexes();
+        return plot_file_header_->delta_codec;
+    }
+
+    // Starts reading the chunk (or seek block) behind `range` in the background, so that the
+    // reads for several ranges overlap when they are all prefetched before the first
+    // getProofFragmentsInRange(). Only a hint; does nothing without a mapping.
+    void prefetchProofFragmentsInRange(Range const& range)
+    {
+        uint64_t const chunk_index = range.start / getRangePerChunk();
+        if (!mapping_ || chunk_index >= plot_file_header_->num_chunks) {
+            return;
+        }
+        if (std::optional<uint32_t> const block = seekBlockFor_(range)) {
+            std::vector<uint8_t> unused;
+            seekBlockBytes_(chunk_index, *block, unused);
+            return;
+        }
+        std::span<uint8_t const> const compressed_chunk = mappedChunk_(chunk_index);
+        mapping_->will_need(
+            plot_file_header_->offsets[chunk_index], sizeof(uint64_t) + compressed_chunk.size());
+    }
+
     std::vector<ProofFragment> getProofFragmentsInRange(Range const& range)
     {
         uint64_t const range_per_chunk = getRangePerChunk();
@@ -341,10 +567,16 @@ public:
             throw std::invalid_argument("getProofFragmentsInRange: range spans multiple chunks");
         }
 
+        if (chunk_index >= plot_file_header_->num_chunks) {
+            throw std::out_of_range("chunk_index out of range");
+        }
+
         std::vector<ProofFragment> result;
 
-        std::vector<uint64_t> chunk_fragments = readChunk(chunk_index);
-        for (auto const& fragment: chunk_fragments) {
+        // a range inside one seek block (a chaining set always is) decodes just that block
+        ChunkCache::Fragments const chunk_fragments
+            = cachedRead_({ chunk_index, seekBlockFor_(range).value_or(kWholeChunk) });
+        for (auto const& fragment: *chunk_fragments) {
             if (fragment >= range.start && fragment < range.end) {
                 result.push_back(fragment);
             }
@@ -353,16 +585,152 @@ public:
         return result;
     }
 
+    // The fragments in each of `ranges`, as getProofFragmentsInRange would return them, read as one
+    // plan: ranges in the same seek block (or chunk) share one read and one decode, reads the chunk
+    // cache holds are skipped, neighbouring reads of the rest are merged into one (one pread, or
+    // one page request through the mapping), and up to MAX_CONCURRENT_READS threads read and
+    // decode them, so decoding overlaps waiting for the others.
+    std::vector<std::vector<ProofFragment>> getProofFragmentsInRanges(
+        std::span<Range const> const ranges)
+    {
+        uint64_t const range_per_chunk = getRangePerChunk();
+
+        std::vector<ChunkRead> reads;
+        reads.reserve(ranges.size());
+        for (Range const& range: ranges) {
+            uint64_t const chunk_index = range.start / range_per_chunk;
+            if (chunk_index != (range.end - 1) / range_per_chunk) {
+                throw std::invalid_argument(
+                    "getProofFragmentsInRanges: range spans multiple chunks");
+            }
+            if (chunk_index >= plot_file_header_->num_chunks) {
+                throw std::out_of_range("chunk_index out of range");
+            }
+            reads.push_back({ chunk_index, seekBlockFor_(range).value_or(kWholeChunk) });
+        }
+        std::vector<ChunkRead> planned = reads;
+        std::sort(planned.begin(), planned.end());
+        planned.erase(std::unique(planned.begin(), planned.end()), planned.end());
+
+        std::vector<ChunkCache::Fragments> decoded(planned.size());
+        std::vector<size_t> misses;
+        std::vector<ChunkRead> missed_reads;
+        for (size_t i = 0; i < planned.size(); ++i) {
+            if (chunk_cache_) {
+                decoded[i] = chunk_cache_->find(cacheKey_(planned[i]));
+            }
+            if (!decoded[i]) {
+                misses.push_back(i);
+                missed_reads.push_back(planned[i]);
+            }
+        }
+
+        // Through the mapping each read decodes in place once its pages are requested. Without
+        // one, reads next to each other in the file (neighbouring seek blocks) are merged into one
+        // read of their span, which their bytes are then sliced out of.
+        std::vector<std::vector<size_t>> groups; // misses read and decoded together
+        std::vector<std::pair<uint64_t, uint64_t>> extents; // of each miss, without a mapping
+        if (mapping_) {
+            requestPages_(missed_reads);
+            for (size_t m = 0; m < misses.size(); ++m) {
+                groups.push_back({ m });
+            }
+        } else {
+            extents = readExtents_(missed_reads);
+            std::vector<size_t> order(misses.size());
+            std::iota(order.begin(), order.end(), size_t(0));
+            std::sort(order.begin(), order.end(),
+                [&](size_t a, size_t b) { return extents[a] < extents[b]; });
+            uint64_t group_end = 0;
+            for (size_t const m: order) {
+                if (groups.empty() || extents[m].first > group_end) {
+                    groups.emplace_back();
+                    group_end = extents[m].second;
+                }
+                group_end = std::max(group_end, extents[m].second);
+                groups.back().push_back(m);
+            }
+        }
+
+        std::vector<std::exception_ptr> errors(groups.size());
+        parallel_for_range(
+            size_t(0),
+            groups.size(),
+            [&](size_t g) {
+                try {
+                    std::vector<uint8_t> span_bytes;
+                    uint64_t span_begin = 0;
+                    if (!mapping_) {
+                        span_begin = extents[groups[g].front()].first;
+                        uint64_t span_end = span_begin;
+                        for (size_t const m: groups[g]) {
+                            span_end = std::max(span_end, extents[m].second);
+                        }
+                        span_bytes.resize(span_end - span_begin);
+                        if (!file_->read_at(span_begin, span_bytes)) {
+                            throw chunkReadError_(missed_reads[groups[g].front()].chunk);
+                        }
+                    }
+                    for (size_t const m: groups[g]) {
+                        ChunkRead const read = missed_reads[m];
+                        decoded[misses[m]] = std::make_shared<std::vector<ProofFragment> const>(
+                            mapping_ ? decodeRead_(read)
+                                     : decodeReadBytes_(read,
+                                           std::span<uint8_t const>(span_bytes)
+                                               .subspan(extents[m].first - span_begin,
+                                                   extents[m].second - extents[m].first)));
+                        if (chunk_cache_) {
+                            chunk_cache_->insert(cacheKey_(read), decoded[misses[m]]);
+                        }
+                    }
+                }
+                catch (...) {
+                    errors[g] = std::current_exception();
+                }
+            },
+            MAX_CONCURRENT_READS); // waiting on I/O, not cores
+        for (std::exception_ptr const& error: errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        std::vector<std::vector<ProofFragment>> result(ranges.size());
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            size_t const p = static_cast<size_t>(
+                std::lower_bound(planned.begin(), planned.end(), reads[i]) - planned.begin());
+            for (ProofFragment const fragment: *decoded[p]) {
+                if (fragment >= ranges[i].start && fragment < ranges[i].end) {
+                    result[i].push_back(fragment);
+                }
+            }
+        }
+        return result;
+    }
+
 private:
+    // One read of a plan: a seek block of a chunk, or the whole chunk.
+    static constexpr uint32_t kWholeChunk = ChunkCache::kWholeChunk;
+    struct ChunkRead {
+        uint64_t chunk;
+        uint32_t block;
+        auto operator<=>(ChunkRead const&) const = default;
+    };
+
     struct PlotFileHeader {
         ProofParams params;
+        uint8_t version = FORMAT_VERSION;
         uint16_t index;
         uint8_t meta_group;
+        uint8_t seek_block_range_bits = 0; // version 2+
+        DeltaCodec delta_codec = DeltaCodec::Fse; // version 3+
+        std::shared_ptr<SharedFseTable const> fse_table; // fse-shared plots
 #ifdef RETAIN_X_VALUES_TO_T3
         std::vector<std::array<uint32_t, 8>> xs_correlating_to_proof_fragments;
 #endif
         uint64_t num_chunks = 0;
         std::vector<uint64_t> offsets;
+        uint64_t file_size = 0;
 
         // Explicit constructor so this type can be constructed
         explicit PlotFileHeader(ProofParams const& p) : params(p) {}
@@ -379,6 +747,404 @@ private:
         return (1ULL << (plot_file_header_->params.get_k() + CHUNK_SPAN_RANGE_BITS));
     }
 
+    // The most compressed bytes chunk `chunk_index` can have: up to the next chunk, or the end of
+    // the file.
+    uint64_t chunkCapacity_(uint64_t chunk_index) const
+    {
+        auto const& header = *plot_file_header_;
+        uint64_t const end = chunk_index + 1 < header.num_chunks ? header.offsets[chunk_index + 1]
+                                                                 : header.file_size;
+        return end - header.offsets[chunk_index] - sizeof(uint64_t);
+    }
+
+    std::runtime_error chunkReadError_(uint64_t chunk_index) const
+    {
+        return std::runtime_error(
+            "Failed to read chunk " + std::to_string(chunk_index) + " from " + filename_);
+    }
+
+    // The compressed bytes of a chunk inside the mapping, as writeVector laid them out (u64 length,
+    // then the bytes).
+    std::span<uint8_t const> mappedChunk_(uint64_t chunk_index) const
+    {
+        uint64_t const offset = plot_file_header_->offsets[chunk_index];
+        try {
+            uint64_t length = 0;
+            std::memcpy(&length, mapping_->range(offset, sizeof(length)).data(), sizeof(length));
+            if (length > chunkCapacity_(chunk_index)) {
+                throw chunkReadError_(chunk_index);
+            }
+            return mapping_->range(offset + sizeof(length), length);
+        }
+        catch (std::out_of_range const&) {
+            throw chunkReadError_(chunk_index);
+        }
+    }
+
+    std::vector<ProofFragment> decompressChunk_(
+        std::span<uint8_t const> compressed_chunk, uint64_t chunk_index) const
+    {
+        std::vector<ProofFragment> fragments(fragmentCount_(compressed_chunk));
+        decompressChunkInto_(compressed_chunk, chunk_index, fragments);
+        return fragments;
+    }
+
+    size_t fragmentCount_(std::span<uint8_t const> compressed_chunk) const
+    {
+        auto const& header = *plot_file_header_;
+        if (header.version < 2) {
+            return ChunkCompressor::fragmentCount(compressed_chunk);
+        }
+        return ChunkCompressor::seekableFragmentCount(
+            compressed_chunk, CHUNK_SPAN_RANGE_BITS - header.seek_block_range_bits);
+    }
+
+    // Decodes a chunk into `out`, which must hold exactly fragmentCount_() fragments.
+    void decompressChunkInto_(std::span<uint8_t const> compressed_chunk,
+        uint64_t chunk_index,
+        std::span<ProofFragment> out) const
+    {
+        auto const& header = *plot_file_header_;
+        int const k = header.params.get_k();
+        int const stub_bits = k - MINUS_STUB_BITS;
+        uint64_t const start_proof_fragment_range = chunk_index << (k + CHUNK_SPAN_RANGE_BITS);
+        if (header.version < 2) {
+            ChunkCompressor::decompressProofFragmentsInto(
+                compressed_chunk, start_proof_fragment_range, stub_bits, out, deltaCoding_());
+            return;
+        }
+        ChunkCompressor::decompressSeekableProofFragmentsInto(compressed_chunk,
+            start_proof_fragment_range,
+            k + header.seek_block_range_bits,
+            CHUNK_SPAN_RANGE_BITS - header.seek_block_range_bits,
+            stub_bits,
+            out,
+            deltaCoding_());
+    }
+
+    // Runs produce(chunk_index, compressed chunk) for every chunk on all cores and
+    // consume(chunk_index, result) on the calling thread in chunk order (parallel_for_ordered).
+    // Through the mapping, the file is requested in READ_EXTENT_BYTES extents, one extent ahead of
+    // the chunks being decoded, so the disk sees large sequential reads however the chunks are
+    // spread over the threads. Without a mapping each chunk is a read of its own.
+    template <typename Produce, typename Consume>
+    void scanChunks_(Produce produce, Consume consume) const
+    {
+        auto const& header = *plot_file_header_;
+        std::vector<uint64_t> extent_starts; // the first chunk of each extent
+        for (uint64_t i = 0; i < header.num_chunks; ++i) {
+            if (extent_starts.empty()
+                || header.offsets[i] - header.offsets[extent_starts.back()] >= READ_EXTENT_BYTES) {
+                extent_starts.push_back(i);
+            }
+        }
+        auto const request_extent = [&](size_t e) {
+            if (e >= extent_starts.size()) {
+                return;
+            }
+            uint64_t const begin = header.offsets[extent_starts[e]];
+            uint64_t const end = e + 1 < extent_starts.size()
+                ? header.offsets[extent_starts[e + 1]]
+                : mapping_->size();
+            mapping_->will_need(begin, end > begin ? end - begin : 0);
+        };
+        if (mapping_) {
+            request_extent(0);
+        }
+
+        parallel_for_ordered(
+            uint64_t(0),
+            header.num_chunks,
+            [&](uint64_t chunk_index) {
+                if (!mapping_) {
+                    std::vector<uint8_t> const compressed_chunk = readChunkBytes_(chunk_index);
+                    return produce(chunk_index, std::span<uint8_t const>(compressed_chunk));
+                }
+                auto const e
+                    = std::lower_bound(extent_starts.begin(), extent_starts.end(), chunk_index);
+                if (e != extent_starts.end() && *e == chunk_index) {
+                    request_extent(static_cast<size_t>(e - extent_starts.begin()) + 1);
+                }
+                return produce(chunk_index, mappedChunk_(chunk_index));
+            },
+            consume);
+    }
+
+    DeltaCoding deltaCoding_() const
+    {
+        return { plot_file_header_->delta_codec, plot_file_header_->fse_table.get() };
+    }
+
+    // The seek block holding all of `range`, if the plot has seek blocks and there is one.
+    std::optional<uint32_t> seekBlockFor_(Range const& range) const
+    {
+        auto const& header = *plot_file_header_;
+        if (header.version < 2) {
+            return std::nullopt;
+        }
+        int const block_bits = header.params.get_k() + header.seek_block_range_bits;
+        if (range.start >> block_bits != (range.end - 1) >> block_bits) {
+            return std::nullopt;
+        }
+        uint64_t const blocks_mask
+            = (1ULL << (CHUNK_SPAN_RANGE_BITS - header.seek_block_range_bits)) - 1;
+        return static_cast<uint32_t>((range.start >> block_bits) & blocks_mask);
+    }
+
+    // The compressed bytes of one seek block: read through the seek table at the start of the
+    // chunk, from the mapping (with the block's pages requested) or else into `storage`.
+    std::span<uint8_t const> seekBlockBytes_(
+        uint64_t chunk_index, uint32_t block, std::vector<uint8_t>& storage) const
+    {
+        if (mapping_) {
+            std::span<uint8_t const> const bytes = mappedSeekBlock_(chunk_index, block);
+            mapping_->will_need(fileOffset_(bytes), bytes.size());
+            return bytes;
+        }
+
+        std::vector<uint8_t> table;
+        uint64_t const length = readSeekTable_(chunk_index, table);
+        auto const [offset, size] = seekBlockExtent_(chunk_index, block, table, length);
+        storage.resize(size);
+        uint64_t const chunk_offset = plot_file_header_->offsets[chunk_index];
+        if (!file_->read_at(chunk_offset + sizeof(uint64_t) + offset, storage)) {
+            throw chunkReadError_(chunk_index);
+        }
+        return storage;
+    }
+
+    // The seek table at the start of a chunk, read with the chunk's length in one read (the path
+    // without a mapping). Returns the length.
+    uint64_t readSeekTable_(uint64_t chunk_index, std::vector<uint8_t>& table) const
+    {
+        uint32_t const num_blocks
+            = 1u << (CHUNK_SPAN_RANGE_BITS - plot_file_header_->seek_block_range_bits);
+        table.resize(sizeof(uint64_t) + ChunkCompressor::seekTableSize(num_blocks));
+        if (!file_->read_at(plot_file_header_->offsets[chunk_index], table)) {
+            throw chunkReadError_(chunk_index);
+        }
+        uint64_t length = 0;
+        std::memcpy(&length, table.data(), sizeof(length));
+        table.erase(table.begin(), table.begin() + sizeof(length));
+        if (length < table.size() || length > chunkCapacity_(chunk_index)) {
+            throw chunkReadError_(chunk_index);
+        }
+        return length;
+    }
+
+    // Where seek block `block` lies in a chunk of `length` bytes: {offset after the chunk's
+    // length, size}.
+    std::pair<uint64_t, uint64_t> seekBlockExtent_(uint64_t chunk_index,
+        uint32_t block,
+        std::span<uint8_t const> table,
+        uint64_t length) const
+    {
+        uint32_t const num_blocks
+            = 1u << (CHUNK_SPAN_RANGE_BITS - plot_file_header_->seek_block_range_bits);
+        auto const [offset, size] = ChunkCompressor::seekBlockExtent(table, num_blocks, block);
+        if (offset + size > length) {
+            throw chunkReadError_(chunk_index);
+        }
+        return { offset, size };
+    }
+
+    std::span<uint8_t const> mappedSeekBlock_(uint64_t chunk_index, uint32_t block) const
+    {
+        uint32_t const num_blocks
+            = 1u << (CHUNK_SPAN_RANGE_BITS - plot_file_header_->seek_block_range_bits);
+        size_t const table_size = ChunkCompressor::seekTableSize(num_blocks);
+        std::span<uint8_t const> const chunk = mappedChunk_(chunk_index);
+        if (chunk.size() < table_size) {
+            throw chunkReadError_(chunk_index);
+        }
+        auto const [offset, size]
+            = ChunkCompressor::seekBlockExtent(chunk.first(table_size), num_blocks, block);
+        if (offset + size > chunk.size()) {
+            throw chunkReadError_(chunk_index);
+        }
+        return chunk.subspan(offset, size);
+    }
+
+    uint64_t fileOffset_(std::span<uint8_t const> bytes) const
+    {
+        return static_cast<uint64_t>(bytes.data() - mapping_->bytes().data());
+    }
+
+    // Requests the pages of all planned reads at once, merging reads that are next to each other
+    // in the file (neighbouring seek blocks) into one request.
+    void requestPages_(std::vector<ChunkRead> const& planned) const
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> extents; // [begin, end) in the file
+        for (ChunkRead const& read: planned) {
+            std::span<uint8_t const> const bytes = read.block == kWholeChunk
+                ? mappedChunk_(read.chunk)
+                : mappedSeekBlock_(read.chunk, read.block);
+            extents.emplace_back(fileOffset_(bytes), fileOffset_(bytes) + bytes.size());
+        }
+        std::sort(extents.begin(), extents.end());
+        for (size_t i = 0; i < extents.size();) {
+            auto [begin, end] = extents[i];
+            for (++i; i < extents.size() && extents[i].first <= end; ++i) {
+                end = std::max(end, extents[i].second);
+            }
+            mapping_->will_need(begin, end - begin);
+        }
+    }
+
+    std::vector<ProofFragment> decodeChunk_(uint64_t chunk_index) const
+    {
+        auto const& header = *plot_file_header_;
+
+        if (mapping_) {
+            std::span<uint8_t const> const compressed_chunk = mappedChunk_(chunk_index);
+            // one read for the whole chunk instead of a fault per page (the mapping is MADV_RANDOM)
+            mapping_->will_need(
+                header.offsets[chunk_index], sizeof(uint64_t) + compressed_chunk.size());
+            return decompressChunk_(compressed_chunk, chunk_index);
+        }
+        return decompressChunk_(readChunkBytes_(chunk_index), chunk_index);
+    }
+
+    // The compressed bytes of a chunk, read from the file (the path without a mapping).
+    std::vector<uint8_t> readChunkBytes_(uint64_t chunk_index) const
+    {
+        uint64_t const offset = plot_file_header_->offsets[chunk_index];
+        // as writeVector laid it out, with the length checked before anything is allocated
+        uint64_t length = 0;
+        if (!file_->read_at(offset, std::span(reinterpret_cast<uint8_t*>(&length), sizeof(length)))
+            || length > chunkCapacity_(chunk_index)) {
+            throw chunkReadError_(chunk_index);
+        }
+        std::vector<uint8_t> compressed_chunk(length);
+        if (!file_->read_at(offset + sizeof(length), compressed_chunk)) {
+            throw chunkReadError_(chunk_index);
+        }
+        return compressed_chunk;
+    }
+
+    std::vector<ProofFragment> decodeRead_(ChunkRead const& read) const
+    {
+        return read.block == kWholeChunk ? decodeChunk_(read.chunk)
+                                         : readSeekBlock_(read.chunk, read.block);
+    }
+
+    ChunkCache::Key cacheKey_(ChunkRead const& read) const
+    {
+        ChunkCache::Key key { .chunk = read.chunk, .block = read.block };
+        std::memcpy(key.plot_id.data(), plot_file_header_->params.get_plot_id_bytes(), 32);
+        return key;
+    }
+
+    // The decoded read, from the chunk cache if there is one and it has it.
+    ChunkCache::Fragments cachedRead_(ChunkRead const& read) const
+    {
+        if (!chunk_cache_) {
+            return std::make_shared<std::vector<ProofFragment> const>(decodeRead_(read));
+        }
+        ChunkCache::Key const key = cacheKey_(read);
+        if (ChunkCache::Fragments hit = chunk_cache_->find(key)) {
+            return hit;
+        }
+        auto fragments = std::make_shared<std::vector<ProofFragment> const>(decodeRead_(read));
+        chunk_cache_->insert(key, fragments);
+        return fragments;
+    }
+
+    std::vector<ProofFragment> readSeekBlock_(uint64_t chunk_index, uint32_t block) const
+    {
+        auto const& header = *plot_file_header_;
+        if (chunk_index >= header.num_chunks) {
+            throw std::out_of_range("chunk_index out of range");
+        }
+        std::vector<uint8_t> storage;
+        return decodeSeekBlock_(chunk_index, block, seekBlockBytes_(chunk_index, block, storage));
+    }
+
+    std::vector<ProofFragment> decodeSeekBlock_(
+        uint64_t chunk_index, uint32_t block, std::span<uint8_t const> bytes) const
+    {
+        auto const& header = *plot_file_header_;
+        int const k = header.params.get_k();
+        uint64_t const block_start = (chunk_index << (k + CHUNK_SPAN_RANGE_BITS))
+            + (uint64_t(block) << (k + header.seek_block_range_bits));
+        return ChunkCompressor::decompressProofFragments(
+            bytes, block_start, k - MINUS_STUB_BITS, deltaCoding_());
+    }
+
+    // Where each of the sorted `reads` lies in the file, [begin, end) (the path without a
+    // mapping): a whole chunk from its length up to the next chunk, a seek block through the seek
+    // table of its chunk, read once per chunk, the chunks' tables concurrently.
+    std::vector<std::pair<uint64_t, uint64_t>> readExtents_(
+        std::vector<ChunkRead> const& reads) const
+    {
+        std::vector<size_t> chunk_starts; // the first read of each chunk, then reads.size()
+        for (size_t i = 0; i < reads.size(); ++i) {
+            if (i == 0 || reads[i].chunk != reads[i - 1].chunk) {
+                chunk_starts.push_back(i);
+            }
+        }
+        chunk_starts.push_back(reads.size());
+
+        std::vector<std::pair<uint64_t, uint64_t>> extents(reads.size());
+        std::vector<std::exception_ptr> errors(chunk_starts.size() - 1);
+        parallel_for_range(
+            size_t(0),
+            chunk_starts.size() - 1,
+            [&](size_t c) {
+                try {
+                    std::vector<uint8_t> table;
+                    uint64_t length = 0;
+                    for (size_t i = chunk_starts[c]; i < chunk_starts[c + 1]; ++i) {
+                        uint64_t const chunk = reads[i].chunk;
+                        uint64_t const begin = plot_file_header_->offsets[chunk];
+                        if (reads[i].block == kWholeChunk) {
+                            extents[i]
+                                = { begin, begin + sizeof(uint64_t) + chunkCapacity_(chunk) };
+                            continue;
+                        }
+                        if (table.empty()) {
+                            length = readSeekTable_(chunk, table);
+                        }
+                        auto const [offset, size]
+                            = seekBlockExtent_(chunk, reads[i].block, table, length);
+                        uint64_t const block_begin = begin + sizeof(uint64_t) + offset;
+                        extents[i] = { block_begin, block_begin + size };
+                    }
+                }
+                catch (...) {
+                    errors[c] = std::current_exception();
+                }
+            },
+            MAX_CONCURRENT_READS);
+        for (std::exception_ptr const& error: errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        return extents;
+    }
+
+    // Decodes a read from its bytes at its extent (see readExtents_).
+    std::vector<ProofFragment> decodeReadBytes_(
+        ChunkRead const& read, std::span<uint8_t const> bytes) const
+    {
+        if (read.block != kWholeChunk) {
+            return decodeSeekBlock_(read.chunk, read.block, bytes);
+        }
+        uint64_t length = 0;
+        std::memcpy(&length, bytes.data(), sizeof(length));
+        if (length > bytes.size() - sizeof(length)) {
+            throw chunkReadError_(read.chunk);
+        }
+        return decompressChunk_(bytes.subspan(sizeof(length), length), read.chunk);
+    }
+
     std::string filename_;
+    ReadMethod read_method_;
     std::optional<PlotFileHeader> plot_file_header_;
+    // Opened with the header and read by every thread (pread); shared so PlotFile stays copyable.
+    std::shared_ptr<PositionalFile const> file_;
+    // Shared so PlotFile stays copyable; the mapping is read-only.
+    std::shared_ptr<MappedFile const> mapping_;
+    std::shared_ptr<ChunkCache> chunk_cache_;
 };
@@ -11,6 +11,12 @@
 #include "LayoutPlanner.hpp"
 #include "TableConstructorGeneric.hpp"
 
+// Placement of all plotting buffers inside one allocation.
+//
+// Offsets come from a liveness plan (see LivenessLayoutSolver): every table has an `out` buffer
+// written during matching and sorted in place afterwards (RadixSort::sort_in_place), and a target
+// scratch region for the sorted L entries while matching. A table's `out` stays alive until
+// the next table has been matched (for T3, until the fragments are copied out).
 struct PlotLayout {
     std::size_t max_section_pairs = 0;
     std::size_t num_sections = 0;
@@ -19,16 +25,14 @@ struct PlotLayout {
     std::size_t max_element_bytes = 0;
     std::size_t minor_scratch_bytes = 0;
 
-    std::size_t num_blocks = 32;
+    // Reporting unit only: a block is a quarter section of the largest element type.
+    std::size_t num_blocks = 0;
     std::size_t block_size_bytes = 0;
     std::size_t total_bytes = 0;
 
-    // ---- storage ----
-    LayoutPlanner mem;
-    ResettableArenaResource minor_scratch;
-    ResettableArenaResource target_scratch;
-
     static constexpr std::size_t kPlanAlign = 64;
+    // Headroom in target scratch for split tables and alignment.
+    static constexpr std::size_t kTargetSlackBytes = 64 * 1024;
 
     static constexpr std::size_t align_up(std::size_t x, std::size_t a)
     {
@@ -36,95 +40,189 @@ struct PlotLayout {
     }
 
     // ============================================================
-    // 1) Named slots: a single source of truth for block usage
+    // 1) Liveness plan
     // ============================================================
-    enum class BlockSlot : std::uint8_t {
-        // primary outputs (often share block 0)
-        PrimaryOut, // block used for “out” spans (t1/t2/t3 all reuse)
-        XsPostSortTmp, // Xs phase
-        T1PostSortTmp, // T1 phase
-        T1TargetScratch, // start block of target scratch for T1
-        T2PostSortTmp, // T2 phase
-        T2TargetScratch, // start block of target scratch for T2
-        T3PostSortTmp, // T3 phase
-        T3TargetScratch, // start block of target scratch for T3
-        _Count
-    };
 
-    static constexpr std::size_t kNumSlots = static_cast<std::size_t>(BlockSlot::_Count);
+    // Pipeline steps, used as buffer lifetimes.
+    enum Step : int {
+        XsHash = 0,
+        XsSort,
+        T1Match,
+        T1Sort,
+        T2Match,
+        T2Sort,
+        T3Match,
+        T3Sort,
+        CopyOut,
+    };
 
-    static constexpr std::size_t to_index(BlockSlot s) { return static_cast<std::size_t>(s); }
+    struct TablePlan {
+        std::size_t element_bytes = 0;
+        std::size_t out_offset = 0;
+        std::size_t target_offset = 0;
+        std::size_t target_bytes = 0; // 0 for Xs
+        uint32_t l_chunks = 1; // see TableConstructorGeneric::set_l_chunks
+    };
 
-    // This table determines whole layout
-    static constexpr std::array<std::size_t, kNumSlots> kSlotToBlock = {
-        /* PrimaryOut      */ 0,
-        /* XsPostSortTmp   */ 24,
-        /* T1PostSortTmp   */ 14,
-        /* T1TargetScratch */ 20,
-        /* T2PostSortTmp   */ 16,
-        /* T2TargetScratch */ 26,
-        /* T3PostSortTmp   */ 8,
-        /* T3TargetScratch */ 8, // target scratch not used once post sort tmp kicks in
+    struct Plan {
+        std::array<TablePlan, 4> tables {}; // indexed by table id, 0 = Xs
+        std::size_t planned_bytes = 0; // excluding minor scratch
+        std::size_t lower_bound_bytes = 0; // peak of simultaneously live bytes
+        LivenessLayoutSolver solver; // placed buffers, for inspection
     };
 
-    std::size_t block_pos(std::size_t block_index) const { return block_index * block_size_bytes; }
+    // Element size of a table's entries (0 = Xs).
+    static std::size_t table_element_bytes(int table_id)
+    {
+        switch (table_id) {
+        case 0:
+            return sizeof(Xs_Candidate);
+        case 1:
+            return sizeof(T1Pairing);
+        case 2:
+            return sizeof(T2Pairing);
+        default:
+            return sizeof(T3Pairing);
+        }
+    }
+
+    // Bytes per sorted L entry while matching a table (1..3); T2 and T3 sort (target, index)
+    // entries instead of whole candidates.
+    static std::size_t l_target_bytes(int table_id)
+    {
+        switch (table_id) {
+        case 1:
+            return Table1Constructor::kLTargetBytes;
+        case 2:
+            return Table2Constructor::kLTargetBytes;
+        default:
+            return Table3Constructor::kLTargetBytes;
+        }
+    }
+
+    // Target scratch of a table: sorted L entries + radix tmp for one L chunk.
+    static std::size_t target_scratch_bytes(
+        std::size_t max_section_pairs_, int table_id, uint32_t l_chunks)
+    {
+        std::size_t const l_chunk = (max_section_pairs_ + l_chunks - 1) / l_chunks;
+        return 2 * align_up(l_chunk * l_target_bytes(table_id), kPlanAlign) + kTargetSlackBytes;
+    }
+
+    // Smallest layout over the L chunk counts that keep matching from setting the peak; fewer
+    // chunks win ties.
+    static Plan plan(ProofParams const& params)
+    {
+        static constexpr uint32_t kChunkOptions[] = { 1, 2, 4, 8 };
+
+        Plan best = plan_with_chunks(params, { 1, 1, 1, 1 });
+        uint32_t best_chunks = 3;
+        for (uint32_t c1: kChunkOptions) {
+            for (uint32_t c2: kChunkOptions) {
+                for (uint32_t c3: kChunkOptions) {
+                    Plan p = plan_with_chunks(params, { 1, c1, c2, c3 });
+                    uint32_t const chunks = c1 + c2 + c3;
+                    if (p.planned_bytes < best.planned_bytes
+                        || (p.planned_bytes == best.planned_bytes && chunks < best_chunks)) {
+                        best = std::move(p);
+                        best_chunks = chunks;
+                    }
+                }
+            }
+        }
+        return best;
+    }
+
+    static Plan plan_with_chunks(ProofParams const& params, std::array<uint32_t, 4> l_chunks)
+    {
+        static constexpr Step kMatchStep[4] = { XsHash, T1Match, T2Match, T3Match };
+        static constexpr char const* kOutName[4] = { "xs.out", "t1.out", "t2.out", "t3.out" };
+        static constexpr char const* kTargetName[4] = { "", "t1.target", "t2.target", "t3.target" };
+
+        std::size_t const section_pairs = max_pairs_per_section_possible(params);
+        std::size_t const pairs = section_pairs * params.get_num_sections();
+
+        Plan plan { .solver = LivenessLayoutSolver(kPlanAlign) };
+        std::array<std::size_t, 4> out_id {}, target_id {};
+        for (int t = 0; t < 4; ++t) {
+            auto& tp = plan.tables[static_cast<std::size_t>(t)];
+            tp.element_bytes = table_element_bytes(t);
+            tp.l_chunks = l_chunks[static_cast<std::size_t>(t)];
+
+            // the sorted table is read by the next table's matching, T3 by the final copy-out
+            int const last_use = (t == 3) ? CopyOut : kMatchStep[t + 1];
+            out_id[t] = plan.solver.add(
+                kOutName[t], pairs * tp.element_bytes, kMatchStep[t], last_use);
+            if (t > 0) {
+                tp.target_bytes = target_scratch_bytes(section_pairs, t, tp.l_chunks);
+                target_id[t] = plan.solver.add(
+                    kTargetName[t], tp.target_bytes, kMatchStep[t], kMatchStep[t]);
+            }
+        }
+
+        plan.planned_bytes = plan.solver.solve();
+        plan.lower_bound_bytes = plan.solver.lower_bound_bytes();
+        for (int t = 0; t < 4; ++t) {
+            auto& tp = plan.tables[static_cast<std::size_t>(t)];
+            tp.out_offset = plan.solver.buffer(out_id[t]).offset;
+            if (t > 0)
+                tp.target_offset = plan.solver.buffer(target_id[t]).offset;
+        }
+        return plan;
+    }
+
+    static constexpr std::size_t block_bytes(
+        std::size_t max_section_pairs_, std::size_t max_element_bytes_)
+    {
+        return align_up((max_section_pairs_ * max_element_bytes_) / 4, kPlanAlign);
+    }
+
+    // Bytes a layout for these parameters allocates, without allocating it.
+    static std::size_t bytes_required(ProofParams const& params, std::size_t minor_scratch_bytes_)
+    {
+        return plan(params).planned_bytes + minor_scratch_bytes_;
+    }
 
-    std::size_t slot_pos(BlockSlot slot) const { return block_pos(kSlotToBlock[to_index(slot)]); }
+    // ---- storage ----
+    Plan layout_plan;
+    LayoutPlanner mem;
+    ResettableArenaResource minor_scratch;
+    ResettableArenaResource target_scratch;
 
     // ============================================================
     // Phase view structs
     // ============================================================
     struct XsViews {
-        std::span<Xs_Candidate> out;
-        std::span<Xs_Candidate> post_sort_tmp;
-        ResettableArenaResource& minor;
-    };
-
-    struct T1Views {
-        std::span<T1Pairing> out;
-        std::span<T1Pairing> post_sort_tmp;
-        ResettableArenaResource& target;
+        std::span<Xs_Candidate> out; // sorted in place
         ResettableArenaResource& minor;
     };
 
-    struct T2Views {
-        std::span<T2Pairing> out;
-        std::span<T2Pairing> post_sort_tmp;
+    template <typename T>
+    struct TableViews {
+        std::span<T> out; // sorted in place
         ResettableArenaResource& target;
         ResettableArenaResource& minor;
+        uint32_t l_chunks;
     };
 
-    struct T3Views {
-        std::span<T3Pairing> out;
-        std::span<T3Pairing> post_sort_tmp;
-        ResettableArenaResource& target;
-        ResettableArenaResource& minor;
-    };
+    using T1Views = TableViews<T1Pairing>;
+    using T2Views = TableViews<T2Pairing>;
+    using T3Views = TableViews<T3Pairing>;
 
-    PlotLayout(std::size_t max_section_pairs_,
-        std::size_t num_sections_,
-        std::size_t max_element_bytes_,
-        std::size_t minor_scratch_bytes_,
-        std::size_t num_blocks_ = 32)
-        : max_section_pairs(max_section_pairs_)
-        , num_sections(num_sections_)
-        , max_pairs(max_section_pairs_ * num_sections_)
-        , max_element_bytes(max_element_bytes_)
+    PlotLayout(ProofParams const& params, std::size_t minor_scratch_bytes_)
+        : max_section_pairs(max_pairs_per_section_possible(params))
+        , num_sections(params.get_num_sections())
+        , max_pairs(max_section_pairs * num_sections)
+        , max_element_bytes(std::max(
+              { sizeof(Xs_Candidate), sizeof(T1Pairing), sizeof(T2Pairing), sizeof(T3Pairing) }))
         , minor_scratch_bytes(minor_scratch_bytes_)
-        , num_blocks(num_blocks_)
-        , block_size_bytes(0)
-        , total_bytes(0)
-        , mem(0) // replaced below
+        , layout_plan(plan(params))
+        , mem(layout_plan.planned_bytes + minor_scratch_bytes_)
         , minor_scratch()
         , target_scratch()
     {
-        // Your original sizing, but aligned up so typed spans are more likely aligned.
-        std::size_t raw_block = (max_section_pairs * max_element_bytes) / 4;
-        block_size_bytes = align_up(raw_block, kPlanAlign);
-
-        total_bytes = block_size_bytes * num_blocks + minor_scratch_bytes;
-
-        mem = LayoutPlanner(total_bytes);
+        total_bytes = layout_plan.planned_bytes + minor_scratch_bytes;
+        block_size_bytes = block_bytes(max_section_pairs, max_element_bytes);
+        num_blocks = (layout_plan.planned_bytes + block_size_bytes - 1) / block_size_bytes;
 
         // bind minor scratch once at end
         auto minor_off = total_bytes - minor_scratch_bytes;
@@ -139,54 +237,15 @@ struct PlotLayout {
     // ============================================================
     XsViews xs()
     {
-        auto out = mem.span<Xs_Candidate>(slot_pos(BlockSlot::PrimaryOut), max_pairs);
-        auto post_sort_tmp = mem.span<Xs_Candidate>(slot_pos(BlockSlot::XsPostSortTmp), max_pairs);
-
-        minor_scratch.reset();
-        return { out, post_sort_tmp, minor_scratch };
-    }
-
-    T1Views t1()
-    {
-        auto out = mem.span<T1Pairing>(slot_pos(BlockSlot::PrimaryOut), max_pairs);
-        auto post_sort_tmp = mem.span<T1Pairing>(slot_pos(BlockSlot::T1PostSortTmp), max_pairs);
-
-        target_scratch.rebind(
-            static_cast<std::byte*>(mem.data()) + slot_pos(BlockSlot::T1TargetScratch),
-            block_size_bytes * 4);
-        target_scratch.reset();
-        minor_scratch.reset();
-
-        return { out, post_sort_tmp, target_scratch, minor_scratch };
-    }
-
-    T2Views t2()
-    {
-        auto out = mem.span<T2Pairing>(slot_pos(BlockSlot::PrimaryOut), max_pairs);
-        auto post_sort_tmp = mem.span<T2Pairing>(slot_pos(BlockSlot::T2PostSortTmp), max_pairs);
-
-        target_scratch.rebind(
-            static_cast<std::byte*>(mem.data()) + slot_pos(BlockSlot::T2TargetScratch),
-            block_size_bytes * 6);
-        target_scratch.reset();
+        auto const& tp = layout_plan.tables[0];
         minor_scratch.reset();
-
-        return { out, post_sort_tmp, target_scratch, minor_scratch };
+        minor_scratch.reset_phase_peak();
+        return { mem.span<Xs_Candidate>(tp.out_offset, max_pairs), minor_scratch };
     }
 
-    T3Views t3()
-    {
-        auto out = mem.span<T3Pairing>(slot_pos(BlockSlot::PrimaryOut), max_pairs);
-        auto post_sort_tmp = mem.span<T3Pairing>(slot_pos(BlockSlot::T3PostSortTmp), max_pairs);
-
-        target_scratch.rebind(
-            static_cast<std::byte*>(mem.data()) + slot_pos(BlockSlot::T3TargetScratch),
-            block_size_bytes * 8);
-        target_scratch.reset();
-        minor_scratch.reset();
-
-        return { out, post_sort_tmp, target_scratch, minor_scratch };
-    }
+    T1Views t1() { return table_views<T1Pairing>(1); }
+    T2Views t2() { return table_views<T2Pairing>(2); }
+    T3Views t3() { return table_views<T3Pairing>(3); }
 
     // ============================================================
     // Debug: memory stats
@@ -206,6 +265,12 @@ struct PlotLayout {
         os << "  num_blocks                   : " << num_blocks << "\n";
         os << "  minor_scratch_bytes          : " << minor_scratch_bytes << " bytes\n";
         os << "  total_bytes                  : " << total_bytes << " bytes\n";
+        os << "  planned peak / lower bound   : " << layout_plan.planned_bytes << " / "
+           << layout_plan.lower_bound_bytes << " bytes\n";
+        for (auto const& b: layout_plan.solver.buffers()) {
+            os << "    " << b.name << " @" << b.offset << " +" << b.bytes << " steps "
+               << b.first_step << ".." << b.last_step << "\n";
+        }
         os << "----- lifetime high watermarks -----\n";
         os << "  Lifetime minor scratch max used : "
            << minor_scratch.lifetime_high_watermark_bytes() << " bytes\n";
@@ -221,4 +286,21 @@ struct PlotLayout {
 
     // call after construction
     std::size_t total_bytes_allocated() const noexcept { return mem.size_bytes(); }
+
+private:
+    template <typename T>
+    TableViews<T> table_views(int table_id)
+    {
+        auto const& tp = layout_plan.tables[static_cast<std::size_t>(table_id)];
+
+        target_scratch.rebind(
+            static_cast<std::byte*>(mem.data()) + tp.target_offset, tp.target_bytes);
+        target_scratch.reset();
+        minor_scratch.reset();
+        target_scratch.reset_phase_peak();
+        minor_scratch.reset_phase_peak();
+
+        return { mem.span<T>(tp.out_offset, max_pairs), target_scratch, minor_scratch,
+            tp.l_chunks };
+    }
 };
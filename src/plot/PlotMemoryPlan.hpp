@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+#include "LayoutPlanner.hpp"
+#include "PlotLayout.hpp"
+#include "RadixSort.hpp"
+#include "TableConstructorGeneric.hpp"
+#include "pos/ProofCore.hpp"
+
+// Memory plan for a plotting run under a RAM budget.
+//
+// Without a budget (or when the budget covers it) the plotter uses the default planned
+// PlotLayout. Below that, tables are built in streaming mode:
+//   - each table is constructed in `output_passes` passes, pass p only keeping pairs whose output
+//     section falls in its share of the sections. Every pass redoes the full matching, and its
+//     sorted output is appended to a spill file on disk, so only 1/output_passes of the output and
+//     post-sort buffers are resident.
+//   - each L section is matched in `l_chunks` chunks, shrinking the target scratch.
+//   - once a table is complete its spill file is read back as the input of the next table.
+//   - the buffer is freed before the final fragments are read out of the T3 spill, block by block.
+// The input table of the phase being built always stays resident, so the smallest possible plan
+// is bounded below by the largest table (T2). Every peak also counts the heap scratch the radix
+// sorts take per thread, outside the plotting buffer.
+struct PlotMemoryPlan {
+    static constexpr std::size_t kMinorScratchBytes = 2048 * 1024;
+    static constexpr std::size_t kAlign = PlotLayout::kPlanAlign;
+    static constexpr uint32_t kMaxLChunks = 64;
+
+    struct TablePasses {
+        uint32_t output_passes = 1; // construct() runs, one per output section range
+        uint32_t l_chunks = 1; // L chunks per (section, match key)
+        std::size_t peak_bytes = 0; // resident plotting buffer while this table is built
+    };
+
+    bool streaming = false; // false: default in-memory PlotLayout
+    bool feasible = true; // false: budget is below min_peak_bytes
+    std::size_t budget_bytes = 0; // 0 = unlimited
+    std::size_t peak_bytes = 0; // expected peak of plotting buffers + final fragments
+    std::size_t sort_scratch_bytes = 0; // part of each peak: radix sort heap scratch
+    std::size_t default_peak_bytes = 0; // peak when using the default layout
+    std::size_t min_peak_bytes = 0; // smallest budget this plot can run with
+    std::array<TablePasses, 4> tables {}; // indexed by table id, 0 = Xs
+
+    // Number of table construction passes over T1..T3 (3 for the default layout).
+    uint32_t total_passes() const
+    {
+        return tables[1].output_passes + tables[2].output_passes + tables[3].output_passes;
+    }
+
+    // Plotting buffer of a streaming run (StreamingPlotLayout), without the sort scratch.
+    std::size_t buffer_bytes() const { return peak_bytes - sort_scratch_bytes; }
+
+    // Heap scratch of one sorting thread (see RadixSort::heap_bytes_per_thread), for the widest
+    // of the element types the plotter sorts.
+    static std::size_t sort_scratch_bytes_per_thread()
+    {
+        return std::max({ RadixSort<Xs_Candidate, uint32_t>::heap_bytes_per_thread(),
+            RadixSort<LTargetIndex, uint32_t>::heap_bytes_per_thread(),
+            RadixSort<T1Pairing, uint32_t>::heap_bytes_per_thread(),
+            RadixSort<T2Pairing, uint32_t>::heap_bytes_per_thread(),
+            RadixSort<T3Pairing, uint64_t, decltype(&T3Pairing::proof_fragment)>::
+                heap_bytes_per_thread() });
+    }
+
+    static std::size_t max_element_bytes()
+    {
+        return std::max(
+            { sizeof(Xs_Candidate), sizeof(T1Pairing), sizeof(T2Pairing), sizeof(T3Pairing) });
+    }
+
+    // Element size of the sorted output of a table (0 = Xs).
+    static std::size_t element_bytes(int table_id)
+    {
+        return PlotLayout::table_element_bytes(table_id);
+    }
+
+    // Region offsets of a streaming phase, shared by the planner and StreamingPlotLayout.
+    //   [0, in_bytes)                      previous table (input)
+    //   [out_offset, work_offset)          output of the current pass, sorted in place
+    //   [work_offset, end)                 target scratch while matching
+    struct StreamingPhase {
+        std::size_t in_bytes = 0;
+        std::size_t out_offset = 0;
+        std::size_t part_capacity = 0; // output entries per pass
+        std::size_t work_offset = 0;
+        std::size_t work_bytes = 0;
+        std::size_t end = 0;
+    };
+
+    static StreamingPhase streaming_phase(
+        ProofParams const& params, int table_id, uint32_t output_passes, uint32_t l_chunks)
+    {
+        std::size_t const max_section_pairs = max_pairs_per_section_possible(params);
+        std::size_t const num_sections = params.get_num_sections();
+        std::size_t const max_pairs = max_section_pairs * num_sections;
+
+        StreamingPhase p;
+        if (table_id == 0) {
+            // Xs is generated and sorted whole.
+            p.in_bytes = 0;
+            p.out_offset = 0;
+            p.part_capacity = max_pairs;
+            p.work_offset = align(max_pairs * sizeof(Xs_Candidate));
+            p.work_bytes = 0;
+            p.end = p.work_offset;
+            return p;
+        }
+
+        std::size_t const in_elem = element_bytes(table_id - 1);
+        std::size_t const out_elem = element_bytes(table_id);
+
+        p.in_bytes = align(max_pairs * in_elem);
+        p.out_offset = p.in_bytes;
+        p.part_capacity = (num_sections / output_passes) * max_section_pairs;
+        p.work_offset = p.out_offset + align(p.part_capacity * out_elem);
+        p.work_bytes
+            = align(PlotLayout::target_scratch_bytes(max_section_pairs, table_id, l_chunks));
+        p.end = p.work_offset + p.work_bytes;
+        return p;
+    }
+
+    static PlotMemoryPlan make(ProofParams const& params, std::size_t budget_bytes)
+    {
+        std::size_t const max_section_pairs = max_pairs_per_section_possible(params);
+        std::size_t const num_sections = params.get_num_sections();
+        std::size_t const max_pairs = max_section_pairs * num_sections;
+        // The final fragments are copied out while the default layout is still alive. Streaming
+        // frees its buffer first and then reads them out of the T3 spill through a block of
+        // kMinorScratchBytes.
+        std::size_t const fragments_bytes = max_pairs * sizeof(ProofFragment);
+
+        PlotMemoryPlan plan;
+        plan.budget_bytes = budget_bytes;
+        plan.sort_scratch_bytes
+            = std::max(1u, std::thread::hardware_concurrency()) * sort_scratch_bytes_per_thread();
+        plan.default_peak_bytes = PlotLayout::bytes_required(params, kMinorScratchBytes)
+            + fragments_bytes + plan.sort_scratch_bytes;
+
+        auto const streaming_peak = [&](std::size_t phases_bytes) {
+            return std::max(phases_bytes, fragments_bytes) + kMinorScratchBytes
+                + plan.sort_scratch_bytes;
+        };
+
+        std::size_t const xs_bytes = streaming_phase(params, 0, 1, 1).end;
+        std::size_t min_phases = xs_bytes;
+        for (int t = 1; t <= 3; ++t) {
+            min_phases = std::max(min_phases,
+                streaming_phase(params, t, static_cast<uint32_t>(num_sections), kMaxLChunks).end);
+        }
+        plan.min_peak_bytes = std::min(plan.default_peak_bytes, streaming_peak(min_phases));
+
+        if (budget_bytes == 0 || budget_bytes >= plan.default_peak_bytes) {
+            plan.peak_bytes = plan.default_peak_bytes;
+            for (auto& t: plan.tables)
+                t.peak_bytes = plan.default_peak_bytes;
+            return plan;
+        }
+
+        plan.streaming = true;
+        plan.tables[0].peak_bytes = streaming_peak(xs_bytes);
+        plan.feasible = plan.tables[0].peak_bytes <= budget_bytes;
+
+        // Prefer fewer output passes (each one recomputes the whole matching), then fewer L
+        // chunks (each one rescans R).
+        std::size_t phases = xs_bytes;
+        for (int t = 1; t <= 3; ++t) {
+            TablePasses best { static_cast<uint32_t>(num_sections), kMaxLChunks, 0 };
+            bool found = false;
+            for (uint32_t passes = 1; passes <= num_sections && !found; passes *= 2) {
+                for (uint32_t chunks = 1; chunks <= kMaxLChunks && !found; chunks *= 2) {
+                    std::size_t const end = streaming_phase(params, t, passes, chunks).end;
+                    if (streaming_peak(end) <= budget_bytes) {
+                        best = TablePasses { passes, chunks, 0 };
+                        found = true;
+                    }
+                }
+            }
+            std::size_t const end
+                = streaming_phase(params, t, best.output_passes, best.l_chunks).end;
+            best.peak_bytes = streaming_peak(end);
+            plan.tables[static_cast<std::size_t>(t)] = best;
+            plan.feasible = plan.feasible && found;
+            phases = std::max(phases, end);
+        }
+        plan.peak_bytes = streaming_peak(phases);
+        return plan;
+    }
+
+private:
+    static constexpr std::size_t align(std::size_t x) { return PlotLayout::align_up(x, kAlign); }
+};
+
+// Single buffer sized by a streaming PlotMemoryPlan. Every phase reads its input table from the
+// front of the buffer, which is also where the completed table is loaded back from its spill file.
+struct StreamingPlotLayout {
+    template <typename In, typename Out>
+    struct PhaseViews {
+        std::span<Out> out; // one pass worth of output
+        ResettableArenaResource& target;
+        ResettableArenaResource& minor;
+    };
+
+    struct XsViews {
+        std::span<Xs_Candidate> out;
+        ResettableArenaResource& minor;
+    };
+
+    StreamingPlotLayout(ProofParams const& params, PlotMemoryPlan const& plan)
+        : params_(params)
+        , plan_(plan)
+        , max_pairs_(max_pairs_per_section_possible(params) * params.get_num_sections())
+        , mem(plan.buffer_bytes())
+    {
+        std::size_t const minor_off = plan.buffer_bytes() - PlotMemoryPlan::kMinorScratchBytes;
+        minor_scratch.rebind(static_cast<std::byte*>(mem.data()) + minor_off,
+            PlotMemoryPlan::kMinorScratchBytes);
+        target_scratch.rebind(mem.data(), 0);
+    }
+
+    // Full-capacity span at the front of the buffer, where a phase finds its input.
+    template <typename T>
+    std::span<T> input()
+    {
+        return mem.span<T>(0, max_pairs_);
+    }
+
+    XsViews xs()
+    {
+        auto const p = PlotMemoryPlan::streaming_phase(params_, 0, 1, 1);
+        minor_scratch.reset();
+        minor_scratch.reset_phase_peak();
+        return { mem.span<Xs_Candidate>(p.out_offset, p.part_capacity), minor_scratch };
+    }
+
+    template <typename In, typename Out>
+    PhaseViews<In, Out> phase(int table_id)
+    {
+        auto const& passes = plan_.tables[static_cast<std::size_t>(table_id)];
+        auto const p = PlotMemoryPlan::streaming_phase(
+            params_, table_id, passes.output_passes, passes.l_chunks);
+
+        target_scratch.rebind(static_cast<std::byte*>(mem.data()) + p.work_offset, p.work_bytes);
+        target_scratch.reset();
+        minor_scratch.reset();
+        target_scratch.reset_phase_peak();
+        minor_scratch.reset_phase_peak();
+
+        return { mem.span<Out>(p.out_offset, p.part_capacity), target_scratch, minor_scratch };
+    }
+
+    std::size_t total_bytes_allocated() const noexcept { return mem.size_bytes(); }
+
+private:
+    ProofParams params_;
+    PlotMemoryPlan plan_;
+    std::size_t max_pairs_;
+
+public:
+    LayoutPlanner mem;
+    ResettableArenaResource minor_scratch;
+    ResettableArenaResource target_scratch;
+};
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX 1
+#endif
+#include <Windows.h>
+#endif
+
+#include "Progress.hpp"
+#include "common/PerfCounters.hpp"
+
+// Per-phase performance summary of one plotting run, filled in when Plotter::Options::report is
+// set. The plotter also sends it to the progress sink as a NoteId::PlotReport note with the JSON
+// form in msg, and `plotter test --report-json <file>` writes it out.
+struct PlotReport {
+    struct Table {
+        uint64_t items_in = 0; // entries of the previous table (2^k for Xs)
+        uint64_t pairs_produced = 0; // entries of this table (summed over streaming passes)
+        uint64_t capacity = 0; // output slots of one construct() run
+        double capacity_used_pct = 0.0; // of the last construct() run
+        uint32_t passes = 0; // construct() runs (streaming output passes)
+
+        double wall_ms = 0.0; // steady clock
+        double cpu_ms = 0.0; // process CPU time, all threads (0 where unavailable)
+        double hash_ms = 0.0;
+        double sort_ms = 0.0; // L candidate sorts (Xs: the whole sort)
+        double find_pairs_ms = 0.0;
+        double post_sort_ms = 0.0;
+        double misc_ms = 0.0;
+
+        // Wall time per (section pair, match key) unit; max / mean measures load imbalance.
+        uint32_t match_keys = 0;
+        double match_key_total_ms = 0.0;
+        double match_key_max_ms = 0.0;
+        double match_key_min_ms = 0.0;
+
+        std::size_t target_scratch_peak_bytes = 0;
+        std::size_t minor_scratch_peak_bytes = 0;
+
+        // Hardware counters per phase (Options::perf_counters); Xs has hash and sort only.
+        PerfCounterValues hash_counters;
+        PerfCounterValues sort_counters;
+        PerfCounterValues find_pairs_counters;
+        PerfCounterValues post_sort_counters;
+
+        double match_key_mean_ms() const
+        {
+            return match_keys ? match_key_total_ms / match_keys : 0.0;
+        }
+        double match_key_imbalance() const
+        {
+            double const mean = match_key_mean_ms();
+            return mean > 0.0 ? match_key_max_ms / mean : 0.0;
+        }
+    };
+
+    int k = 0;
+    int strength = 0;
+    unsigned hardware_threads = 0;
+    bool streaming = false;
+    char const* pair_join = "sort";
+    bool wavefront = false;
+    bool perf_counters = false; // hardware counters were requested and could be opened
+    std::size_t allocated_bytes = 0;
+
+    double wall_ms = 0.0;
+    double cpu_ms = 0.0;
+    std::array<Table, 4> tables {}; // by table id, 0 = Xs
+
+    // Busy fraction of the hardware threads over a wall/CPU time pair (1.0 = all busy).
+    double thread_utilization(double wall, double cpu) const
+    {
+        return (wall > 0.0 && hardware_threads > 0) ? cpu / (wall * hardware_threads) : 0.0;
+    }
+
+    std::string to_json() const
+    {
+        std::ostringstream os;
+        os << std::setprecision(6);
+        os << "{\"k\":" << k << ",\"strength\":" << strength
+           << ",\"hardware_threads\":" << hardware_threads
+           << ",\"streaming\":" << (streaming ? "true" : "false") << ",\"pair_join\":\""
+           << pair_join << "\",\"wavefront\":" << (wavefront ? "true" : "false")
+           << ",\"perf_counters\":" << (perf_counters ? "true" : "false")
+           << ",\"allocated_bytes\":" << allocated_bytes << ",\"wall_ms\":" << wall_ms
+           << ",\"cpu_ms\":" << cpu_ms
+           << ",\"thread_utilization\":" << thread_utilization(wall_ms, cpu_ms) << ",\"tables\":[";
+        for (std::size_t t = 0; t < tables.size(); ++t) {
+            Table const& tb = tables[t];
+            os << (t ? "," : "") << "{\"table_id\":" << t << ",\"items_in\":" << tb.items_in
+               << ",\"pairs_produced\":" << tb.pairs_produced << ",\"capacity\":" << tb.capacity
+               << ",\"capacity_used_pct\":" << tb.capacity_used_pct
+               << ",\"passes\":" << tb.passes << ",\"wall_ms\":" << tb.wall_ms
+               << ",\"cpu_ms\":" << tb.cpu_ms
+               << ",\"thread_utilization\":" << thread_utilization(tb.wall_ms, tb.cpu_ms)
+               << ",\"hash_ms\":" << tb.hash_ms << ",\"sort_ms\":" << tb.sort_ms
+               << ",\"find_pairs_ms\":" << tb.find_pairs_ms
+               << ",\"post_sort_ms\":" << tb.post_sort_ms << ",\"misc_ms\":" << tb.misc_ms
+               << ",\"match_keys\":" << tb.match_keys
+               << ",\"match_key_mean_ms\":" << tb.match_key_mean_ms()
+               << ",\"match_key_min_ms\":" << tb.match_key_min_ms
+               << ",\"match_key_max_ms\":" << tb.match_key_max_ms
+               << ",\"match_key_imbalance\":" << tb.match_key_imbalance()
+               << ",\"target_scratch_peak_bytes\":" << tb.target_scratch_peak_bytes
+               << ",\"minor_scratch_peak_bytes\":" << tb.minor_scratch_peak_bytes;
+            if (perf_counters) {
+                os << ",\"counters\":{\"hash\":{" << tb.hash_counters.json_fields()
+                   << "},\"sort\":{" << tb.sort_counters.json_fields() << "},\"find_pairs\":{"
+                   << tb.find_pairs_counters.json_fields() << "},\"post_sort\":{"
+                   << tb.post_sort_counters.json_fields() << "}}";
+            }
+            os << "}";
+        }
+        os << "]}";
+        return os.str();
+    }
+};
+
+// CPU time used by all threads of the process so far, in nanoseconds; 0 where the platform has no
+// such clock. std::clock would be CPU time on POSIX but wall time on Windows.
+inline uint64_t process_cpu_time_ns()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    timespec ts {};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+#elif defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return 0;
+    auto const ticks = [](FILETIME const& t) {
+        return (uint64_t(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+    };
+    return (ticks(kernel) + ticks(user)) * 100; // 100 ns ticks
+#else
+    return 0;
+#endif
+}
+
+// Forwards every event to `next` and takes the event-derived parts of a PlotReport on the way:
+// plot and table wall times (the events' steady-clock elapsed), process CPU times and the per
+// match key times.
+class PlotReportCollector final : public IProgressSink {
+public:
+    PlotReportCollector(IProgressSink& next, PlotReport& report)
+        : next_(next)
+        , report_(report)
+    {
+    }
+
+    bool on_event(ProgressEvent const& e) noexcept override
+    {
+        switch (e.kind) {
+        case EventKind::PlotBegin:
+            plot_cpu_start_ = process_cpu_time_ns();
+            break;
+        case EventKind::PlotEnd:
+            report_.wall_ms = ms_(e.elapsed);
+            report_.cpu_ms = cpu_ms_since_(plot_cpu_start_);
+            break;
+        case EventKind::TableBegin:
+            if (e.table_id < report_.tables.size()) {
+                table_cpu_start_ = process_cpu_time_ns();
+                report_.tables[e.table_id].items_in = e.num_items_in;
+                report_.tables[e.table_id].passes++;
+            }
+            break;
+        case EventKind::TableEnd:
+            if (e.table_id < report_.tables.size()) {
+                report_.tables[e.table_id].wall_ms += ms_(e.elapsed);
+                report_.tables[e.table_id].cpu_ms += cpu_ms_since_(table_cpu_start_);
+            }
+            break;
+        case EventKind::Note:
+            if (e.note_id == NoteId::LayoutTotalBytesAllocated)
+                report_.allocated_bytes = e.u64_0;
+            break;
+        case EventKind::MatchKeyEnd:
+            if (e.table_id < report_.tables.size()) {
+                auto& t = report_.tables[e.table_id];
+                double const ms = ms_(e.elapsed);
+                t.match_key_min_ms = t.match_keys ? std::min(t.match_key_min_ms, ms) : ms;
+                t.match_key_max_ms = std::max(t.match_key_max_ms, ms);
+                t.match_key_total_ms += ms;
+                t.match_keys++;
+            }
+            break;
+        default:
+            break;
+        }
+        return next_.on_event(e);
+    }
+
+private:
+    static double ms_(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+    static double cpu_ms_since_(uint64_t start_ns) { return ms_(process_cpu_time_ns() - start_ns); }
+
+    IProgressSink& next_;
+    PlotReport& report_;
+    uint64_t plot_cpu_start_ = 0;
+    uint64_t table_cpu_start_ = 0;
+};
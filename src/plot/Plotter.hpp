@@ -5,17 +5,25 @@
 #include <cassert> // assert
 #include <cstdint>
 #include <cstdlib> // std::exit, std::strtol
+#include <filesystem>
 #include <iostream>
 #include <memory_resource>
 #include <optional>
+#include <random>
 #include <stdexcept> // std::runtime_error
 #include <string>
 #include <vector>
 
+#include "PlotCheckpoint.hpp"
 #include "PlotData.hpp"
 #include "PlotLayout.hpp"
+#include "PlotMemoryPlan.hpp"
+#include "PlotReport.hpp"
 #include "Progress.hpp"
+#include "SectionWavefront.hpp"
 #include "TableConstructorGeneric.hpp" // must come before PlotLayout.hpp (defines Xs_Candidate)
+#include "common/ParallelForRange.hpp"
+#include "common/PerfCounters.hpp"
 #include "common/Timer.hpp"
 #include "pos/ProofCore.hpp"
 
@@ -28,6 +36,36 @@ public:
         bool validate = false;
         bool verbose = false; // (kept for API compatibility; Plotter no longer prints)
         IProgressSink* sink = &null_progress_sink(); // optional
+
+        // When non-empty, the sorted output of Xs/T1/T2/T3 is written to this directory after each
+        // table completes, so an interrupted run can continue via resume().
+        std::string checkpoint_dir;
+        // Delete this plot's checkpoints from checkpoint_dir once the run completes.
+        bool remove_checkpoints_on_success = true;
+
+        // Upper bound on plotting memory in bytes, 0 = no limit. Below the default layout size
+        // tables are built in several passes and streamed through spill files, see
+        // PlotMemoryPlan. Use plan_memory() to check the cost before plotting.
+        std::size_t ram_budget_bytes = 0;
+        // Where streaming mode spills completed tables. Defaults to checkpoint_dir if set (the
+        // spill files then double as checkpoints), otherwise the system temp directory.
+        std::string spill_dir;
+
+        // How each table joins its L and R candidates; both produce the same plot.
+        PairJoin pair_join = PairJoin::SortMerge;
+
+        // Experimental: sort T1 and T2 section by section while the next table already matches
+        // the sections that are done (see SectionWavefront). Same plot. Only applies to the
+        // default in-memory layout without checkpoints, which need each table sorted whole.
+        bool wavefront = false;
+
+        // When set, receives a per-table performance report of the run (see PlotReport), which
+        // is also sent to the sink as a NoteId::PlotReport note.
+        PlotReport* report = nullptr;
+
+        // Count cycles, instructions, LLC and dTLB misses per phase (see PerfCounters.hpp) into
+        // the report and the trace spans, if the system allows it.
+        bool perf_counters = false;
     };
 
     // Construct with a hexadecimal plot ID, k parameter, and sub-k parameter
@@ -42,10 +80,94 @@ public:
     PlotData run() { return run(Options {}); }
 
     // Execute the plotting pipeline
-    PlotData run(Options opts)
+    PlotData run(Options opts) { return run_from_(std::nullopt, {}, opts); }
+
+    // Continue an interrupted run from a checkpoint written by a previous run with
+    // Options::checkpoint_dir set. The checkpoint must belong to the same plot (plot id, k,
+    // strength, testnet); plotting continues with the table after the checkpointed one.
+    PlotData resume(std::string const& checkpoint_file, Options opts)
+    {
+        PlotCheckpoint::Header const header = PlotCheckpoint::read_header(checkpoint_file);
+        PlotCheckpoint::validate(header, proof_params_);
+        return run_from_(header.stage, checkpoint_file, opts);
+    }
+
+    // Resume from the most advanced checkpoint in opts.checkpoint_dir, or start from scratch if
+    // there is none.
+    PlotData run_or_resume(Options opts)
+    {
+        if (!opts.checkpoint_dir.empty()) {
+            if (auto latest = PlotCheckpoint::find_latest(opts.checkpoint_dir, proof_params_))
+                return resume(*latest, opts);
+        }
+        return run(opts);
+    }
+
+    // Dry run: peak memory and number of passes a run with these options would use.
+    PlotMemoryPlan plan_memory(Options const& opts) const
+    {
+        return PlotMemoryPlan::make(proof_params_, opts.ram_budget_bytes);
+    }
+
+    ProofParams getProofParams() const { return proof_params_; }
+
+    void setValidate(bool validate) { validate_ = validate; }
+
+private:
+    // Proof fragments are copied out in blocks of this many entries, one block per task.
+    static constexpr std::size_t kCopyOutBlockElems = std::size_t(1) << 20;
+    // T3 pairings read back from disk per block, within the minor scratch the plan reserves.
+    static constexpr std::size_t kSpillReadBlockElems
+        = PlotMemoryPlan::kMinorScratchBytes / sizeof(T3Pairing);
+
+    PlotData run_from_(std::optional<CheckpointStage> resume_stage,
+        std::string const& resume_file,
+        Options opts)
+    {
+        std::optional<PerfCounterSession> perf;
+        if (opts.perf_counters && active_perf_counters() == nullptr)
+            perf.emplace();
+        if (opts.report == nullptr)
+            return plot_(resume_stage, resume_file, opts);
+
+        PlotReport& report = *opts.report;
+        report = PlotReport {};
+        report.k = proof_params_.get_k();
+        report.strength = proof_params_.get_strength();
+        report.hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+        report.streaming = plan_memory(opts).streaming;
+        report.pair_join = opts.pair_join == PairJoin::HashJoin ? "hash" : "sort";
+        report.wavefront = opts.wavefront && !report.streaming && opts.checkpoint_dir.empty();
+        report.perf_counters = active_perf_counters() != nullptr;
+
+        IProgressSink& user_sink = *opts.sink;
+        PlotReportCollector collector(user_sink, report);
+        opts.sink = &collector;
+        PlotData plot_data = plot_(resume_stage, resume_file, opts);
+
+        std::string const json = report.to_json();
+        user_sink.on_event(ProgressEvent {
+            .kind = EventKind::Note, .note_id = NoteId::PlotReport, .msg = json.c_str() });
+        return plot_data;
+    }
+
+    PlotData plot_(std::optional<CheckpointStage> resume_stage,
+        std::string const& resume_file,
+        Options const& opts)
     {
         IProgressSink& sink = *opts.sink;
 
+        auto const needs_stage = [&](CheckpointStage stage) {
+            return needs_stage_(resume_stage, stage);
+        };
+
+        PlotMemoryPlan const plan = plan_memory(opts);
+        if (!plan.feasible) {
+            throw std::runtime_error("RAM budget of " + std::to_string(opts.ram_budget_bytes)
+                + " bytes is below the minimum of " + std::to_string(plan.min_peak_bytes)
+                + " bytes for k" + std::to_string(proof_params_.get_k()));
+        }
+
         ScopedEvent plot_scope(sink, ProgressEvent { .kind = EventKind::PlotBegin });
         if (plot_scope.cancelled())
             return {};
@@ -62,70 +184,82 @@ public:
         sink.on_event(aes_event);
 #endif
 
+        if (!needs_stage(CheckpointStage::T3)) {
+            // Final table is already on disk, no need to allocate the plotting layout.
+            return finish_(read_t3_fragments_(resume_file), opts);
+        }
+
+        if (plan.streaming)
+            return run_streaming_(plan, resume_stage, resume_file, opts);
+
         size_t max_section_pairs = max_pairs_per_section_possible(proof_params_);
         size_t num_sections = static_cast<size_t>(proof_params_.get_num_sections());
         size_t max_pairs = max_section_pairs * num_sections;
 
-        size_t max_element_bytes = std::max(
-            { sizeof(Xs_Candidate), sizeof(T1Pairing), sizeof(T2Pairing), sizeof(T3Pairing) });
-
-        size_t minor_scratch_bytes = 2048 * 1024;
-
-        // Allocate layout under a scoped progress event + timer, without making PlotLayout a
-        // pointer.
-        auto layout = [&]() -> PlotLayout {
+        // Allocate layout under a scoped progress event + timer.
+        std::optional<PlotLayout> layout_storage;
+        {
             ScopedEvent alloc_scope(sink, ProgressEvent { .kind = EventKind::AllocationBegin });
             if (alloc_scope.cancelled())
-                return PlotLayout(0, 0, 0, 0); // or handle via exception/early return policy
+                return {};
 
-            PlotLayout l(max_section_pairs, num_sections, max_element_bytes, minor_scratch_bytes);
+            layout_storage.emplace(proof_params_, PlotMemoryPlan::kMinorScratchBytes);
 
             ProgressEvent alloc_end_event {
                 .kind = EventKind::Note,
                 .note_id = NoteId::LayoutTotalBytesAllocated,
-                .u64_0 = l.total_bytes_allocated(), // add generic fields, see below
+                .u64_0 = layout_storage->total_bytes_allocated(),
+                .u64_1 = layout_storage->num_blocks,
             };
             sink.on_event(alloc_end_event);
-
-            return l; // NRVO/move
-        }();
+        }
+        PlotLayout& layout = *layout_storage;
 
         auto xsV = layout.xs();
         XsConstructor xs_gen_ctor(proof_params_, sink);
-        auto xs_candidates = xs_gen_ctor.construct(xsV.out, xsV.post_sort_tmp, xsV.minor);
+        std::span<Xs_Candidate> xs_candidates;
+        if (needs_stage(CheckpointStage::Xs)) {
+            xs_candidates = xs_gen_ctor.construct(xsV.out, xsV.minor);
+            record_xs_(opts, xs_gen_ctor, xs_candidates.size(), xsV.minor);
 #if DEVELOPER_PERFORMANCE_TIMINGS
-        xs_gen_ctor.timings.show();
+            xs_gen_ctor.timings.show();
 #endif
-
-        // shouldn't happen for k28, but can happen on smaller k sizes.
-        if (xs_candidates.data() == xsV.out.data()) {
-            sink.on_event(ProgressEvent {
-                .kind = EventKind::Warning,
-                .msg = "Sub-optimal: copying Xs candidates to tmp buffer for Table 1 construction.",
-            });
-            std::copy(xsV.out.begin(), xsV.out.end(), xsV.post_sort_tmp.begin());
-            xs_candidates = xsV.post_sort_tmp.first(xs_candidates.size());
+            write_checkpoint_(opts, CheckpointStage::Xs, xs_candidates);
+        }
+        else if (*resume_stage == CheckpointStage::Xs) {
+            xs_candidates = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::Xs, xsV.out);
         }
 
+        bool const wavefront = opts.wavefront && opts.checkpoint_dir.empty();
+
         auto t1V = layout.t1();
         Table1Constructor t1_ctor(proof_params_, t1V.target, t1V.minor, sink);
-        auto t1_pairs = t1_ctor.construct(xs_candidates, t1V.out, t1V.post_sort_tmp);
+        t1_ctor.set_l_chunks(t1V.l_chunks);
+        t1_ctor.set_pair_join(opts.pair_join);
+        t1_ctor.set_defer_post_sort(wavefront);
+        std::span<T1Pairing> t1_pairs;
+        std::optional<SectionWavefront<T1Pairing>> t1_wave;
+        if (needs_stage(CheckpointStage::T1)) {
+            t1_pairs = t1_ctor.construct(xs_candidates, t1V.out);
+            record_table_(opts, 1, t1_ctor, t1_pairs.size(), t1V.out.size(), t1V);
+            if (wavefront)
+                t1_wave.emplace(t1_pairs, proof_params_, &t1V.minor);
 #if DEVELOPER_PERFORMANCE_TIMINGS
-        t1_ctor.timings.show("Table 1 Timings");
-        std::cout << "Percentage of Table 1 output capacity used: "
-                  << t1_ctor.percentage_capacity_used << " %\n";
+            t1_ctor.timings.show("Table 1 Timings");
+            std::cout << "Percentage of Table 1 output capacity used: "
+                      << t1_ctor.percentage_capacity_used << " %\n";
 #endif
 
-        assert(t1_pairs.size() <= max_pairs);
-        if (t1_pairs.size() > max_pairs) {
-            throw std::runtime_error("Table 1 construction exceeded allocated capacity.");
+            assert(t1_pairs.size() <= max_pairs);
+            if (t1_pairs.size() > max_pairs) {
+                throw std::runtime_error("Table 1 construction exceeded allocated capacity.");
+            }
+            write_checkpoint_(opts, CheckpointStage::T1, t1_pairs);
         }
-        if (t1_pairs.data() == t1V.out.data()) {
-#if DEVELOPER_PERFORMANCE_TIMINGS
-            std::cout << "Sub-optimal: copying T1 pairs to tmp buffer for Table 1 construction.\n";
-#endif
-            std::copy(t1V.out.begin(), t1V.out.end(), t1V.post_sort_tmp.begin());
-            t1_pairs = t1V.post_sort_tmp.first(t1_pairs.size());
+        else if (*resume_stage == CheckpointStage::T1) {
+            t1_pairs = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::T1, t1V.out);
         }
 
 #ifdef RETAIN_X_VALUES
@@ -147,13 +281,31 @@ public:
         // Table 2
         auto t2V = layout.t2();
         Table2Constructor t2_ctor(proof_params_, t2V.target, t2V.minor, sink);
-        auto t2_pairs = t2_ctor.construct(t1_pairs, t2V.out, t2V.post_sort_tmp);
+        t2_ctor.set_l_chunks(t2V.l_chunks);
+        t2_ctor.set_pair_join(opts.pair_join);
+        t2_ctor.set_defer_post_sort(wavefront);
+        std::span<T2Pairing> t2_pairs;
+        std::optional<SectionWavefront<T2Pairing>> t2_wave;
+        if (needs_stage(CheckpointStage::T2)) {
+            start_wavefront_(t1_wave, t2_ctor);
+            t2_pairs = t2_ctor.construct(t1_pairs, t2V.out);
+            t1_wave.reset();
+            record_table_(opts, 2, t2_ctor, t2_pairs.size(), t2V.out.size(), t2V);
+            if (wavefront)
+                t2_wave.emplace(t2_pairs, proof_params_, &t2V.minor);
 #if DEVELOPER_PERFORMANCE_TIMINGS
-        t2_ctor.timings.show("Table 2 Timings");
-        std::cout << "Percentage of Table 2 output capacity used: "
-                  << t2_ctor.percentage_capacity_used << " %\n";
-        std::cout << "Constructed " << t2_pairs.size() << " Table 2 pairs.\n";
+            t2_ctor.timings.show("Table 2 Timings");
+            std::cout << "Percentage of Table 2 output capacity used: "
+                      << t2_ctor.percentage_capacity_used << " %\n";
+            std::cout << "Constructed " << t2_pairs.size() << " Table 2 pairs.\n";
 #endif
+            assert(t2_pairs.size() <= max_pairs);
+            write_checkpoint_(opts, CheckpointStage::T2, t2_pairs);
+        }
+        else {
+            t2_pairs = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::T2, t2V.out);
+        }
 
 #ifdef RETAIN_X_VALUES
         if (validate_) {
@@ -169,20 +321,16 @@ public:
         }
 #endif
 
-        assert(t2_pairs.size() <= max_pairs);
-        if (t2_pairs.data() == t2V.out.data()) {
-#if DEVELOPER_PERFORMANCE_TIMINGS
-            std::cout << "NOTE Sub-optimal: copying T2 pairs to tmp buffer for Table 2 "
-                         "construction.\n";
-#endif
-            std::copy(t2V.out.begin(), t2V.out.end(), t2V.post_sort_tmp.begin());
-            t2_pairs = t2V.post_sort_tmp.first(t2_pairs.size());
-        }
-
         // Table 3
         auto t3V = layout.t3();
         Table3Constructor t3_ctor(proof_params_, t3V.target, t3V.minor, sink);
-        auto t3_results = t3_ctor.construct(t2_pairs, t3V.out, t3V.post_sort_tmp);
+        t3_ctor.set_l_chunks(t3V.l_chunks);
+        t3_ctor.set_pair_join(opts.pair_join);
+        start_wavefront_(t2_wave, t3_ctor);
+        auto t3_results = t3_ctor.construct(t2_pairs, t3V.out);
+        t2_wave.reset();
+        record_table_(opts, 3, t3_ctor, t3_results.size(), t3V.out.size(), t3V);
+        write_checkpoint_(opts, CheckpointStage::T3, t3_results);
 #if DEVELOPER_PERFORMANCE_TIMINGS
         t3_ctor.timings.show("Table 3 Timings:");
         std::cout << "Percentage of Table 3 output capacity used: "
@@ -227,23 +375,304 @@ public:
         total_timings.show("Total Plotting Timings:");
 #endif
 
+        return finish_(copy_out_(t3_results), opts);
+    }
+
+    // Lets `next` match the sections of a partitioned table as they get sorted.
+    template <typename T, typename Constructor>
+    static void start_wavefront_(std::optional<SectionWavefront<T>>& wave, Constructor& next)
+    {
+        if (!wave)
+            return;
+        wave->start(next.section_order());
+        next.set_section_gate([&wave](uint32_t section) { wave->wait_ready(section); });
+    }
+
+    // Report fields the constructors know; times and match key stats come from the events.
+    static void record_xs_(Options const& opts,
+        XsConstructor const& ctor,
+        std::size_t produced,
+        ResettableArenaResource const& minor)
+    {
+        if (opts.report == nullptr)
+            return;
+        PlotReport::Table& t = opts.report->tables[0];
+        t.pairs_produced = produced;
+        t.capacity = produced;
+        t.capacity_used_pct = 100.0;
+        t.hash_ms = ctor.timings.hash_time_ms;
+        t.sort_ms = ctor.timings.sort_time_ms;
+        t.hash_counters = ctor.timings.hash_counters;
+        t.sort_counters = ctor.timings.sort_counters;
+        t.minor_scratch_peak_bytes = minor.phase_high_watermark_bytes();
+    }
+
+    template <typename Constructor, typename Views>
+    static void record_table_(Options const& opts,
+        int table_id,
+        Constructor const& ctor,
+        std::size_t produced,
+        std::size_t capacity,
+        Views const& views)
+    {
+        if (opts.report == nullptr)
+            return;
+        PlotReport::Table& t = opts.report->tables[table_id];
+        t.pairs_produced = produced;
+        t.capacity = capacity;
+        t.capacity_used_pct = ctor.percentage_capacity_used;
+        t.hash_ms = ctor.timings.hash_time_ms;
+        t.sort_ms = ctor.timings.sort_time_ms;
+        t.find_pairs_ms = ctor.timings.find_pairs_time_ms;
+        t.post_sort_ms = ctor.timings.post_sort_time_ms;
+        t.misc_ms = ctor.timings.misc_time_ms;
+        t.hash_counters = ctor.timings.hash_counters;
+        t.sort_counters = ctor.timings.sort_counters;
+        t.find_pairs_counters = ctor.timings.find_pairs_counters;
+        t.post_sort_counters = ctor.timings.post_sort_counters;
+        t.target_scratch_peak_bytes = views.target.phase_high_watermark_bytes();
+        t.minor_scratch_peak_bytes = views.minor.phase_high_watermark_bytes();
+    }
+
+    // A stage is skipped when the checkpoint already covers it.
+    static bool needs_stage_(std::optional<CheckpointStage> resume_stage, CheckpointStage stage)
+    {
+        return !resume_stage.has_value() || *resume_stage < stage;
+    }
+
+    // Memory-budgeted pipeline: see PlotMemoryPlan.
+    PlotData run_streaming_(PlotMemoryPlan const& plan,
+        std::optional<CheckpointStage> resume_stage,
+        std::string const& resume_file,
+        Options const& opts)
+    {
+        IProgressSink& sink = *opts.sink;
+
+        std::optional<StreamingPlotLayout> layout;
+        {
+            ScopedEvent alloc_scope(sink, ProgressEvent { .kind = EventKind::AllocationBegin });
+            if (alloc_scope.cancelled())
+                return {};
+            layout.emplace(proof_params_, plan);
+            sink.on_event(ProgressEvent {
+                .kind = EventKind::Note,
+                .note_id = NoteId::LayoutTotalBytesAllocated,
+                .u64_0 = layout->total_bytes_allocated(),
+            });
+        }
+
+        std::span<Xs_Candidate> xs_candidates;
+        if (needs_stage_(resume_stage, CheckpointStage::Xs)) {
+            auto xsV = layout->xs();
+            XsConstructor xs_gen_ctor(proof_params_, sink);
+            xs_candidates = xs_gen_ctor.construct(xsV.out, xsV.minor);
+            record_xs_(opts, xs_gen_ctor, xs_candidates.size(), xsV.minor);
+            write_checkpoint_(opts, CheckpointStage::Xs, xs_candidates);
+        }
+        else if (*resume_stage == CheckpointStage::Xs) {
+            xs_candidates = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::Xs, layout->input<Xs_Candidate>());
+        }
+
+        std::span<T1Pairing> t1_pairs;
+        if (needs_stage_(resume_stage, CheckpointStage::T1)) {
+            auto v = layout->phase<Xs_Candidate, T1Pairing>(1);
+            Table1Constructor t1_ctor(proof_params_, v.target, v.minor, sink);
+            std::string path = stream_table_(t1_ctor, CheckpointStage::T1, xs_candidates, v,
+                plan.tables[1], opts);
+            t1_pairs = load_spill_(path, CheckpointStage::T1, layout->input<T1Pairing>(), opts);
+        }
+        else if (*resume_stage == CheckpointStage::T1) {
+            t1_pairs = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::T1, layout->input<T1Pairing>());
+        }
+
+        std::span<T2Pairing> t2_pairs;
+        if (needs_stage_(resume_stage, CheckpointStage::T2)) {
+            auto v = layout->phase<T1Pairing, T2Pairing>(2);
+            Table2Constructor t2_ctor(proof_params_, v.target, v.minor, sink);
+            std::string path = stream_table_(
+                t2_ctor, CheckpointStage::T2, t1_pairs, v, plan.tables[2], opts);
+            t2_pairs = load_spill_(path, CheckpointStage::T2, layout->input<T2Pairing>(), opts);
+        }
+        else {
+            t2_pairs = PlotCheckpoint::read(
+                resume_file, proof_params_, CheckpointStage::T2, layout->input<T2Pairing>());
+        }
+
+        std::string t3_path;
+        {
+            auto v = layout->phase<T2Pairing, T3Pairing>(3);
+            Table3Constructor t3_ctor(proof_params_, v.target, v.minor, sink);
+            t3_path = stream_table_(
+                t3_ctor, CheckpointStage::T3, t2_pairs, v, plan.tables[3], opts);
+        }
+
+        // Release the plotting buffer before materialising the final fragments.
+        layout.reset();
+        std::vector<ProofFragment> t3_proof_fragments = read_t3_fragments_(t3_path);
+        if (opts.checkpoint_dir.empty())
+            remove_spill_(t3_path, opts);
+        return finish_(std::move(t3_proof_fragments), opts);
+    }
+
+    // Build one table in plan.output_passes passes, appending each sorted pass to a spill file.
+    // Returns the spill file path.
+    template <typename Ctor, typename In, typename Out>
+    std::string stream_table_(Ctor& ctor,
+        CheckpointStage stage,
+        std::span<In> input,
+        StreamingPlotLayout::PhaseViews<In, Out> const& views,
+        PlotMemoryPlan::TablePasses const& passes,
+        Options const& opts)
+    {
+        bool const is_checkpoint = !opts.checkpoint_dir.empty();
+        std::string const dir = is_checkpoint ? opts.checkpoint_dir
+            : !opts.spill_dir.empty()         ? opts.spill_dir
+                                              : std::filesystem::temp_directory_path().string();
+        // Private spills get a random suffix, so runs of the same plot sharing a temp directory do
+        // not overwrite each other's.
+        std::string const path = PlotCheckpoint::path_for(dir, proof_params_, stage)
+            + (is_checkpoint ? "" : ".spill-" + random_suffix_());
+
+        PlotCheckpoint::Writer<Out> spill(path, proof_params_, stage);
+        uint32_t const num_sections = proof_params_.get_num_sections();
+        uint32_t const sections_per_pass = num_sections / passes.output_passes;
+        ctor.set_l_chunks(passes.l_chunks);
+        ctor.set_pair_join(opts.pair_join);
+        std::size_t produced = 0;
+        for (uint32_t pass = 0; pass < passes.output_passes; ++pass) {
+            opts.sink->on_event(ProgressEvent {
+                .kind = EventKind::Note,
+                .note_id = NoteId::StreamingPass,
+                .table_id = static_cast<uint8_t>(stage),
+                .u64_0 = pass,
+                .u64_1 = passes.output_passes,
+            });
+            ctor.set_output_sections(pass * sections_per_pass, (pass + 1) * sections_per_pass);
+            auto part = ctor.construct(input, views.out);
+            spill.append(std::span<Out const>(part));
+            produced += part.size();
+        }
+        size_t const bytes = spill.finish(is_checkpoint);
+        record_table_(opts, static_cast<int>(stage), ctor, produced, views.out.size(), views);
+
+        if (is_checkpoint) {
+            opts.sink->on_event(ProgressEvent {
+                .kind = EventKind::Note,
+                .note_id = NoteId::CheckpointWritten,
+                .table_id = static_cast<uint8_t>(stage),
+                .u64_0 = bytes,
+                .msg = path.c_str(),
+            });
+        }
+        return path;
+    }
+
+    template <typename T>
+    std::span<T> load_spill_(
+        std::string const& path, CheckpointStage stage, std::span<T> dest, Options const& opts)
+    {
+        auto table = PlotCheckpoint::read(path, proof_params_, stage, dest);
+        if (opts.checkpoint_dir.empty())
+            remove_spill_(path, opts);
+        return table;
+    }
+
+    // A spill that cannot be deleted is reported and left behind; the plot itself is fine.
+    static void remove_spill_(std::string const& path, Options const& opts)
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        if (ec) {
+            std::string const msg = "Failed to remove spill file " + path + ": " + ec.message();
+            opts.sink->on_event(ProgressEvent { .kind = EventKind::Warning, .msg = msg.c_str() });
+        }
+    }
+
+    static std::string random_suffix_()
+    {
+        static char const* const hex = "0123456789abcdef";
+        std::random_device rd;
+        uint64_t const r = (uint64_t(rd()) << 32) ^ rd();
+        std::string suffix;
+        for (int shift = 60; shift >= 0; shift -= 4)
+            suffix.push_back(hex[(r >> shift) & 0xF]);
+        return suffix;
+    }
+
+    // Proof fragments of a resident T3 table, copied out in parallel blocks.
+    static std::vector<ProofFragment> copy_out_(std::span<T3Pairing const> t3_results)
+    {
+        std::vector<ProofFragment> t3_proof_fragments(t3_results.size());
+        std::size_t const num_blocks
+            = (t3_results.size() + kCopyOutBlockElems - 1) / kCopyOutBlockElems;
+        parallel_for_range(std::size_t(0), num_blocks, [&](std::size_t b) {
+            std::size_t const begin = b * kCopyOutBlockElems;
+            std::size_t const end = std::min(begin + kCopyOutBlockElems, t3_results.size());
+            for (std::size_t i = begin; i < end; ++i)
+                t3_proof_fragments[i] = t3_results[i].proof_fragment;
+        });
+        return t3_proof_fragments;
+    }
+
+    // Proof fragments of a T3 spill or checkpoint file, read one minor-scratch-sized block of
+    // pairings at a time so the T3 table is never resident next to the fragments (see
+    // PlotMemoryPlan).
+    std::vector<ProofFragment> read_t3_fragments_(std::string const& path) const
+    {
+        PlotCheckpoint::Reader<T3Pairing> spill(path, proof_params_, CheckpointStage::T3);
+        std::vector<ProofFragment> t3_proof_fragments(static_cast<size_t>(spill.count()));
+        std::vector<T3Pairing> block(
+            std::min(t3_proof_fragments.size(), kSpillReadBlockElems));
+        auto out = t3_proof_fragments.begin();
+        for (;;) {
+            std::span<T3Pairing const> const pairs = spill.read(block);
+            if (pairs.empty())
+                break;
+            out = std::transform(pairs.begin(), pairs.end(), out,
+                [](T3Pairing const& pair) { return pair.proof_fragment; });
+        }
+        return t3_proof_fragments;
+    }
+
+    PlotData finish_(std::vector<ProofFragment>&& t3_proof_fragments, Options const& opts)
+    {
         auto plot_data = PlotData {};
-        // copy out the proof fragments
-        std::vector<ProofFragment> t3_proof_fragments;
-        t3_proof_fragments.reserve(t3_results.size());
-        for (auto const& t3_pair: t3_results) {
-            t3_proof_fragments.push_back(t3_pair.proof_fragment);
+        plot_data.t3_proof_fragments = std::move(t3_proof_fragments);
+
+        if (!opts.checkpoint_dir.empty() && opts.remove_checkpoints_on_success) {
+            for (auto stage: { CheckpointStage::Xs, CheckpointStage::T1, CheckpointStage::T2,
+                     CheckpointStage::T3 }) {
+                std::error_code ec;
+                std::filesystem::remove(
+                    PlotCheckpoint::path_for(opts.checkpoint_dir, proof_params_, stage), ec);
+            }
         }
-        plot_data.t3_proof_fragments = t3_proof_fragments;
 
         return plot_data;
     }
 
-    ProofParams getProofParams() const { return proof_params_; }
-
-    void setValidate(bool validate) { validate_ = validate; }
+    template <typename T>
+    void write_checkpoint_(Options const& opts, CheckpointStage stage, std::span<T> data)
+    {
+        if (opts.checkpoint_dir.empty())
+            return;
+
+        std::string const path
+            = PlotCheckpoint::path_for(opts.checkpoint_dir, proof_params_, stage);
+        size_t const bytes
+            = PlotCheckpoint::write(path, proof_params_, stage, std::span<T const>(data));
+
+        opts.sink->on_event(ProgressEvent {
+            .kind = EventKind::Note,
+            .note_id = NoteId::CheckpointWritten,
+            .table_id = static_cast<uint8_t>(stage),
+            .u64_0 = bytes,
+            .msg = path.c_str(),
+        });
+    }
 
-private:
     ProofParams proof_params_;
     ProofFragmentCodec fragment_codec_;
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define POS2_HAVE_PREAD 1
+#else
+#include <fstream>
+#include <mutex>
+#define POS2_HAVE_PREAD 0
+#endif
+
+// A file opened once for reading at explicit offsets (pread), for plot chunk reads. There is no
+// shared file position, so any number of threads can read at once without locking, and every read
+// goes to the file that was opened, even if its name is later replaced on disk.
+//
+// Where pread is not available, reads go through one stream under a mutex.
+class PositionalFile {
+public:
+    explicit PositionalFile(std::string const& path)
+    {
+#if POS2_HAVE_PREAD
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0)
+            throw std::runtime_error("Failed to open " + path);
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+            ::close(fd_);
+            throw std::runtime_error("Failed to stat " + path);
+        }
+        size_ = static_cast<uint64_t>(st.st_size);
+#else
+        in_.open(path, std::ios::binary | std::ios::ate);
+        if (!in_)
+            throw std::runtime_error("Failed to open " + path);
+        size_ = static_cast<uint64_t>(in_.tellg());
+#endif
+    }
+
+    PositionalFile(PositionalFile const&) = delete;
+    PositionalFile& operator=(PositionalFile const&) = delete;
+
+    ~PositionalFile()
+    {
+#if POS2_HAVE_PREAD
+        ::close(fd_);
+#endif
+    }
+
+    // The size of the file when it was opened.
+    uint64_t size() const noexcept { return size_; }
+
+    // The descriptor, for mapping the same file (-1 where there is none).
+    int native_handle() const noexcept
+    {
+#if POS2_HAVE_PREAD
+        return fd_;
+#else
+        return -1;
+#endif
+    }
+
+    // Fills `out` with the bytes at `offset`. False on an I/O error or when the file ends first.
+    bool read_at(uint64_t offset, std::span<uint8_t> out) const
+    {
+#if POS2_HAVE_PREAD
+        while (!out.empty()) {
+            ssize_t const n = ::pread(fd_, out.data(), out.size(), static_cast<off_t>(offset));
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            out = out.subspan(static_cast<std::size_t>(n));
+            offset += static_cast<uint64_t>(n);
+        }
+        return true;
+#else
+        std::lock_guard lock(mutex_);
+        in_.clear();
+        in_.seekg(static_cast<std::streamoff>(offset));
+        in_.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+        return static_cast<bool>(in_);
+#endif
+    }
+
+private:
+#if POS2_HAVE_PREAD
+    int fd_ = -1;
+#else
+    mutable std::mutex mutex_;
+    mutable std::ifstream in_;
+#endif
+    uint64_t size_ = 0;
+};
@@ -27,9 +27,12 @@ enum class EventKind : uint8_t {
 
 enum class NoteId : uint8_t {
     None = 0,
-    LayoutTotalBytesAllocated,
+    LayoutTotalBytesAllocated, // u64_0 = bytes, u64_1 = layout blocks (0 when streaming)
     HasAESHardware,
-    TableCapacityUsed
+    TableCapacityUsed,
+    CheckpointWritten, // table_id = stage, u64_0 = bytes written, msg = path
+    StreamingPass, // table_id, u64_0 = pass index, u64_1 = number of passes
+    PlotReport // msg = PlotReport JSON, valid during the call; sent when the plot is done
 };
 
 struct ProgressEvent {
@@ -384,12 +387,24 @@ public:
         case EventKind::Note:
             switch (e.note_id) {
             case NoteId::LayoutTotalBytesAllocated:
-                std::cout << "Note: Total bytes allocated for layout: " << e.u64_0 << " bytes\n";
+                std::cout << "Note: Total bytes allocated for layout: " << e.u64_0 << " bytes";
+                if (e.u64_1 != 0)
+                    std::cout << " (" << e.u64_1 << " blocks)";
+                std::cout << "\n";
                 break;
             case NoteId::TableCapacityUsed:
                 std::cout << "Note: Table " << int(e.table_id)
                           << " capacity used: " << e.f64_0 * 100.0 << "%\n";
                 break;
+            case NoteId::CheckpointWritten:
+                std::cout << "Note: Checkpoint after table " << int(e.table_id) << " written ("
+                          << e.u64_0 << " bytes)" << (e.msg ? " to " : "") << (e.msg ? e.msg : "")
+                          << "\n";
+                break;
+            case NoteId::StreamingPass:
+                std::cout << "Note: Table " << int(e.table_id) << " pass " << (e.u64_0 + 1) << "/"
+                          << e.u64_1 << "\n";
+                break;
             case NoteId::HasAESHardware:
                 std::cout << "Note: AES hardware acceleration is "
                           << (e.u64_0 ? "available" : "not available") << "\n";
@@ -1,17 +1,44 @@
 #pragma once
 
+#include "common/ParallelPrefixSum.hpp"
 #include "common/Timer.hpp"
 #include "common/thread.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <memory_resource>
+#include <new>
+#include <numeric>
 #include <span>
 #include <thread>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RADIX_SORT_STREAMING_STORES 1
+#else
+#define RADIX_SORT_STREAMING_STORES 0
+#endif
+
 // A generic radix sort that works on objects of type T by extracting a key (uint32_t)
 // using the provided KeyExtractor functor.
+//
+// The most significant digit is scattered first, in parallel over index ranges. Each of its
+// buckets is then finished independently by one thread with least-significant-digit passes over
+// the remaining digits, which keeps a bucket's passes mostly in cache. Within a bucket the
+// histogram for the next pass is counted during the current pass's scatter, so only the first
+// pass needs a separate read.
+//
+// Scatters of large ranges stage elements in per-bucket cache-line slots (software write
+// combining) and write a slot out once full, with non-temporal stores when the destination is too
+// large to stay in cache. The pass count, and so whether the result lands in `data` or `buffer`,
+// only depends on num_bits and the element size (see num_passes).
 template <typename T, typename KeyType, typename KeyExtractor = decltype(&T::match_info)>
 class RadixSort {
 public:
@@ -19,154 +46,706 @@ public:
 
     explicit RadixSort() : key_extractor_(&T::match_info) {}
 
+    static constexpr std::size_t kCacheLineBytes = 64;
+    // Staging slot per bucket: the fewest whole cache lines that hold whole elements.
+    static constexpr std::size_t kStageBytes = std::lcm(sizeof(T), kCacheLineBytes);
+    static constexpr std::size_t kStageElems = kStageBytes / sizeof(T);
+
+    // Widest digit. Elements that tile a cache line get 11 bits (128 KB of staging per thread),
+    // elements needing multi-line slots stay at 10 so the staging area still fits in L2.
+    static constexpr int kRadixBits = (kStageBytes == kCacheLineBytes) ? 11 : 10;
+
+    // Number of scatter passes sort() performs for num_bits of key.
+    static constexpr int num_passes(int num_bits)
+    {
+        return (num_bits + kRadixBits - 1) / kRadixBits;
+    }
+
+    // The passes ping-pong between the two spans: an odd pass count leaves the sorted result in
+    // `buffer`, an even one back in `data`.
+    static constexpr bool result_in_buffer(int num_bits) { return num_passes(num_bits) % 2 == 1; }
+
     // Sort the vector 'data' in place, using 'buffer' as temporary storage.
     // Sorting is based on the key extracted by key_extractor_.
     // returns sorted span, which caller can check which of the data or buffer it is in
     std::span<T> sort(
         std::span<T> data, std::span<T> buffer, int num_bits, std::pmr::memory_resource* mr)
     {
-        int const radix_bits = 10; // Process bits per pass.
-        int const radix = 1 << radix_bits;
-        int const radix_mask = radix - 1;
-        int const num_passes = (num_bits + radix_bits - 1) / radix_bits; // Number of passes needed.
+        int const passes = num_passes(num_bits);
+        std::span<T> const result = result_in_buffer(num_bits) ? buffer : data;
+        if (passes == 0)
+            return result;
+        assert(buffer.size() >= data.size());
 
-        size_t num_threads = std::thread::hardware_concurrency();
-        if (num_threads == 0)
-            num_threads = 1;
+        std::size_t const num_elements = data.size();
+        auto const digits = make_digits_(num_bits);
+        Digit const top = digits[static_cast<std::size_t>(passes - 1)];
+        std::size_t const radix = std::size_t(1) << top.bits;
 
-        size_t const num_elements = data.size();
+        std::size_t const num_threads = thread_count_(num_elements);
 
         Timer timer;
         if (verbose_) {
             std::cout << "RadixSort: Sorting " << num_elements << " elements with " << num_threads
-                      << " threads on " << num_bits << " bits" << std::endl;
+                      << " threads on " << num_bits << " bits in " << passes << " passes"
+                      << std::endl;
             timer.start();
         }
 
-        std::pmr::vector<std::pmr::vector<uint32_t>> counts_by_thread(mr);
-        counts_by_thread.reserve(num_threads);
-        for (size_t t = 0; t < num_threads; ++t) {
-            counts_by_thread.emplace_back(std::pmr::vector<uint32_t>(radix, 0u, mr));
+        auto const range_begin
+            = [&](std::size_t t) { return num_elements * t / num_threads; };
+
+        // Count phase for the most significant digit: each thread counts its index range.
+        Timer phaseTimer;
+        if (verbose_)
+            phaseTimer.start("Count phase");
+
+        std::pmr::vector<uint32_t> counts_by_thread(num_threads * radix, 0u, mr);
+        {
+            std::vector<thread> threads;
+            for (size_t t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    uint32_t* counts = counts_by_thread.data() + t * radix;
+                    for (size_t i = range_begin(t); i < range_begin(t + 1); ++i)
+                        counts[digit_of_(data[i], top)]++;
+                });
+            }
         }
 
-        int const num_elements_per_thread = static_cast<int>(num_elements / num_threads);
+        // Global bucket starts, and where each thread's share of each bucket begins.
+        std::pmr::vector<std::size_t> bucket_start(radix + 1, 0u, mr);
+        std::pmr::vector<std::size_t> thread_pos(num_threads * radix, 0u, mr);
+        histogram_offsets(std::span<uint32_t const>(counts_by_thread),
+            num_threads,
+            radix,
+            std::span<std::size_t>(bucket_start),
+            std::span<std::size_t>(thread_pos),
+            static_cast<unsigned>(num_threads));
+        assert(bucket_start[radix] == num_elements);
 
-        // Compute per-thread offsets.
-        std::pmr::vector<std::pmr::vector<uint32_t>> offsets_for_thread(mr);
-        offsets_for_thread.reserve(num_threads);
-        for (size_t t = 0; t < num_threads; ++t) {
-            offsets_for_thread.emplace_back(std::pmr::vector<uint32_t>(radix, 0u, mr));
+        if (verbose_) {
+            phaseTimer.stop();
+            phaseTimer.start("Most significant digit scatter");
         }
 
-        for (int pass = 0; pass < num_passes; ++pass) {
-            if (verbose_)
-                std::cout << "----- Pass " << pass << " -----" << std::endl;
-            int shift = pass * radix_bits;
+        bool const streaming_top = num_elements * sizeof(T) >= kStreamingStoreMinBytes;
+        {
+            std::vector<thread> threads;
+            for (size_t t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t]() {
+                    Workspace ws;
+                    std::copy_n(thread_pos.data() + t * radix, radix, ws.pos.data());
+                    std::size_t const begin = range_begin(t);
+                    scatter_(std::span<T const>(data.data() + begin, range_begin(t + 1) - begin),
+                        buffer.data(),
+                        top,
+                        ws,
+                        streaming_top,
+                        nullptr);
+                });
+            }
+        }
+
+        if (verbose_)
+            phaseTimer.stop();
 
-            // Count phase: each thread counts keys.
-            Timer countPhaseTimer;
+        if (passes > 1) {
+            // Remaining digits, least significant first, one bucket at a time.
             if (verbose_)
-                countPhaseTimer.start("Count phase");
+                phaseTimer.start("Per-bucket passes");
 
-            {
-                std::vector<thread> threads;
-                for (size_t t = 0; t < num_threads; ++t) {
-                    threads.emplace_back([&, t]() {
-                        // Reset counts
-                        for (size_t r = 0; r < radix; ++r)
-                            counts_by_thread[t][r] = 0;
-
-                        size_t start = num_elements_per_thread * t;
-                        size_t end = (t == num_threads - 1) ? num_elements
-                                                            : num_elements_per_thread * (t + 1);
-                        for (size_t i = start; i < end; ++i) {
-                            // Extract key using the provided key extractor.
-                            KeyType key = (data[i].*key_extractor_ >> shift) & radix_mask;
-                            counts_by_thread[t][key]++;
-                        }
-                    });
-                }
+            std::atomic<std::size_t> next_bucket { 0 };
+            std::size_t const bucket_threads = std::min(num_threads, radix);
+            std::vector<thread> threads;
+            for (size_t t = 0; t < bucket_threads; ++t) {
+                threads.emplace_back([&]() {
+                    Workspace ws;
+                    for (std::size_t r = next_bucket.fetch_add(1, std::memory_order_relaxed);
+                        r < radix;
+                        r = next_bucket.fetch_add(1, std::memory_order_relaxed)) {
+                        sort_bucket_(data, buffer, bucket_start[r], bucket_start[r + 1], digits,
+                            passes - 1, ws);
+                    }
+                });
             }
+            threads.clear();
 
-            if (verbose_) {
-                countPhaseTimer.stop();
-                countPhaseTimer.start("Prefix sum phase");
-            }
+            if (verbose_)
+                phaseTimer.stop();
+        }
+
+        if (verbose_)
+            timer.stop();
+
+        return result;
+    }
+
+    // In-place variant for the table post-sorts, which then need no second full-size buffer. The
+    // most significant digit is permuted in parallel (PARADIS: speculative permutation of
+    // per-thread stripes, then a repair step, repeated until few elements are left), after which
+    // each bucket is finished by one thread with in-place American flag passes, switching to an
+    // out-of-place finish in a cache-sized scratch buffer once a bucket fits in L2.
+    // Not stable: equal keys may come out in any order.
+    std::span<T> sort_in_place(std::span<T> data, int num_bits, std::pmr::memory_resource* mr)
+    {
+        int const passes = num_passes(num_bits);
+        std::size_t const num_elements = data.size();
+        if (passes == 0 || num_elements <= 1)
+            return data;
+
+        auto const digits = make_digits_(num_bits);
+        int const top_level = passes - 1;
+        std::size_t const num_threads = thread_count_(num_elements);
 
-            // Merge counts to global counts.
-            std::pmr::vector<uint32_t> counts(radix, 0u, mr);
+        Timer timer;
+        if (verbose_) {
+            std::cout << "RadixSort: Sorting " << num_elements << " elements in place with "
+                      << num_threads << " threads on " << num_bits << " bits" << std::endl;
+            timer.start();
+        }
+
+        if (num_threads == 1) {
+            Workspace ws;
+            sort_in_place_range_(data.data(), num_elements, top_level, digits, ws);
+            if (verbose_)
+                timer.stop();
+            return data;
+        }
+
+        TopBuckets const buckets = partition_in_place(data, num_bits, mr);
+        finish_in_place(data, num_bits, buckets, 0, buckets.size());
+
+        if (verbose_)
+            timer.stop();
+        return data;
+    }
+
+    // Bounds of the most significant digit's buckets after partition_in_place.
+    struct TopBuckets {
+        std::vector<std::size_t> start; // size() + 1 bounds, bucket r = [start[r], start[r + 1])
+        int bits = 0; // width of the digit: bucket r holds the keys whose top `bits` bits are r
+
+        std::size_t size() const { return start.empty() ? 0 : start.size() - 1; }
+    };
+
+    // First half of sort_in_place: permutes `data` by the most significant digit only. Each
+    // bucket can then be finished on its own with finish_in_place, so a consumer can start on the
+    // buckets it needs while the others are still unsorted. Both halves together give the same
+    // result as sort_in_place.
+    TopBuckets partition_in_place(
+        std::span<T> data, int num_bits, std::pmr::memory_resource* mr) const
+    {
+        int const passes = num_passes(num_bits);
+        std::size_t const num_elements = data.size();
+        if (passes == 0)
+            return TopBuckets { { 0, num_elements }, 0 };
+
+        auto const digits = make_digits_(num_bits);
+        Digit const top = digits[static_cast<std::size_t>(passes - 1)];
+        std::size_t const radix = std::size_t(1) << top.bits;
+        std::size_t const num_threads = thread_count_(num_elements);
+
+        auto const range_begin
+            = [&](std::size_t t) { return num_elements * t / num_threads; };
+
+        std::pmr::vector<uint32_t> counts_by_thread(num_threads * radix, 0u, mr);
+        {
+            std::vector<thread> threads;
             for (size_t t = 0; t < num_threads; ++t) {
-                for (size_t r = 0; r < radix; ++r)
-                    counts[r] += counts_by_thread[t][r];
+                threads.emplace_back([&, t]() {
+                    uint32_t* counts = counts_by_thread.data() + t * radix;
+                    for (size_t i = range_begin(t); i < range_begin(t + 1); ++i)
+                        counts[digit_of_(data[i], top)]++;
+                });
+            }
+        }
+
+        std::pmr::vector<std::size_t> bucket_start(radix + 1, 0u, mr);
+        histogram_offsets(std::span<uint32_t const>(counts_by_thread),
+            num_threads,
+            radix,
+            std::span<std::size_t>(bucket_start),
+            std::span<std::size_t> {},
+            static_cast<unsigned>(num_threads));
+
+        permute_parallel_(data, top, num_threads, bucket_start);
+        return TopBuckets { std::vector<std::size_t>(bucket_start.begin(), bucket_start.end()),
+            top.bits };
+    }
+
+    // Second half of sort_in_place: sorts buckets [bucket_begin, bucket_end) of a
+    // partition_in_place result on the remaining digits, in parallel over the buckets. Works in
+    // heap scratch only, so it may run while other threads use the caller's arenas.
+    void finish_in_place(std::span<T> data,
+        int num_bits,
+        TopBuckets const& buckets,
+        std::size_t bucket_begin,
+        std::size_t bucket_end) const
+    {
+        int const passes = num_passes(num_bits);
+        if (passes <= 1 || bucket_begin >= bucket_end)
+            return;
+
+        auto const digits = make_digits_(num_bits);
+        int const top_level = passes - 1;
+        std::size_t const num_threads = thread_count_(
+            buckets.start[bucket_end] - buckets.start[bucket_begin]);
+
+        std::atomic<std::size_t> next_bucket { bucket_begin };
+        std::vector<thread> threads;
+        for (size_t t = 0; t < std::min(num_threads, bucket_end - bucket_begin); ++t) {
+            threads.emplace_back([&]() {
+                Workspace ws;
+                for (std::size_t r = next_bucket.fetch_add(1, std::memory_order_relaxed);
+                    r < bucket_end;
+                    r = next_bucket.fetch_add(1, std::memory_order_relaxed)) {
+                    sort_in_place_range_(data.data() + buckets.start[r],
+                        buckets.start[r + 1] - buckets.start[r], top_level - 1, digits, ws);
+                }
+            });
+        }
+    }
+
+    // Most heap scratch one worker thread holds during a sort, outside the caller's arena: its
+    // Workspace and its share of the in-place permutation's bucket and stripe bounds.
+    static constexpr std::size_t heap_bytes_per_thread()
+    {
+        constexpr std::size_t radix = Workspace::kMaxRadix;
+        constexpr std::size_t word = sizeof(std::size_t);
+        return radix * (2 * word + 4 * sizeof(uint32_t)) // pos .. next_hist
+            + radix * kStageBytes // staging
+            + 2 * kMaxPasses * (radix + 1) * word // level_start, level_head
+            + kCacheFinishBytes // finish
+            + 4 * (radix + 1) * word; // stripe_head/stripe_tail share, head, TopBuckets
+    }
+
+    void setVerbose(bool v) { verbose_ = v; }
+
+    // Upper bound on worker threads, 0 = hardware concurrency.
+    void setMaxThreads(std::size_t n) { max_threads_ = n; }
+
+private:
+    static constexpr int kMaxPasses = (64 + kRadixBits - 1) / kRadixBits;
+    // Keeps tiny sorts (e.g. small L candidate sections) from paying for thread startup.
+    static constexpr std::size_t kMinElementsPerThread = 16 * 1024;
+    // Buckets this small are finished with an insertion sort.
+    static constexpr std::size_t kSmallBucketElems = 64;
+    // Staging only pays off when slots fill up several times.
+    static constexpr std::size_t kMinStagedElemsPerBucket = 2 * kStageElems;
+    // Destinations at least this large bypass the cache with streaming stores.
+    static constexpr std::size_t kStreamingStoreMinBytes = 16 * 1024 * 1024;
+    // In-place sorts finish buckets up to this size out of place in per-thread scratch.
+    static constexpr std::size_t kCacheFinishBytes = 256 * 1024;
+
+    std::size_t thread_count_(std::size_t num_elements) const
+    {
+        std::size_t num_threads = max_threads_ ? max_threads_ : std::thread::hardware_concurrency();
+        if (num_threads == 0)
+            num_threads = 1;
+        return std::max<std::size_t>(
+            1, std::min(num_threads, num_elements / kMinElementsPerThread));
+    }
+
+    struct Digit {
+        int shift = 0;
+        int bits = 0;
+    };
+
+    // Splits num_bits into equal digits (the upper ones one bit wider), least significant first.
+    static std::array<Digit, kMaxPasses> make_digits_(int num_bits)
+    {
+        std::array<Digit, kMaxPasses> digits {};
+        int const passes = num_passes(num_bits);
+        int const base = num_bits / passes;
+        int const extra = num_bits % passes;
+        int shift = 0;
+        for (int p = 0; p < passes; ++p) {
+            int const bits = base + (p >= passes - extra ? 1 : 0);
+            digits[static_cast<std::size_t>(p)] = Digit { shift, bits };
+            shift += bits;
+        }
+        return digits;
+    }
+
+    std::size_t digit_of_(T const& e, Digit d) const
+    {
+        KeyType const key = static_cast<KeyType>(e.*key_extractor_);
+        return static_cast<std::size_t>((key >> d.shift) & ((KeyType(1) << d.bits) - 1));
+    }
+
+    struct AlignedDelete {
+        void operator()(std::byte* p) const
+        {
+            ::operator delete[](p, std::align_val_t(kCacheLineBytes));
+        }
+    };
+
+    // Per-thread scatter state. Sized per bucket rather than per element, so it is taken from the
+    // heap instead of the caller's scratch arena.
+    struct Workspace {
+        static constexpr std::size_t kMaxRadix = std::size_t(1) << kRadixBits;
+
+        std::vector<std::size_t> pos = std::vector<std::size_t>(kMaxRadix); // next output index
+        std::vector<std::ptrdiff_t> slot_index = std::vector<std::ptrdiff_t>(kMaxRadix);
+        std::vector<uint32_t> fill = std::vector<uint32_t>(kMaxRadix);
+        std::vector<uint32_t> first = std::vector<uint32_t>(kMaxRadix);
+        std::vector<uint32_t> hist = std::vector<uint32_t>(kMaxRadix);
+        std::vector<uint32_t> next_hist = std::vector<uint32_t>(kMaxRadix);
+        std::unique_ptr<std::byte[], AlignedDelete> stage;
+        // In-place sorts: bucket bounds and write heads per recursion level, finish scratch.
+        std::array<std::vector<std::size_t>, kMaxPasses> level_start;
+        std::array<std::vector<std::size_t>, kMaxPasses> level_head;
+        std::vector<T> finish;
+
+        T* staging()
+        {
+            if (!stage) {
+                stage.reset(static_cast<std::byte*>(
+                    ::operator new[](kMaxRadix * kStageBytes, std::align_val_t(kCacheLineBytes))));
             }
+            return reinterpret_cast<T*>(stage.get());
+        }
+    };
+
+    // Finishes bucket [begin, end), which the most significant digit pass left in `buffer`, with
+    // `local_passes` passes over the lower digits.
+    void sort_bucket_(std::span<T> data,
+        std::span<T> buffer,
+        std::size_t begin,
+        std::size_t end,
+        std::array<Digit, kMaxPasses> const& digits,
+        int local_passes,
+        Workspace& ws) const
+    {
+        std::size_t const size = end - begin;
+        if (size == 0)
+            return;
 
-            // Global prefix sum.
-            std::vector<uint32_t> offsets(radix, 0);
-            for (size_t i = 1; i < radix; ++i)
-                offsets[i] = offsets[i - 1] + counts[i - 1];
+        T* src = buffer.data();
+        T* dst = data.data();
+        if (size <= kSmallBucketElems) {
+            T* out = (local_passes % 2 == 0) ? src : dst;
+            if (out != src)
+                std::copy(src + begin, src + end, out + begin);
+            // every element shares the top digit, which starts at digits[local_passes]
+            int const top_shift = digits[static_cast<std::size_t>(local_passes)].shift;
+            insertion_sort_(out + begin, size, top_shift);
+            return;
+        }
 
-            // reset offsets for each thread
-            for (size_t t = 0; t < num_threads; ++t)
-                std::fill(offsets_for_thread[t].begin(), offsets_for_thread[t].end(), 0u);
+        std::fill_n(ws.hist.begin(), std::size_t(1) << digits[0].bits, 0u);
+        for (std::size_t i = begin; i < end; ++i)
+            ws.hist[digit_of_(src[i], digits[0])]++;
 
-            for (size_t r = 0; r < radix; ++r)
-                offsets_for_thread[0][r] = offsets[r];
-            for (size_t t = 1; t < num_threads; ++t) {
-                for (size_t r = 0; r < radix; ++r)
-                    offsets_for_thread[t][r]
-                        = offsets_for_thread[t - 1][r] + counts_by_thread[t - 1][r];
+        bool const streaming = size * sizeof(T) >= kStreamingStoreMinBytes;
+        for (int p = 0; p < local_passes; ++p) {
+            Digit const d = digits[static_cast<std::size_t>(p)];
+            std::size_t pos = begin;
+            for (std::size_t r = 0; r < (std::size_t(1) << d.bits); ++r) {
+                ws.pos[r] = pos;
+                pos += ws.hist[r];
             }
 
-            if (verbose_)
-                countPhaseTimer.stop();
+            Digit const* next = nullptr;
+            if (p + 1 < local_passes) {
+                next = &digits[static_cast<std::size_t>(p + 1)];
+                std::fill_n(ws.next_hist.begin(), std::size_t(1) << next->bits, 0u);
+            }
+            scatter_(std::span<T const>(src + begin, size), dst, d, ws, streaming, next);
+            std::swap(ws.hist, ws.next_hist);
+            std::swap(src, dst);
+        }
+    }
 
-            // Redistribution phase: place elements in sorted order into buffer.
-            Timer redistributionTimer;
-            if (verbose_)
-                redistributionTimer.start("Redistribution phase");
+    // Moves every element of data into its bucket of digit `d`, given the bucket bounds. Each round
+    // splits the unfinished part of every bucket into one stripe per thread; threads permute within
+    // their own stripes, leaving elements whose target stripe is full, then a repair step moves
+    // those to the back of each bucket. The few elements left are placed serially.
+    void permute_parallel_(std::span<T> data,
+        Digit d,
+        std::size_t num_threads,
+        std::pmr::vector<std::size_t> const& bucket_start) const
+    {
+        std::size_t const radix = std::size_t(1) << d.bits;
+        std::vector<std::size_t> head(bucket_start.begin(), bucket_start.end() - 1);
+        std::vector<std::size_t> stripe_head(num_threads * radix);
+        std::vector<std::size_t> stripe_tail(num_threads * radix);
+        auto const tail = [&](std::size_t r) { return bucket_start[r + 1]; };
+
+        std::size_t remaining = data.size();
+        while (num_threads > 1 && remaining >= num_threads * kMinElementsPerThread) {
+            for (std::size_t r = 0; r < radix; ++r) {
+                std::size_t const len = tail(r) - head[r];
+                for (std::size_t t = 0; t < num_threads; ++t) {
+                    stripe_head[t * radix + r] = head[r] + len * t / num_threads;
+                    stripe_tail[t * radix + r] = head[r] + len * (t + 1) / num_threads;
+                }
+            }
 
             {
                 std::vector<thread> threads;
-                for (size_t t = 0; t < num_threads; ++t) {
+                for (std::size_t t = 0; t < num_threads; ++t) {
                     threads.emplace_back([&, t]() {
-                        size_t start = num_elements_per_thread * t;
-                        size_t end = (t == num_threads - 1) ? num_elements
-                                                            : num_elements_per_thread * (t + 1);
-                        for (size_t i = start; i < end; ++i) {
-                            KeyType key = (data[i].*key_extractor_ >> shift) & radix_mask;
-                            size_t outpos = offsets_for_thread[t][key]++;
-                            if (outpos >= num_elements) {
-                                throw std::runtime_error("RadixSort: outpos out of range");
+                        std::size_t* ph = stripe_head.data() + t * radix;
+                        std::size_t const* pt = stripe_tail.data() + t * radix;
+                        for (std::size_t i = 0; i < radix; ++i) {
+                            // [stripe start, ph[i]) is placed, [ph[i], h) holds leftovers.
+                            std::size_t h = ph[i];
+                            while (h < pt[i]) {
+                                T v = data[h];
+                                std::size_t k = digit_of_(v, d);
+                                while (k != i && ph[k] < pt[k]) {
+                                    std::swap(v, data[ph[k]++]);
+                                    k = digit_of_(v, d);
+                                }
+                                if (k == i) {
+                                    data[h++] = data[ph[i]];
+                                    data[ph[i]++] = v;
+                                }
+                                else {
+                                    data[h++] = v;
+                                }
+                            }
+                        }
+                    });
+                }
+            }
+
+            // Repair: per bucket, swap leftovers behind the placed elements.
+            {
+                std::atomic<std::size_t> next_bucket { 0 };
+                std::vector<thread> threads;
+                for (std::size_t t = 0; t < num_threads; ++t) {
+                    threads.emplace_back([&]() {
+                        for (std::size_t r = next_bucket.fetch_add(1, std::memory_order_relaxed);
+                            r < radix;
+                            r = next_bucket.fetch_add(1, std::memory_order_relaxed)) {
+                            std::size_t lo = head[r];
+                            std::size_t hi = tail(r);
+                            while (true) {
+                                while (lo < hi && digit_of_(data[lo], d) == r)
+                                    ++lo;
+                                while (lo < hi && digit_of_(data[hi - 1], d) != r)
+                                    --hi;
+                                if (lo >= hi)
+                                    break;
+                                std::swap(data[lo++], data[--hi]);
                             }
-                            assert(outpos < num_elements);
-                            buffer[outpos] = data[i];
+                            head[r] = lo;
                         }
                     });
                 }
             }
 
-            redistributionTimer.stop();
+            std::size_t left = 0;
+            for (std::size_t r = 0; r < radix; ++r)
+                left += tail(r) - head[r];
+            if (left == remaining)
+                break; // no progress; let the serial pass finish
+            remaining = left;
+        }
 
-            // Swap the local span views only if there is another pass.
-            if (pass < num_passes - 1) {
-                std::swap(data, buffer);
+        // Serial American flag pass over what is left.
+        for (std::size_t r = 0; r < radix; ++r) {
+            while (head[r] < tail(r)) {
+                T v = data[head[r]];
+                std::size_t k = digit_of_(v, d);
+                while (k != r) {
+                    std::swap(v, data[head[k]++]);
+                    k = digit_of_(v, d);
+                }
+                data[head[r]++] = v;
             }
         }
+    }
 
-        // If an odd number of passes was performed, 'data' still points
-        // to the original container and 'buffer' holds the sorted data.
-        // Copy the sorted data back into the caller's container.
+    // Sorts [first, first + size) in place on digits[level] and below, most significant first.
+    void sort_in_place_range_(T* first,
+        std::size_t size,
+        int level,
+        std::array<Digit, kMaxPasses> const& digits,
+        Workspace& ws) const
+    {
+        Digit const d = digits[static_cast<std::size_t>(level)];
+        if (size <= kSmallBucketElems) {
+            insertion_sort_(first, size, d.shift + d.bits);
+            return;
+        }
+        if (size * sizeof(T) <= kCacheFinishBytes) {
+            finish_in_cache_(first, size, level, digits, ws);
+            return;
+        }
 
-        if (verbose_)
-            timer.stop();
+        std::size_t const radix = std::size_t(1) << d.bits;
+        auto& start = ws.level_start[static_cast<std::size_t>(level)];
+        auto& head = ws.level_head[static_cast<std::size_t>(level)];
+        start.assign(radix + 1, 0);
+        for (std::size_t i = 0; i < size; ++i)
+            start[digit_of_(first[i], d) + 1]++;
+        for (std::size_t r = 0; r < radix; ++r)
+            start[r + 1] += start[r];
+        head.assign(start.begin(), start.end() - 1);
+
+        for (std::size_t r = 0; r < radix; ++r) {
+            while (head[r] < start[r + 1]) {
+                T v = first[head[r]];
+                std::size_t k = digit_of_(v, d);
+                while (k != r) {
+                    std::swap(v, first[head[k]++]);
+                    k = digit_of_(v, d);
+                }
+                first[head[r]++] = v;
+            }
+        }
 
-        return buffer; // sorted data always in buffer, since this is swapped into at end of each
-                       // loop.
+        if (level == 0)
+            return;
+        for (std::size_t r = 0; r < radix; ++r)
+            sort_in_place_range_(first + start[r], start[r + 1] - start[r], level - 1, digits, ws);
     }
 
-    void setVerbose(bool v) { verbose_ = v; }
+    // Least-significant-digit passes over digits[0..level] through the per-thread finish buffer.
+    void finish_in_cache_(T* first,
+        std::size_t size,
+        int level,
+        std::array<Digit, kMaxPasses> const& digits,
+        Workspace& ws) const
+    {
+        if (ws.finish.size() < size)
+            ws.finish.resize(kCacheFinishBytes / sizeof(T));
+
+        T* src = first;
+        T* dst = ws.finish.data();
+        std::fill_n(ws.hist.begin(), std::size_t(1) << digits[0].bits, 0u);
+        for (std::size_t i = 0; i < size; ++i)
+            ws.hist[digit_of_(src[i], digits[0])]++;
+
+        for (int p = 0; p <= level; ++p) {
+            Digit const d = digits[static_cast<std::size_t>(p)];
+            std::size_t pos = 0;
+            for (std::size_t r = 0; r < (std::size_t(1) << d.bits); ++r) {
+                ws.pos[r] = pos;
+                pos += ws.hist[r];
+            }
+
+            Digit const* next = nullptr;
+            if (p < level) {
+                next = &digits[static_cast<std::size_t>(p + 1)];
+                std::fill_n(ws.next_hist.begin(), std::size_t(1) << next->bits, 0u);
+            }
+            scatter_(std::span<T const>(src, size), dst, d, ws, false, next);
+            std::swap(ws.hist, ws.next_hist);
+            std::swap(src, dst);
+        }
+        if (src != first)
+            std::memcpy(first, src, size * sizeof(T));
+    }
+
+    // Stable sort by the key bits below `bits`.
+    void insertion_sort_(T* first, std::size_t size, int bits) const
+    {
+        auto const key = [&](T const& e) {
+            KeyType const k = static_cast<KeyType>(e.*key_extractor_);
+            return bits >= static_cast<int>(sizeof(KeyType) * 8)
+                ? k
+                : static_cast<KeyType>(k & ((KeyType(1) << bits) - 1));
+        };
+        for (std::size_t i = 1; i < size; ++i) {
+            T const e = first[i];
+            KeyType const k = key(e);
+            std::size_t j = i;
+            for (; j > 0 && key(first[j - 1]) > k; --j)
+                first[j] = first[j - 1];
+            first[j] = e;
+        }
+    }
+
+    // Scatters `src` into `dst` by digit `d`, starting each bucket at ws.pos. With `next` set,
+    // also counts the histogram of that digit into ws.next_hist.
+    void scatter_(std::span<T const> src,
+        T* dst,
+        Digit d,
+        Workspace& ws,
+        bool streaming,
+        Digit const* next) const
+    {
+        std::size_t const radix = std::size_t(1) << d.bits;
+        if (src.size() < radix * kMinStagedElemsPerBucket) {
+            for (T const& e: src) {
+                if (next)
+                    ws.next_hist[digit_of_(e, *next)]++;
+                dst[ws.pos[digit_of_(e, d)]++] = e;
+            }
+            return;
+        }
+
+        // Slots mirror the destination's cache lines: find the first element index that starts a
+        // line, and give every bucket a partly filled first slot so its later slots are aligned.
+        std::size_t phase = kStageElems;
+        for (std::size_t i = 0; i < kStageElems; ++i) {
+            if (reinterpret_cast<std::uintptr_t>(dst + i) % kCacheLineBytes == 0) {
+                phase = i;
+                break;
+            }
+        }
+        bool const aligned = phase < kStageElems;
+        if (!aligned)
+            phase = 0;
+        streaming = streaming && aligned && RADIX_SORT_STREAMING_STORES;
+
+        T* stage = ws.staging();
+        for (std::size_t r = 0; r < radix; ++r) {
+            std::size_t const lead = (ws.pos[r] % kStageElems + kStageElems - phase) % kStageElems;
+            ws.slot_index[r] = static_cast<std::ptrdiff_t>(ws.pos[r] - lead);
+            ws.fill[r] = static_cast<uint32_t>(lead);
+            ws.first[r] = static_cast<uint32_t>(lead);
+        }
+
+        for (T const& e: src) {
+            if (next)
+                ws.next_hist[digit_of_(e, *next)]++;
+            std::size_t const r = digit_of_(e, d);
+            T* slot = stage + r * kStageElems;
+            slot[ws.fill[r]] = e;
+            if (++ws.fill[r] == kStageElems) {
+                T* out = dst + (ws.slot_index[r] + static_cast<std::ptrdiff_t>(ws.first[r]));
+                if (streaming && ws.first[r] == 0)
+                    stream_slot_(out, slot);
+                else
+                    std::memcpy(out, slot + ws.first[r], (kStageElems - ws.first[r]) * sizeof(T));
+                ws.slot_index[r] += static_cast<std::ptrdiff_t>(kStageElems);
+                ws.fill[r] = 0;
+                ws.first[r] = 0;
+            }
+        }
+
+        for (std::size_t r = 0; r < radix; ++r) {
+            if (ws.fill[r] > ws.first[r]) {
+                std::memcpy(dst + (ws.slot_index[r] + static_cast<std::ptrdiff_t>(ws.first[r])),
+                    stage + r * kStageElems + ws.first[r],
+                    (ws.fill[r] - ws.first[r]) * sizeof(T));
+            }
+        }
+
+#if RADIX_SORT_STREAMING_STORES
+        if (streaming)
+            _mm_sfence(); // order the write-combined stores before the join publishes them
+#endif
+    }
+
+    static void stream_slot_(T* out, T const* slot)
+    {
+#if RADIX_SORT_STREAMING_STORES
+        auto* d = reinterpret_cast<__m128i*>(out);
+        auto const* s = reinterpret_cast<__m128i const*>(slot);
+        for (std::size_t i = 0; i < kStageBytes / sizeof(__m128i); ++i)
+            _mm_stream_si128(d + i, _mm_load_si128(s + i));
+#else
+        std::memcpy(out, slot, kStageBytes);
+#endif
+    }
 
-private:
     bool verbose_ = false;
+    std::size_t max_threads_ = 0;
     KeyExtractor key_extractor_;
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "RadixSort.hpp"
+#include "common/thread.hpp"
+#include "pos/ProofParams.hpp"
+
+// Hands a table to the next table's matching section by section (Plotter::Options::wavefront).
+//
+// Output sections come from the pairing hash, so no section of a table is complete before the
+// whole table has been matched; what can overlap with the next table is the post-sort. The table
+// is partitioned on its top key digit, whose top bits are the section, and a background thread
+// then finishes the sections in the order the next table's matching reads them. The matching
+// waits per section pair (TableConstructorGeneric::set_section_gate), so it starts on the first
+// pair while the later sections are still being sorted. The sorted table is the same as with
+// the eager post-sort.
+template <typename T>
+class SectionWavefront {
+public:
+    // Partitions `table` (sorted on k bits of match_info) by its top digit. Sections are not
+    // readable before start().
+    SectionWavefront(
+        std::span<T> table, ProofParams const& params, std::pmr::memory_resource* scratch_mr)
+        : table_(table)
+        , num_bits_(params.get_k())
+        , section_bits_(params.get_num_section_bits())
+        , ready_(params.get_num_sections(), false)
+    {
+        buckets_ = sort_.partition_in_place(table_, num_bits_, scratch_mr);
+    }
+
+    SectionWavefront(SectionWavefront const&) = delete;
+    SectionWavefront& operator=(SectionWavefront const&) = delete;
+
+    // Finishes the sections in `order` (then any others) on a background thread.
+    void start(std::vector<uint32_t> order)
+    {
+        if (buckets_.bits < section_bits_) {
+            // sections do not cover whole buckets; sort everything up front
+            sort_.finish_in_place(table_, num_bits_, buckets_, 0, buckets_.size());
+            std::lock_guard lock(mutex_);
+            ready_.assign(ready_.size(), true);
+            return;
+        }
+        worker_.emplace([this, order = std::move(order)]() { run_(order); });
+    }
+
+    // Blocks until `section` is sorted; rethrows a failure of the background thread.
+    void wait_ready(uint32_t section)
+    {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [&] { return ready_[section] || error_ != nullptr; });
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+    std::span<T> table() const { return table_; }
+
+private:
+    void run_(std::vector<uint32_t> const& order)
+    {
+        try {
+            for (uint32_t section: order)
+                finish_section_(section);
+            for (uint32_t section = 0; section < ready_.size(); ++section)
+                finish_section_(section);
+        }
+        catch (...) {
+            std::lock_guard lock(mutex_);
+            error_ = std::current_exception();
+            cv_.notify_all();
+        }
+    }
+
+    void finish_section_(uint32_t section)
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (ready_[section])
+                return;
+        }
+        std::size_t const per_section = std::size_t(1) << (buckets_.bits - section_bits_);
+        sort_.finish_in_place(
+            table_, num_bits_, buckets_, section * per_section, (section + 1) * per_section);
+
+        std::lock_guard lock(mutex_);
+        ready_[section] = true;
+        cv_.notify_all();
+    }
+
+    std::span<T> table_;
+    int num_bits_;
+    int section_bits_;
+    RadixSort<T, uint32_t> sort_;
+    typename RadixSort<T, uint32_t>::TopBuckets buckets_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<bool> ready_; // by section, guarded by mutex_
+    std::exception_ptr error_;
+
+    // Last member, so the worker is joined before the state it uses goes away.
+    std::optional<thread> worker_;
+};
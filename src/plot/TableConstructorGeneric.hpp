@@ -4,6 +4,7 @@
 #include <array>
 #include <bitset>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
@@ -14,13 +15,14 @@
 #include "LayoutPlanner.hpp"
 #include "RadixSort.hpp"
 #include "common/ParallelForRange.hpp"
+#include "common/SortedIntersect.hpp"
 #include "common/Timer.hpp"
 #include "plot/Progress.hpp"
 #include "pos/ProofCore.hpp"
 #include "pos/ProofParams.hpp"
 #include "pos/ProofValidator.hpp"
 
-static std::size_t max_pairs_per_section_possible(ProofParams const& params)
+inline std::size_t max_pairs_per_section_possible(ProofParams const& params)
 {
     int extra_margin_bits = 0; // default for k28
     extra_margin_bits = 8 - ((28 - params.get_k()) / 2);
@@ -35,9 +37,29 @@ static std::size_t max_pairs_per_section_possible(ProofParams const& params)
         + (1ULL << (params.get_k() - extra_margin_bits));
 }
 
+// Sorted L entry of the key/index matching path: the matching target and the candidate's offset
+// in its L chunk. The candidate itself is only read back when its key meets an R key.
+struct LTargetIndex {
+    uint32_t match_info; // matching target
+    uint32_t index;
+};
+
+// How construct() joins the L and R candidates of a match key.
+enum class PairJoin : uint8_t {
+    SortMerge, // radix sort L by matching target, merge join with R
+    HashJoin, // partition L by matching target, probe a cache-sized directory per R partition
+};
+
 template <typename PairingCandidate, typename T_Pairing, typename T_Result>
 class TableConstructorGeneric {
 public:
+    // Candidates wider than an LTargetIndex are matched through (target, index) entries, so the
+    // L sort moves 8 bytes per candidate instead of the whole struct.
+    static constexpr bool kSortsLByIndex = sizeof(PairingCandidate) > sizeof(LTargetIndex);
+    // Bytes per sorted L entry (and per radix tmp entry) in target scratch.
+    static constexpr std::size_t kLTargetBytes
+        = kSortsLByIndex ? sizeof(LTargetIndex) : sizeof(PairingCandidate);
+
     TableConstructorGeneric(int table_id,
         ProofParams const& proof_params,
         ResettableArenaResource& target_scratch,
@@ -55,6 +77,52 @@ public:
 
     virtual ~TableConstructorGeneric() = default;
 
+    // =========================
+    // Multi-pass controls (memory budgeted plotting)
+    // =========================
+
+    // Split each L section into this many chunks; each chunk is hashed, sorted and joined
+    // against R on its own, so target scratch only has to hold 1/l_chunks of a section.
+    void set_l_chunks(uint32_t l_chunks) { l_chunks_ = std::max<uint32_t>(1, l_chunks); }
+
+    // Only keep output pairs whose output section is in [begin, end). Running construct() once
+    // per section range and concatenating the sorted results yields the full sorted table, at
+    // the cost of recomputing the matching for every range.
+    void set_output_sections(uint32_t begin, uint32_t end)
+    {
+        out_section_begin_ = begin;
+        out_section_end_ = end;
+        filter_output_ = !(begin == 0 && end >= params_.get_num_sections());
+    }
+
+    void set_pair_join(PairJoin join) { pair_join_ = join; }
+
+    // Wavefront mode (see SectionWavefront). With deferred post-sort, construct() returns its
+    // output unsorted and the caller sorts it. The section gate is called with both sections of
+    // a section pair before the pair is matched, and must return once they are sorted in the
+    // previous table; construct() then only needs the previous table partitioned by section.
+    void set_defer_post_sort(bool defer) { defer_post_sort_ = defer; }
+    void set_section_gate(std::function<void(uint32_t)> gate) { section_gate_ = std::move(gate); }
+
+    // Sections of the previous table in the order construct() first reads them: the section
+    // pairs run around the ring (3, m(3)), (m(3), m(m(3))), ... with m = matching_section.
+    std::vector<uint32_t> section_order()
+    {
+        std::vector<uint32_t> order;
+        uint32_t section = kFirstSectionL;
+        do {
+            order.push_back(section);
+            section = proof_core_.matching_section(section);
+        } while (section != kFirstSectionL);
+        return order;
+    }
+
+    // Section (top num_section_bits of the sort key) an output pairing lands in.
+    virtual uint32_t output_section(T_Pairing const& /*pairing*/) const
+    {
+        throw std::runtime_error("output_section not implemented");
+    }
+
     // =========================
     // Prefix (flat 2D) structure
     // =========================
@@ -74,16 +142,41 @@ public:
         std::size_t const num_match_keys = params_.get_num_match_keys(table_id_);
         std::size_t const stride = num_match_keys + 1;
 
-        // counts: [num_sections][num_match_keys]
-        uint64_t* counts = arena_alloc_n<uint64_t>(scratch_mr, num_sections * num_match_keys);
-        std::fill(counts, counts + num_sections * num_match_keys, 0ULL);
+        std::size_t const num_cells = num_sections * num_match_keys;
+
+        // One histogram per thread over its index range, folded into row 0 afterwards.
+        // counts: [num_threads][num_sections][num_match_keys], each thread's row padded to whole
+        // cache lines so neighbouring rows do not share one while counting
+        std::size_t const hw_threads = std::max(1u, std::thread::hardware_concurrency());
+        std::size_t const num_threads = std::clamp<std::size_t>(
+            pairing_candidates.size() / kMinPrefixElemsPerThread, 1, hw_threads);
+        constexpr std::size_t kCellsPerLine = 64 / sizeof(uint64_t);
+        std::size_t const row_cells
+            = (num_cells + kCellsPerLine - 1) / kCellsPerLine * kCellsPerLine;
+        uint64_t* counts = static_cast<uint64_t*>(
+            scratch_mr->allocate(num_threads * row_cells * sizeof(uint64_t), 64));
+
+        parallel_for_range(
+            std::size_t(0),
+            num_threads,
+            [&](std::size_t t) {
+                uint64_t* local = counts + t * row_cells;
+                std::fill_n(local, num_cells, 0ULL);
+                std::size_t const begin = pairing_candidates.size() * t / num_threads;
+                std::size_t const end = pairing_candidates.size() * (t + 1) / num_threads;
+                for (auto const& candidate: pairing_candidates.subspan(begin, end - begin)) {
+                    uint32_t section
+                        = params_.extract_section_from_match_info(table_id_, candidate.match_info);
+                    uint32_t mk = params_.extract_match_key_from_match_info(
+                        table_id_, candidate.match_info);
+                    local[std::size_t(section) * num_match_keys + std::size_t(mk)]++;
+                }
+            },
+            static_cast<unsigned>(num_threads));
 
-        for (auto const& candidate: pairing_candidates) {
-            uint32_t section
-                = params_.extract_section_from_match_info(table_id_, candidate.match_info);
-            uint32_t mk
-                = params_.extract_match_key_from_match_info(table_id_, candidate.match_info);
-            counts[std::size_t(section) * num_match_keys + std::size_t(mk)]++;
+        for (std::size_t t = 1; t < num_threads; ++t) {
+            for (std::size_t c = 0; c < num_cells; ++c)
+                counts[c] += counts[t * row_cells + c];
         }
 
         // prefixes: [num_sections][num_match_keys+1]
@@ -113,103 +206,55 @@ public:
         std::size_t r_end;
     };
 
-    // Returns a span allocated from scratch_mr.
-    std::span<SplitRange> make_splits_simple(std::span<PairingCandidate const> l_candidates,
+    // Cuts sorted L into up to num_splits ranges of about equal size, each starting at the first
+    // entry of its key, and pairs every range with the R range of the same keys (binary search,
+    // R is sorted by masked match_info). Ranges may be empty. Allocated from target scratch.
+    // LTarget is PairingCandidate or LTargetIndex.
+    template <typename LTarget>
+    std::span<SplitRange> make_splits(std::span<LTarget const> l_candidates,
         std::span<PairingCandidate const> r_candidates,
-        unsigned num_threads,
+        std::size_t num_splits,
         uint32_t match_target_mask) const
     {
         using std::size_t;
 
         size_t const l_size = l_candidates.size();
         size_t const r_size = r_candidates.size();
-
-        if (l_size == 0 || r_size == 0 || num_threads == 0) {
+        if (l_size == 0 || r_size == 0 || num_splits == 0)
             return {};
-        }
-
-        num_threads = std::min<unsigned>(num_threads, static_cast<unsigned>(l_size));
-        if (num_threads == 0) {
-            return {};
-        }
-
-        auto key = [match_target_mask](PairingCandidate const& c) -> uint32_t {
-            return c.match_info & match_target_mask;
-        };
-
-        unsigned const num_splits = num_threads; // one chunk per thread
-
-        // Allocate split arrays from scratch
-        size_t* l_splits = arena_alloc_n<size_t>(target_scratch_arena_, num_splits + 1);
-        size_t* r_splits = arena_alloc_n<size_t>(target_scratch_arena_, num_splits + 1);
-
-        l_splits[0] = 0;
-        l_splits[num_splits] = l_size;
-
-        size_t const base_chunk = l_size / num_splits;
-
-        for (unsigned i = 1; i < num_splits; ++i) {
-            size_t idx = i * base_chunk;
-            if (idx >= l_size)
-                idx = l_size - 1;
-
-            uint32_t k = key(l_candidates[idx]);
-            while (idx > 0 && key(l_candidates[idx - 1]) == k) {
-                --idx;
-            }
-            if (idx < l_splits[i - 1])
-                idx = l_splits[i - 1];
-
-            l_splits[i] = idx;
-        }
+        num_splits = std::min(num_splits, l_size);
 
-        r_splits[0] = 0;
-        r_splits[num_splits] = r_size;
-
-        for (unsigned i = 1; i < num_splits; ++i) {
-            size_t const l_idx = l_splits[i];
-            size_t r_idx = r_size * i / num_splits;
-            if (r_idx >= r_size)
-                r_idx = r_size ? (r_size - 1) : 0;
-
-            if (l_idx >= l_size) {
-                r_splits[i] = r_size;
-                continue;
-            }
-
-            // scan down if L key is less
-            while (r_idx > 0
-                && l_candidates[l_idx].match_info
-                    < (r_candidates[r_idx].match_info & match_target_mask)) {
-                --r_idx;
-            }
-
-            // if equal, scan to first equal on R
-            if (r_size > 0
-                && l_candidates[l_idx].match_info
-                    == (r_candidates[r_idx].match_info & match_target_mask)) {
-                while (r_idx > 0
-                    && ((r_candidates[r_idx - 1].match_info & match_target_mask)
-                        == l_candidates[l_idx].match_info)) {
-                    --r_idx;
-                }
-            }
+        SplitRange* ranges = arena_alloc_n<SplitRange>(target_scratch_arena_, num_splits);
 
-            // scan up if L key is greater
-            while (r_idx < r_size
-                && l_candidates[l_idx].match_info
-                    > (r_candidates[r_idx].match_info & match_target_mask)) {
-                ++r_idx;
+        size_t l_prev = 0;
+        size_t r_prev = 0;
+        for (size_t i = 1; i <= num_splits; ++i) {
+            size_t l_idx = l_size;
+            size_t r_idx = r_size;
+            if (i < num_splits) {
+                // back up to the start of the key run, so no key straddles two ranges
+                l_idx = std::max(l_prev, l_size * i / num_splits);
+                uint32_t const key = l_candidates[l_idx].match_info;
+                l_idx = static_cast<size_t>(std::lower_bound(l_candidates.begin() + l_prev,
+                                                l_candidates.begin() + l_idx + 1,
+                                                key,
+                                                [](LTarget const& c, uint32_t k) {
+                                                    return c.match_info < k;
+                                                })
+                    - l_candidates.begin());
+                r_idx = static_cast<size_t>(std::lower_bound(r_candidates.begin() + r_prev,
+                                                r_candidates.end(),
+                                                key,
+                                                [match_target_mask](
+                                                    PairingCandidate const& c, uint32_t k) {
+                                                    return (c.match_info & match_target_mask) < k;
+                                                })
+                    - r_candidates.begin());
             }
-
-            r_splits[i] = r_idx;
+            ranges[i - 1] = SplitRange { l_prev, l_idx, r_prev, r_idx };
+            l_prev = l_idx;
+            r_prev = r_idx;
         }
-
-        SplitRange* ranges = arena_alloc_n<SplitRange>(target_scratch_arena_, num_splits);
-        for (unsigned i = 0; i < num_splits; ++i) {
-            ranges[i] = SplitRange { l_splits[i], l_splits[i + 1], r_splits[i], r_splits[i + 1] };
-        }
-
         return std::span<SplitRange>(ranges, num_splits);
     }
 
@@ -233,60 +278,42 @@ public:
         throw std::runtime_error("matching_target not implemented");
     }
 
+    // Matching target of prev_table_pair for R match key match_key_r; the key/index path only
+    // needs this, not the whole candidate.
+    virtual uint32_t matching_target_info(
+        PairingCandidate const& prev_table_pair, uint32_t match_key_r)
+    {
+        return matching_target(prev_table_pair, match_key_r).match_info;
+    }
+
     // Writes pairs into out_pairs using atomic cursor.
     void find_pairs_into(std::span<PairingCandidate const> l_targets,
         std::span<PairingCandidate const> r_candidates,
         std::span<T_Pairing> out_pairs,
         std::atomic<std::size_t>& out_count)
     {
-        std::size_t left_index = 0;
-        std::size_t right_index = 0;
-        std::size_t const r_size = r_candidates.size();
-
-        std::size_t const num_match_target_bits = params_.get_num_match_target_bits(table_id_);
-        uint32_t const match_target_mask = (uint32_t(1) << num_match_target_bits) - 1u;
-
-        bool have_r_candidate = (r_size > 0);
-        std::size_t current_r_idx = 0;
-
-        while (left_index < l_targets.size() && have_r_candidate) {
-            uint32_t match_target_l = l_targets[left_index].match_info;
-            uint32_t match_target_r = (r_candidates[current_r_idx].match_info & match_target_mask);
-
-            if (match_target_l == match_target_r) {
-                std::size_t start_i = left_index;
-                while (start_i < l_targets.size()
-                    && (l_targets[start_i].match_info == match_target_r)) {
-                    handle_pair_into(
-                        l_targets[start_i], r_candidates[current_r_idx], out_pairs, out_count);
-                    ++start_i;
-                }
+        find_pairs_into_(l_targets, r_candidates, out_pairs, out_count,
+            [](PairingCandidate const& l) -> PairingCandidate const& { return l; });
+    }
 
-                ++right_index;
-                if (right_index < r_size)
-                    current_r_idx = right_index;
-                else
-                    have_r_candidate = false;
-            }
-            else if (match_target_r < match_target_l) {
-                ++right_index;
-                if (right_index < r_size)
-                    current_r_idx = right_index;
-                else
-                    have_r_candidate = false;
-            }
-            else {
-                ++left_index;
-            }
-        }
+    // Key/index variant: l_targets index into l_source, which is only read for matching keys.
+    void find_pairs_into(std::span<LTargetIndex const> l_targets,
+        std::span<PairingCandidate const> l_source,
+        std::span<PairingCandidate const> r_candidates,
+        std::span<T_Pairing> out_pairs,
+        std::atomic<std::size_t>& out_count)
+    {
+        find_pairs_into_(l_targets, r_candidates, out_pairs, out_count,
+            [l_source](LTargetIndex const& l) -> PairingCandidate const& {
+                return l_source[l.index];
+            });
     }
 
     // =========================
     // Main construct using arenas
     // =========================
-    std::span<T_Result> construct(std::span<PairingCandidate> previous_table_pairs,
-        std::span<T_Pairing> out_pairs,
-        std::span<T_Pairing> tmp_pairs)
+    std::span<T_Result> construct(
+        std::span<PairingCandidate> previous_table_pairs, std::span<T_Pairing> out_pairs)
     {
         ScopedEvent table_scope(sink_,
             ProgressEvent { .kind = EventKind::TableBegin,
@@ -302,14 +329,12 @@ public:
         std::atomic<std::size_t> out_count { 0 };
 
         std::size_t const num_match_keys = params_.get_num_match_keys(table_id_);
-        uint32_t const match_target_mask
-            = (uint32_t(1) << params_.get_num_match_target_bits(table_id_)) - 1u;
 
         uint32_t const total_match_keys
             = static_cast<uint32_t>(num_match_keys * params_.get_num_sections());
         uint32_t processed_match_keys = 0;
 
-        uint32_t section_l = 3; // pattern will be (3,0), (0,2), (2,1), (1,3)
+        uint32_t section_l = kFirstSectionL; // pattern will be (3,0), (0,2), (2,1), (1,3)
         while (true) {
             ScopedEvent section_scope(sink_,
                 ProgressEvent { .kind = EventKind::SectionBegin,
@@ -320,6 +345,10 @@ public:
                 return {};
 
             uint32_t const section_r = proof_core_.matching_section(section_l);
+            if (section_gate_) {
+                section_gate_(section_l);
+                section_gate_(section_r);
+            }
 
             uint64_t const l_start_u64 = prefix.row(section_l)[0];
             uint64_t const l_end_u64 = prefix.row(section_l)[num_match_keys];
@@ -355,81 +384,53 @@ public:
                     continue;
                 }
 
-                PairingCandidate* l_ptr
-                    = arena_alloc_n<PairingCandidate>(target_scratch_arena_, l_count);
-                std::span<PairingCandidate> l_candidates(l_ptr, l_count);
-
-                timer_.start("Hash matching L candidates");
-                parallel_for_range(uint64_t(0),
-                    uint64_t(l_count),
-                    [this, l_ptr, prev = previous_table_pairs, l_start, match_key_r](uint64_t idx) {
-                        l_ptr[static_cast<std::size_t>(idx)] = matching_target(
-                            prev[l_start + static_cast<std::size_t>(idx)], match_key_r);
-                    });
-                timings.hash_time_ms += timer_.stop();
-
-                // R is a view into previous table pairs
-                auto r_candidates = std::span<PairingCandidate const>(
-                    previous_table_pairs.data() + r_start, r_count);
-
-                // Sort L using temp buffer in scratch
-                PairingCandidate* tmp_ptr
-                    = arena_alloc_n<PairingCandidate>(target_scratch_arena_, l_count);
-                std::span<PairingCandidate> tmp(tmp_ptr, l_count);
-
-                RadixSort<PairingCandidate, uint32_t> radix_sort;
-
-                timer_.start("Sorting L candidates");
-                // only need to sort by matching_target bits, as match_info returned by
-                // matching_target only uses those bits.
-                std::span<PairingCandidate> l_sorted = radix_sort.sort(l_candidates,
-                    tmp,
-                    numeric_cast<int>(params_.get_num_match_target_bits(table_id_)),
-                    minor_scratch_arena_);
-                timings.sort_time_ms += timer_.stop();
-
-                unsigned num_threads = std::thread::hardware_concurrency();
-                if (num_threads == 0)
-                    num_threads = 1;
-
-                if (num_threads > 1) {
-                    timer_.start("Make Splits Simple");
-                    auto splits = make_splits_simple(
-                        l_sorted, r_candidates, num_threads, match_target_mask);
-                    timings.misc_time_ms += timer_.stop();
-
-                    timer_.start("Finding pairs (parallel)");
-                    parallel_for_range(uint64_t(0),
-                        uint64_t(splits.size()),
-                        [this, &splits, &l_sorted, &r_candidates, out_pairs, &out_count](
-                            uint64_t split_idx) {
-                            auto const& split = splits[static_cast<std::size_t>(split_idx)];
-
-                            auto l_span = std::span<PairingCandidate const>(
-                                l_sorted.data() + split.l_begin, split.l_end - split.l_begin);
-
-                            auto r_span = std::span<PairingCandidate const>(
-                                r_candidates.data() + split.r_begin, split.r_end - split.r_begin);
-
-                            this->find_pairs_into(l_span, r_span, out_pairs, out_count);
-                        });
-                    timings.find_pairs_time_ms += timer_.stop();
-                }
-                else {
-                    timer_.start("Finding pairs");
-                    find_pairs_into(
-                        std::span<PairingCandidate const>(l_sorted.data(), l_sorted.size()),
-                        r_candidates,
-                        out_pairs,
-                        out_count);
-                    timings.find_pairs_time_ms += timer_.stop();
+                for (uint32_t c = 0; c < l_chunks_; ++c) {
+                    std::size_t const chunk_start = l_start + l_count * c / l_chunks_;
+                    std::size_t const chunk_count
+                        = l_start + l_count * (c + 1) / l_chunks_ - chunk_start;
+                    if (chunk_count == 0)
+                        continue;
+                    auto chunk_mark = minor_scratch_arena_->mark();
+                    target_scratch_arena_->reset();
+
+                    // R is a view into previous table pairs
+                    auto r_candidates = std::span<PairingCandidate const>(
+                        previous_table_pairs.data() + r_start, r_count);
+                    auto l_source = std::span<PairingCandidate const>(
+                        previous_table_pairs.data() + chunk_start, chunk_count);
+
+                    if (pair_join_ == PairJoin::HashJoin) {
+                        hash_join_l_chunk_(
+                            l_source, match_key_r, r_candidates, out_pairs, out_count);
+                    }
+                    else if constexpr (kSortsLByIndex) {
+                        auto l_sorted = sort_l_chunk_<LTargetIndex>(
+                            chunk_count, [this, l_source, match_key_r](std::size_t i) {
+                                return LTargetIndex {
+                                    matching_target_info(l_source[i], match_key_r),
+                                    static_cast<uint32_t>(i) };
+                            });
+                        join_l_chunk_(l_sorted, r_candidates, out_pairs, out_count,
+                            [l_source](LTargetIndex const& l) -> PairingCandidate const& {
+                                return l_source[l.index];
+                            });
+                    }
+                    else {
+                        auto l_sorted = sort_l_chunk_<PairingCandidate>(
+                            chunk_count, [this, l_source, match_key_r](std::size_t i) {
+                                return matching_target(l_source[i], match_key_r);
+                            });
+                        join_l_chunk_(l_sorted, r_candidates, out_pairs, out_count,
+                            [](PairingCandidate const& l) -> PairingCandidate const& { return l; });
+                    }
+                    minor_scratch_arena_->rewind(chunk_mark);
                 }
                 minor_scratch_arena_->rewind(m);
             }
             section_l = section_r;
 
             // once we are back at starting section_l, we are done
-            if (section_l == 3) {
+            if (section_l == kFirstSectionL) {
                 break;
             }
         }
@@ -443,16 +444,19 @@ public:
             throw std::runtime_error("TableConstructorGeneric: output arena capacity exceeded (bad "
                                      "max_pairs_per_table_possible)");
         }
+        if constexpr (std::is_same_v<T_Pairing, T_Result>) {
+            if (defer_post_sort_)
+                return out_pairs.first(produced);
+        }
         ScopedEvent post_sort(sink_,
             ProgressEvent { .kind = EventKind::PostSortBegin,
                 .table_id = (uint8_t)table_id_,
                 .produced = produced });
-        return post_construct_span(out_pairs.first(produced), tmp_pairs.first(produced));
+        return post_construct_span(out_pairs.first(produced));
     }
 
-    // called following construct method - typically sort operations
-    virtual std::span<T_Result> post_construct_span(
-        std::span<T_Pairing> /*pairings*/, std::span<T_Pairing> /*tmp_pairs*/)
+    // called following construct method - typically sort operations, in place in `pairings`
+    virtual std::span<T_Result> post_construct_span(std::span<T_Pairing> /*pairings*/)
     {
         throw std::runtime_error("post_construct_span not implemented");
     }
@@ -465,6 +469,12 @@ public:
         double misc_time_ms = 0.0;
         double post_sort_time_ms = 0.0;
 
+        // hardware counters per phase, valid only while a PerfCounterSession is open
+        PerfCounterValues hash_counters;
+        PerfCounterValues sort_counters;
+        PerfCounterValues find_pairs_counters;
+        PerfCounterValues post_sort_counters;
+
         void show(std::string header) const
         {
             std::cout << header << "\n";
@@ -489,6 +499,278 @@ protected:
     ResettableArenaResource* minor_scratch_arena_;
     IProgressSink& sink_;
 
+    // L section of the first section pair; construct() then follows the ring back to it.
+    static constexpr uint32_t kFirstSectionL = 3;
+
+    uint32_t l_chunks_ = 1;
+    PairJoin pair_join_ = PairJoin::SortMerge;
+    bool defer_post_sort_ = false;
+    std::function<void(uint32_t)> section_gate_;
+    bool filter_output_ = false;
+    uint32_t out_section_begin_ = 0;
+    uint32_t out_section_end_ = 0;
+
+    // Derived handle_pair_into calls this before reserving an output slot.
+    bool keep_output_(T_Pairing const& pairing) const
+    {
+        if (!filter_output_)
+            return true;
+        uint32_t const section = output_section(pairing);
+        return section >= out_section_begin_ && section < out_section_end_;
+    }
+
+    // Hashes one L chunk into target scratch (make(i) builds entry i) and sorts it by matching
+    // target, using a radix tmp of the same size behind it.
+    template <typename LTarget, typename MakeTarget>
+    std::span<LTarget const> sort_l_chunk_(std::size_t chunk_count, MakeTarget make)
+    {
+        LTarget* l_ptr = arena_alloc_n<LTarget>(target_scratch_arena_, chunk_count);
+        std::span<LTarget> l_candidates(l_ptr, chunk_count);
+
+        timer_.start("Hash matching L candidates");
+        parallel_for_range(uint64_t(0), uint64_t(chunk_count), [l_ptr, &make](uint64_t idx) {
+            l_ptr[static_cast<std::size_t>(idx)] = make(static_cast<std::size_t>(idx));
+        });
+        timings.hash_time_ms += timer_.stop();
+        timings.hash_counters += timer_.counters();
+
+        LTarget* tmp_ptr = arena_alloc_n<LTarget>(target_scratch_arena_, chunk_count);
+        std::span<LTarget> tmp(tmp_ptr, chunk_count);
+
+        RadixSort<LTarget, uint32_t> radix_sort;
+
+        timer_.start("Sorting L candidates");
+        // only need to sort by matching_target bits, as match_info returned by
+        // matching_target only uses those bits.
+        std::span<LTarget> l_sorted = radix_sort.sort(l_candidates,
+            tmp,
+            numeric_cast<int>(params_.get_num_match_target_bits(table_id_)),
+            minor_scratch_arena_);
+        timings.sort_time_ms += timer_.stop();
+        timings.sort_counters += timer_.counters();
+
+        return l_sorted;
+    }
+
+    // Joins a sorted L chunk against R; get_l maps an L entry to its candidate.
+    template <typename LTarget, typename GetL>
+    void join_l_chunk_(std::span<LTarget const> l_sorted,
+        std::span<PairingCandidate const> r_candidates,
+        std::span<T_Pairing> out_pairs,
+        std::atomic<std::size_t>& out_count,
+        GetL get_l)
+    {
+        uint32_t const match_target_mask
+            = (uint32_t(1) << params_.get_num_match_target_bits(table_id_)) - 1u;
+
+        unsigned num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0)
+            num_threads = 1;
+
+        // Several splits per thread, pulled on demand: match-run lengths and R density vary,
+        // so equal-count ranges do not take equal time.
+        std::size_t const num_splits = std::min<std::size_t>(
+            std::size_t(num_threads) * kSplitsPerThread, l_sorted.size() / kMinSplitElems);
+
+        if (num_threads > 1 && num_splits > 1) {
+            timer_.start("Make splits");
+            auto splits = make_splits(l_sorted, r_candidates, num_splits, match_target_mask);
+            timings.misc_time_ms += timer_.stop();
+
+            timer_.start("Finding pairs (parallel)");
+            parallel_for_dynamic(uint64_t(0),
+                uint64_t(splits.size()),
+                [this, &splits, &l_sorted, &r_candidates, out_pairs, &out_count, &get_l](
+                    uint64_t split_idx) {
+                    auto const& split = splits[static_cast<std::size_t>(split_idx)];
+                    this->find_pairs_into_(
+                        l_sorted.subspan(split.l_begin, split.l_end - split.l_begin),
+                        r_candidates.subspan(split.r_begin, split.r_end - split.r_begin),
+                        out_pairs,
+                        out_count,
+                        get_l);
+                });
+            timings.find_pairs_time_ms += timer_.stop();
+            timings.find_pairs_counters += timer_.counters();
+        }
+        else {
+            timer_.start("Finding pairs");
+            find_pairs_into_(l_sorted, r_candidates, out_pairs, out_count, get_l);
+            timings.find_pairs_time_ms += timer_.stop();
+            timings.find_pairs_counters += timer_.counters();
+        }
+    }
+
+    // Prefix counting runs on one thread below this many candidates per thread.
+    static constexpr std::size_t kMinPrefixElemsPerThread = 256 * 1024;
+
+    // Pair finding splits: up to kSplitsPerThread per thread, of at least kMinSplitElems L entries.
+    static constexpr std::size_t kSplitsPerThread = 8;
+    static constexpr std::size_t kMinSplitElems = 1024;
+
+    // Hash join sizing: R partitions hold about kHashJoinPartitionElems candidates, each indexed
+    // by a directory of up to 2^kHashJoinBucketBits buckets (8 KiB per thread).
+    static constexpr std::size_t kHashJoinPartitionElems = 4096;
+    static constexpr int kHashJoinMaxPartitionBits = 12;
+    static constexpr int kHashJoinBucketBits = 11;
+    // Cap on the per-thread partition histograms, which live in minor scratch.
+    static constexpr std::size_t kHashJoinHistBytes = 512 * 1024;
+
+    // Joins one L chunk against R without sorting L. R is sorted by matching target, so its
+    // partitions by the top target bits are contiguous ranges; L (target, index) entries are
+    // scattered into the same partitions, and every partition probes a bucket directory over
+    // its slice of R that stays in cache. Matches come out in a different order than with
+    // SortMerge, which the post-construct sort hides.
+    void hash_join_l_chunk_(std::span<PairingCandidate const> l_source,
+        uint32_t match_key_r,
+        std::span<PairingCandidate const> r_candidates,
+        std::span<T_Pairing> out_pairs,
+        std::atomic<std::size_t>& out_count)
+    {
+        int const target_bits = numeric_cast<int>(params_.get_num_match_target_bits(table_id_));
+        uint32_t const match_target_mask = (uint32_t(1) << target_bits) - 1u;
+        std::size_t const l_count = l_source.size();
+        std::size_t const r_count = r_candidates.size();
+
+        int part_bits = 0;
+        while (part_bits < std::min(target_bits, kHashJoinMaxPartitionBits)
+            && (r_count >> part_bits) > kHashJoinPartitionElems) {
+            ++part_bits;
+        }
+        int const part_shift = target_bits - part_bits;
+        int const bucket_bits = std::min(kHashJoinBucketBits, part_shift);
+        int const bucket_shift = part_shift - bucket_bits;
+        std::size_t const num_parts = std::size_t(1) << part_bits;
+        std::size_t const num_buckets = std::size_t(1) << bucket_bits;
+
+        std::size_t num_threads = std::thread::hardware_concurrency();
+        num_threads = std::min(num_threads, kHashJoinHistBytes / (num_parts * sizeof(uint32_t)));
+        num_threads = std::clamp<std::size_t>(num_threads, 1, std::max<std::size_t>(1, l_count));
+
+        timer_.start("Hash join: partitioning L");
+        LTargetIndex* l_ptr = arena_alloc_n<LTargetIndex>(target_scratch_arena_, l_count);
+        LTargetIndex* parts_ptr = arena_alloc_n<LTargetIndex>(target_scratch_arena_, l_count);
+        uint32_t* hist = arena_alloc_n<uint32_t>(minor_scratch_arena_, num_threads * num_parts);
+        std::fill(hist, hist + num_threads * num_parts, 0u);
+
+        auto thread_range = [l_count, num_threads](std::size_t t) {
+            return std::pair { l_count * t / num_threads, l_count * (t + 1) / num_threads };
+        };
+
+        parallel_for_range(uint64_t(0), uint64_t(num_threads), [&](uint64_t t64) {
+            auto const t = static_cast<std::size_t>(t64);
+            auto const [begin, end] = thread_range(t);
+            uint32_t* h = hist + t * num_parts;
+            for (std::size_t i = begin; i < end; ++i) {
+                uint32_t const target = matching_target_info(l_source[i], match_key_r);
+                l_ptr[i] = LTargetIndex { target, static_cast<uint32_t>(i) };
+                ++h[target >> part_shift];
+            }
+        });
+
+        // Partition-major prefix: partition q of thread t starts after all of partition q-1.
+        uint32_t* part_start = arena_alloc_n<uint32_t>(minor_scratch_arena_, num_parts + 1);
+        uint32_t sum = 0;
+        for (std::size_t q = 0; q < num_parts; ++q) {
+            part_start[q] = sum;
+            for (std::size_t t = 0; t < num_threads; ++t) {
+                uint32_t const c = hist[t * num_parts + q];
+                hist[t * num_parts + q] = sum;
+                sum += c;
+            }
+        }
+        part_start[num_parts] = sum;
+
+        parallel_for_range(uint64_t(0), uint64_t(num_threads), [&](uint64_t t64) {
+            auto const t = static_cast<std::size_t>(t64);
+            auto const [begin, end] = thread_range(t);
+            uint32_t* pos = hist + t * num_parts;
+            for (std::size_t i = begin; i < end; ++i)
+                parts_ptr[pos[l_ptr[i].match_info >> part_shift]++] = l_ptr[i];
+        });
+        timings.sort_time_ms += timer_.stop();
+        timings.sort_counters += timer_.counters();
+
+        timer_.start("Hash join: probing R partitions");
+        // R partition boundaries; R is sorted by (match_info & mask) within the match key.
+        uint64_t* r_part = arena_alloc_n<uint64_t>(minor_scratch_arena_, num_parts + 1);
+        for (std::size_t q = 0; q <= num_parts; ++q) {
+            uint32_t const first_target = static_cast<uint32_t>(q << part_shift);
+            r_part[q] = q == num_parts
+                ? r_count
+                : static_cast<uint64_t>(std::partition_point(r_candidates.begin(),
+                                            r_candidates.end(),
+                                            [&](PairingCandidate const& r) {
+                                                return (r.match_info & match_target_mask)
+                                                    < first_target;
+                                            })
+                      - r_candidates.begin());
+        }
+
+        std::size_t const probe_threads = std::min(num_threads, num_parts);
+        uint32_t* dirs
+            = arena_alloc_n<uint32_t>(minor_scratch_arena_, probe_threads * (num_buckets + 1));
+
+        parallel_for_range(uint64_t(0), uint64_t(probe_threads), [&](uint64_t t64) {
+            auto const t = static_cast<std::size_t>(t64);
+            uint32_t* dir = dirs + t * (num_buckets + 1);
+            uint32_t const bucket_mask = static_cast<uint32_t>(num_buckets - 1);
+            for (std::size_t q = num_parts * t / probe_threads;
+                q < num_parts * (t + 1) / probe_threads;
+                ++q) {
+                if (part_start[q] == part_start[q + 1] || r_part[q] == r_part[q + 1])
+                    continue;
+                auto const r_part_span = r_candidates.subspan(r_part[q], r_part[q + 1] - r_part[q]);
+
+                // dir[b] = first R entry of bucket >= b
+                std::size_t b = 0;
+                for (std::size_t j = 0; j < r_part_span.size(); ++j) {
+                    uint32_t const rb
+                        = ((r_part_span[j].match_info & match_target_mask) >> bucket_shift)
+                        & bucket_mask;
+                    while (b <= rb)
+                        dir[b++] = static_cast<uint32_t>(j);
+                }
+                while (b <= num_buckets)
+                    dir[b++] = static_cast<uint32_t>(r_part_span.size());
+
+                for (uint32_t i = part_start[q]; i < part_start[q + 1]; ++i) {
+                    LTargetIndex const l = parts_ptr[i];
+                    uint32_t const lb = (l.match_info >> bucket_shift) & bucket_mask;
+                    for (uint32_t j = dir[lb]; j < dir[lb + 1]; ++j) {
+                        uint32_t const r_target = r_part_span[j].match_info & match_target_mask;
+                        if (r_target > l.match_info)
+                            break;
+                        if (r_target == l.match_info)
+                            handle_pair_into(
+                                l_source[l.index], r_part_span[j], out_pairs, out_count);
+                    }
+                }
+            }
+        });
+        timings.find_pairs_time_ms += timer_.stop();
+        timings.find_pairs_counters += timer_.counters();
+    }
+
+    // Merge join of sorted L targets and R candidates on the matching target.
+    template <typename LTarget, typename GetL>
+    void find_pairs_into_(std::span<LTarget const> l_targets,
+        std::span<PairingCandidate const> r_candidates,
+        std::span<T_Pairing> out_pairs,
+        std::atomic<std::size_t>& out_count,
+        GetL const& get_l)
+    {
+        uint32_t const match_target_mask
+            = (uint32_t(1) << params_.get_num_match_target_bits(table_id_)) - 1u;
+
+        intersect_sorted(SortedKeys::match_info_of(l_targets),
+            SortedKeys::match_info_of(r_candidates, match_target_mask),
+            [&](std::size_t l_begin, std::size_t l_end, std::size_t r) {
+                for (std::size_t l = l_begin; l < l_end; ++l)
+                    handle_pair_into(get_l(l_targets[l]), r_candidates[r], out_pairs, out_count);
+            });
+    }
+
 public:
     ProofCore proof_core_;
 };
@@ -509,9 +791,8 @@ public:
 
     virtual ~XsConstructor() = default;
 
-    std::span<Xs_Candidate> construct(std::span<Xs_Candidate> out_xs,
-        std::span<Xs_Candidate> tmp_xs,
-        std::pmr::memory_resource& scratch_mr)
+    std::span<Xs_Candidate> construct(
+        std::span<Xs_Candidate> out_xs, std::pmr::memory_resource& scratch_mr)
     {
         uint64_t const num_xs_u64 = (1ULL << params_.get_k());
         size_t const num_xs = static_cast<size_t>(num_xs_u64);
@@ -523,13 +804,12 @@ public:
             return {};
 
         // Check buffers large enough
-        if (out_xs.size() < num_xs || tmp_xs.size() < num_xs) {
+        if (out_xs.size() < num_xs) {
             throw std::runtime_error("XsConstructor: buffers too small");
         }
 
         // We only use the first num_xs elements
         auto out_span = out_xs.first(num_xs);
-        auto tmp_span = tmp_xs.first(num_xs);
 
         Timer timer;
         timer.start("Hashing Xs_Candidate");
@@ -540,6 +820,7 @@ public:
             out_span[static_cast<size_t>(x_val)] = Xs_Candidate { match_info, x };
         });
         timings.hash_time_ms = timer.stop();
+        timings.hash_counters = timer.counters();
 
         RadixSort<Xs_Candidate, uint32_t> radix_sort;
 
@@ -547,10 +828,10 @@ public:
             ProgressEvent {
                 .kind = EventKind::PostSortBegin, .table_id = 0, .produced = num_xs_u64 });
         timer.start("Sorting Xs_Candidate");
-        // auto sorted = radix_sort.sort_to(out, tmp);
         std::span<Xs_Candidate> sorted_span
-            = radix_sort.sort(out_span, tmp_span, params_.get_k(), &scratch_mr);
+            = radix_sort.sort_in_place(out_span, params_.get_k(), &scratch_mr);
         timings.sort_time_ms = timer.stop();
+        timings.sort_counters = timer.counters();
 
         return sorted_span;
     }
@@ -558,6 +839,8 @@ public:
     struct Timings {
         double hash_time_ms = 0.0;
         double sort_time_ms = 0.0;
+        PerfCounterValues hash_counters;
+        PerfCounterValues sort_counters;
 
         void show() const
         {
@@ -607,7 +890,7 @@ public:
         uint32_t x_right = r_candidate.x;
 
         std::optional<T1Pairing> res = proof_core_.pairing_t1(x_left, x_right);
-        if (!res.has_value())
+        if (!res.has_value() || !keep_output_(*res))
             return;
 
         // Reserve one slot in the shared output array
@@ -622,9 +905,13 @@ public:
         out_pairs[idx] = *res;
     }
 
+    uint32_t output_section(T1Pairing const& pairing) const override
+    {
+        return params_.extract_section_from_match_info(2, pairing.match_info);
+    }
+
     // Sort the produced pairings into OUT arena and return them as the stage result span.
-    std::span<T1Pairing> post_construct_span(
-        std::span<T1Pairing> pairings, std::span<T1Pairing> tmp_pairs) override
+    std::span<T1Pairing> post_construct_span(std::span<T1Pairing> pairings) override
     {
         minor_scratch_arena_->reset();
 
@@ -632,8 +919,9 @@ public:
 
         timer_.start("Sorting T1Pairing");
         std::span<T1Pairing> sorted_span
-            = radix_sort.sort(pairings, tmp_pairs, params_.get_k(), minor_scratch_arena_);
+            = radix_sort.sort_in_place(pairings, params_.get_k(), minor_scratch_arena_);
         timings.post_sort_time_ms += timer_.stop();
+        timings.post_sort_counters += timer_.counters();
 
         return sorted_span;
     }
@@ -659,6 +947,11 @@ public:
         return t1Pairing;
     }
 
+    uint32_t matching_target_info(T1Pairing const& prev_table_pair, uint32_t match_key_r) override
+    {
+        return proof_core_.matching_target(2, prev_table_pair.meta(), match_key_r);
+    }
+
     void handle_pair_into(T1Pairing const& l_candidate,
         T1Pairing const& r_candidate,
         std::span<T2Pairing> out_pairs,
@@ -690,6 +983,8 @@ public:
                 static_cast<uint32_t>(meta_r & ((uint64_t(1) << params_.get_k()) - 1)) }
 #endif
         };
+        if (!keep_output_(pairing))
+            return;
 
         // Reserve one slot in shared output
         std::size_t const idx = out_count.fetch_add(1);
@@ -701,19 +996,22 @@ public:
         out_pairs[idx] = pairing;
     }
 
-    std::span<T2Pairing> post_construct_span(
-        std::span<T2Pairing> pairings, std::span<T2Pairing> tmp_pairings) override
+    uint32_t output_section(T2Pairing const& pairing) const override
+    {
+        return params_.extract_section_from_match_info(3, pairing.match_info);
+    }
+
+    std::span<T2Pairing> post_construct_span(std::span<T2Pairing> pairings) override
     {
         minor_scratch_arena_->reset();
-        // T2Pairing* tmp_ptr = arena_alloc_n<T2Pairing>(&previous_out_arena, pairings.size());
-        // std::span<T2Pairing> tmp(tmp_ptr, pairings.size());
 
         RadixSort<T2Pairing, uint32_t> radix_sort;
 
         timer_.start("Sorting T2Pairing");
         std::span<T2Pairing> sorted_span
-            = radix_sort.sort(pairings, tmp_pairings, params_.get_k(), minor_scratch_arena_);
+            = radix_sort.sort_in_place(pairings, params_.get_k(), minor_scratch_arena_);
         timings.post_sort_time_ms += timer_.stop();
+        timings.post_sort_counters += timer_.counters();
 
         return sorted_span;
     }
@@ -746,6 +1044,11 @@ public:
         };
     }
 
+    uint32_t matching_target_info(T2Pairing const& prev_table_pair, uint32_t match_key_r) override
+    {
+        return proof_core_.matching_target(3, prev_table_pair.meta, match_key_r);
+    }
+
     void handle_pair_into(T2Pairing const& l_candidate,
         T2Pairing const& r_candidate,
         std::span<T3Pairing> out_pairs,
@@ -761,6 +1064,8 @@ public:
             return;
 
         T3Pairing pairing = *opt_res;
+        if (!keep_output_(pairing))
+            return;
 
 #ifdef RETAIN_X_VALUES_TO_T3
         for (int i = 0; i < 4; ++i) {
@@ -776,8 +1081,14 @@ public:
         out_pairs[idx] = pairing;
     }
 
-    std::span<T3Pairing> post_construct_span(
-        std::span<T3Pairing> pairings, std::span<T3Pairing> tmp_pairings) override
+    // T3 is sorted on the 2k-bit proof fragment, so its sections are the fragment's top bits.
+    uint32_t output_section(T3Pairing const& pairing) const override
+    {
+        int const shift = 2 * params_.get_k() - numeric_cast<int>(params_.get_num_section_bits());
+        return static_cast<uint32_t>(pairing.proof_fragment >> shift);
+    }
+
+    std::span<T3Pairing> post_construct_span(std::span<T3Pairing> pairings) override
     {
         minor_scratch_arena_->reset();
 
@@ -787,8 +1098,9 @@ public:
 
         timer_.start("Sorting T3Pairing");
         std::span<T3Pairing> sorted_span
-            = radix_sort.sort(pairings, tmp_pairings, params_.get_k() * 2, minor_scratch_arena_);
+            = radix_sort.sort_in_place(pairings, params_.get_k() * 2, minor_scratch_arena_);
         timings.post_sort_time_ms += timer_.stop();
+        timings.post_sort_counters += timer_.counters();
 
         return sorted_span;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/Utils.hpp"
+#include "pos/ProofConstants.hpp"
 #include <array>
 #include <cassert>
 #include <cstdint>
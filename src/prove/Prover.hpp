@@ -73,12 +73,9 @@ public:
         }
 #endif
 
-        // Read all NUM_CHALLENGE_SETS fragment lists from the plot.
-        std::array<std::vector<ProofFragment>, NUM_CHALLENGE_SETS> proof_fragments_per_set;
-        for (int i = 0; i < NUM_CHALLENGE_SETS; ++i) {
-            proof_fragments_per_set[i]
-                = plot_file_.getProofFragmentsInRange(selected_sets.fragment_set_ranges[i]);
-        }
+        // Read all NUM_CHALLENGE_SETS fragment lists from the plot, as one I/O plan.
+        std::vector<std::vector<ProofFragment>> const proof_fragments_per_set
+            = plot_file_.getProofFragmentsInRanges(selected_sets.fragment_set_ranges);
 
 // check count of proof fragments
 #ifdef DEBUG_PROVER
@@ -111,6 +108,12 @@ public:
 
     ProofParams const& getProofParams() { return plot_file_.getProofParams(); }
 
+    // Shares decoded chunks with other challenges and Provers; see PlotFile::setChunkCache.
+    void setChunkCache(std::shared_ptr<ChunkCache> cache)
+    {
+        plot_file_.setChunkCache(std::move(cache));
+    }
+
 private:
     PlotFile plot_file_;
     std::string plot_file_name_;
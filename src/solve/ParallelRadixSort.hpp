@@ -1,8 +1,11 @@
 #pragma once
 
+#include "common/ParallelPrefixSum.hpp"
 #include "common/Timer.hpp"
 #include "common/thread.hpp"
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <span>
 #include <vector>
@@ -25,7 +28,10 @@ public:
             timer.start();
         }
 
-        std::vector<std::vector<int>> counts_by_thread(num_threads, std::vector<int>(radix, 0));
+        // [num_threads][radix] histograms, and each thread's first output index per bucket
+        std::vector<uint32_t> counts_by_thread(std::size_t(num_threads) * radix, 0);
+        std::vector<std::size_t> offsets_for_thread(std::size_t(num_threads) * radix, 0);
+        std::vector<std::size_t> bucket_start(std::size_t(radix) + 1, 0);
         // get each threads start and end index
         size_t const num_elements_per_thread = data.size() / num_threads;
 
@@ -43,10 +49,8 @@ public:
                 std::vector<thread> threads;
                 for (int t = 0; t < num_threads; ++t) {
                     threads.emplace_back([&, t]() {
-                        // fill counts to zero
-                        for (int r = 0; r < radix; ++r) {
-                            counts_by_thread[t][r] = 0;
-                        }
+                        uint32_t* counts = counts_by_thread.data() + std::size_t(t) * radix;
+                        std::fill(counts, counts + radix, 0u);
 
                         size_t start = num_elements_per_thread * t;
                         size_t end = (t == num_threads - 1) ? data.size()
@@ -54,7 +58,7 @@ public:
 
                         for (size_t i = start; i < end; ++i) {
                             uint32_t key = (data[i] >> shift) & radix_mask;
-                            counts_by_thread[t][key]++;
+                            counts[key]++;
                         }
                     });
                 }
@@ -65,36 +69,14 @@ public:
                 countPhaseTimer.start("Prefix sum phase");
             }
 
-            // now merge all counts into one global count
-            std::vector<uint32_t> counts(radix, 0);
-            for (int t = 0; t < num_threads; ++t) {
-                for (int r = 0; r < radix; ++r) {
-                    counts[r] += counts_by_thread[t][r];
-                }
-            }
-
-            // Prefix sum phase
-            std::vector<std::vector<int>> offsets_for_thread(
-                num_threads, std::vector<int>(radix, 0));
-
-            // first get global offsets
-            std::vector<uint32_t> offsets(radix, 0);
-            for (int i = 1; i < radix; ++i) {
-                offsets[i] = offsets[i - 1] + counts[i - 1];
-            }
-
-            // then update offsets for each thread, with thread 0 using the global offsets and
-            // others threads building on that. t 0 offsets first
-            for (int r = 0; r < radix; ++r) {
-                offsets_for_thread[0][r] = offsets[r];
-            }
-            // t > 0 offsets build on previous ones
-            for (int i = 1; i < num_threads; i++) {
-                for (int r = 0; r < radix; ++r) {
-                    offsets_for_thread[i][r]
-                        = offsets_for_thread[i - 1][r] + counts_by_thread[i - 1][r];
-                }
-            }
+            // Prefix sum phase: global bucket offsets, then each thread's offsets building on the
+            // counts of the threads before it.
+            histogram_offsets(std::span<uint32_t const>(counts_by_thread),
+                std::size_t(num_threads),
+                std::size_t(radix),
+                std::span<std::size_t>(bucket_start),
+                std::span<std::size_t>(offsets_for_thread),
+                static_cast<unsigned>(num_threads));
 
             if (verbose) {
                 countPhaseTimer.stop();
@@ -114,10 +96,10 @@ public:
                         size_t start = num_elements_per_thread * t;
                         size_t end = (t == num_threads - 1) ? data.size()
                                                             : num_elements_per_thread * (t + 1);
+                        std::size_t* offsets = offsets_for_thread.data() + std::size_t(t) * radix;
                         for (size_t i = start; i < end; ++i) {
                             uint32_t key = (data[i] >> shift) & radix_mask;
-                            int outpos = offsets_for_thread[t][key]++;
-                            buffer[outpos] = data[i];
+                            buffer[offsets[key]++] = data[i];
                         }
                     });
                 }
@@ -168,7 +150,11 @@ public:
                       << num_threads << " threads" << std::endl;
         }
 
-        std::vector<std::vector<int>> counts_by_thread(num_threads, std::vector<int>(radix, 0));
+        // [num_threads][radix] histograms, and each thread's first output index per bucket; the
+        // last pass may use a narrower radix with the same buffers.
+        std::vector<uint32_t> counts_by_thread(std::size_t(num_threads) * radix, 0);
+        std::vector<std::size_t> offsets_for_thread(std::size_t(num_threads) * radix, 0);
+        std::vector<std::size_t> bucket_start(std::size_t(radix) + 1, 0);
         size_t const num_elements_per_thread = keys.size() / num_threads;
 
         for (int pass = 0; pass < num_passes; ++pass) {
@@ -193,9 +179,8 @@ public:
                 std::vector<thread> threads;
                 for (int t = 0; t < num_threads; ++t) {
                     threads.emplace_back([&, t]() {
-                        for (int r = 0; r < radix; ++r) {
-                            counts_by_thread[t][r] = 0;
-                        }
+                        uint32_t* counts = counts_by_thread.data() + std::size_t(t) * radix;
+                        std::fill(counts, counts + radix, 0u);
 
                         size_t start = num_elements_per_thread * t;
                         size_t end = (t == num_threads - 1) ? keys.size()
@@ -203,7 +188,7 @@ public:
 
                         for (size_t i = start; i < end; ++i) {
                             uint32_t key = (keys[i] >> shift) & radix_mask;
-                            counts_by_thread[t][key]++;
+                            counts[key]++;
                         }
                     });
                 }
@@ -214,31 +199,14 @@ public:
                 countPhaseTimer.start("Prefix sum phase");
             }
 
-            // Merge counts
-            std::vector<uint32_t> counts(radix, 0);
-            for (int t = 0; t < num_threads; ++t) {
-                for (int r = 0; r < radix; ++r) {
-                    counts[r] += counts_by_thread[t][r];
-                }
-            }
-
             // Prefix sum phase
-            std::vector<std::vector<int>> offsets_for_thread(
-                num_threads, std::vector<int>(radix, 0));
-            std::vector<uint32_t> offsets(radix, 0);
-            for (int i = 1; i < radix; ++i) {
-                offsets[i] = offsets[i - 1] + counts[i - 1];
-            }
-
-            for (int r = 0; r < radix; ++r) {
-                offsets_for_thread[0][r] = offsets[r];
-            }
-            for (int i = 1; i < num_threads; i++) {
-                for (int r = 0; r < radix; ++r) {
-                    offsets_for_thread[i][r]
-                        = offsets_for_thread[i - 1][r] + counts_by_thread[i - 1][r];
-                }
-            }
+            histogram_offsets(std::span<uint32_t const>(counts_by_thread.data(),
+                                  std::size_t(num_threads) * radix),
+                std::size_t(num_threads),
+                std::size_t(radix),
+                std::span<std::size_t>(bucket_start.data(), std::size_t(radix) + 1),
+                std::span<std::size_t>(offsets_for_thread.data(), std::size_t(num_threads) * radix),
+                static_cast<unsigned>(num_threads));
 
             if (verbose) {
                 countPhaseTimer.stop();
@@ -253,9 +221,10 @@ public:
                         size_t start = num_elements_per_thread * t;
                         size_t end = (t == num_threads - 1) ? keys.size()
                                                             : num_elements_per_thread * (t + 1);
+                        std::size_t* offsets = offsets_for_thread.data() + std::size_t(t) * radix;
                         for (size_t i = start; i < end; ++i) {
                             uint32_t key = (keys[i] >> shift) & radix_mask;
-                            int outpos = offsets_for_thread[t][key]++;
+                            std::size_t const outpos = offsets[key]++;
                             keyBuffer[outpos] = keys[i];
                             valueBuffer[outpos] = values[i];
                         }
@@ -1,7 +1,9 @@
 #pragma once
+#include "common/PerfCounters.hpp"
 #include "common/Timer.hpp"
 #include <iomanip>
 #include <iostream>
+#include <ostream>
 #include <string>
 
 struct ProofSolverTimings {
@@ -19,6 +21,21 @@ struct ProofSolverTimings {
     double t2_scan_for_matches = 0;
     double misc = 0;
 
+    // Hardware counters per phase, valid only while a PerfCounterSession is open.
+    PerfCounterValues allocating_counters;
+    PerfCounterValues hashing_x1s_counters;
+    PerfCounterValues sorting_x1s_counters;
+    PerfCounterValues bitmaskfillzero_counters;
+    PerfCounterValues bitmasksetx1s_counters;
+    PerfCounterValues chachafilterx2sbybitmask_counters;
+    PerfCounterValues sorting_filtered_x2s_counters;
+    PerfCounterValues match_x1_x2_sorted_lists_counters;
+    PerfCounterValues t2_matches_counters;
+    PerfCounterValues t2_gen_L_list_counters;
+    PerfCounterValues t2_sort_short_list_counters;
+    PerfCounterValues t2_scan_for_matches_counters;
+    PerfCounterValues misc_counters;
+
     void printSummary() const
     {
         constexpr int LABEL_W = 25;
@@ -65,5 +82,53 @@ struct ProofSolverTimings {
         os << std::left << std::setw(LABEL_W) << "Non-allocating total" << ": " << std::right
            << std::setw(VALUE_W) << nonAllocTotal << " ms\n";
         os << sep << "\n";
+
+        printCounters(os);
+    }
+
+    // Per-phase hardware counters; prints nothing when they were not counted.
+    void printCounters(std::ostream& os) const
+    {
+        PerfCounterValues total;
+        for (PerfCounterValues const* c: { &allocating_counters, &hashing_x1s_counters,
+                 &sorting_x1s_counters, &bitmaskfillzero_counters, &bitmasksetx1s_counters,
+                 &chachafilterx2sbybitmask_counters, &sorting_filtered_x2s_counters,
+                 &match_x1_x2_sorted_lists_counters, &t2_matches_counters, &misc_counters })
+            total += *c;
+        if (!total.valid)
+            return;
+
+        constexpr int LABEL_W = 25;
+        constexpr int VALUE_W = 12;
+        std::string const sep(LABEL_W + 4 * VALUE_W + 2, '-');
+
+        auto const row = [&](char const* label, PerfCounterValues const& c) {
+            os << std::left << std::setw(LABEL_W) << label << ": " << std::right
+               << std::setw(VALUE_W) << std::setprecision(2) << c.cycles / 1e6
+               << std::setw(VALUE_W) << c.ipc() << std::setw(VALUE_W) << c.llc_misses
+               << std::setw(VALUE_W) << c.dtlb_misses << "\n";
+        };
+
+        os << std::setfill(' ') << std::fixed;
+        os << std::left << std::setw(LABEL_W) << "Hardware counters" << "  " << std::right
+           << std::setw(VALUE_W) << "Mcycles" << std::setw(VALUE_W) << "IPC"
+           << std::setw(VALUE_W) << "LLC misses" << std::setw(VALUE_W) << "dTLB misses" << "\n";
+        os << sep << "\n";
+        row("Allocating", allocating_counters);
+        row("Hashing x1's", hashing_x1s_counters);
+        row("Sorting x1's", sorting_x1s_counters);
+        row("Bitmask fill zero", bitmaskfillzero_counters);
+        row("Bitmask set x1's", bitmasksetx1s_counters);
+        row("Chacha filter x2's", chachafilterx2sbybitmask_counters);
+        row("Sorting filtered x2's", sorting_filtered_x2s_counters);
+        row("Match x1 x2 sorted", match_x1_x2_sorted_lists_counters);
+        row("T2 matches", t2_matches_counters);
+        row(" - T2 gen L list", t2_gen_L_list_counters);
+        row(" - T2 sort short list", t2_sort_short_list_counters);
+        row(" - T2 scan for matches", t2_scan_for_matches_counters);
+        row("Misc", misc_counters);
+        os << sep << "\n";
+        row("Total", total);
+        os << sep << "\n";
     }
 };
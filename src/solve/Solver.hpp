@@ -8,6 +8,7 @@
 #include "pos/ProofValidator.hpp"
 
 #include "common/ParallelForRange.hpp"
+#include "common/SortedIntersect.hpp"
 #include <algorithm>
 #include <array>
 #include <atomic>
@@ -204,6 +205,7 @@ public:
         std::vector<uint32_t> x1s(num_match_target_hashes);
         std::vector<uint32_t> x1_hashes(num_match_target_hashes);
         timings_.allocating += timer.stop();
+        timings_.allocating_counters += timer.counters();
 
         // Phase 2: Hash x1 candidates for comparing match info's
         hashX1Candidates(x_bits_group.unique_x_bits_list, x1_bits, x1_range_size, x1s, x1_hashes);
@@ -212,12 +214,14 @@ public:
         std::vector<uint32_t> x1s_sort_buffer(x1_hashes.size());
         std::vector<uint32_t> x1_hashes_sort_buffer(x1_hashes.size());
         timings_.allocating += timer.stop();
+        timings_.allocating_counters += timer.counters();
 
         // Phase 3: Sort x1 candidates using parallel radix sort.
         timer.start("Sorting " + std::to_string(x1_hashes.size()) + " x1's");
         ParallelRadixSort radixSort;
         radixSort.sortByKey(x1_hashes, x1s, x1_hashes_sort_buffer, x1s_sort_buffer, num_k_bits_);
         timings_.sorting_x1s += timer.stop();
+        timings_.sorting_x1s_counters += timer.counters();
 
         // Phase 4: Build a bitmask from the sorted x1 hashes.
         std::vector<uint32_t> x1_bitmask;
@@ -241,6 +245,7 @@ public:
             x1_hashes_sort_buffer,
             num_k_bits_);
         timings_.sorting_filtered_x2s += timer.stop();
+        timings_.sorting_filtered_x2s_counters += timer.counters();
 
         // Phase 7: Match x1 and x2 entries within corresponding sections.
         std::vector<T1_Match> t1_matches = matchT1Candidates(x1_hashes,
@@ -454,6 +459,7 @@ public:
         }
 
         timings_.misc += timer.stop();
+        timings_.misc_counters += timer.counters();
     }
 
     // Phase 12 helper: Construct final proofs from T3 matches.
@@ -557,6 +563,7 @@ public:
                 R_sorted.end(),
                 [](const T1_Match& a, const T1_Match& b) { return a.pair_hash < b.pair_hash; });
             timings_.t2_sort_short_list += sub_timer.stop();
+            timings_.t2_sort_short_list_counters += sub_timer.counters();
 
             // --- build hash_to_index: reduced hash -> first index in R_sorted with that reduced
             // value ---
@@ -587,6 +594,7 @@ public:
 
             timings_.t2_sort_short_list
                 += sub_timer.stop(); // reuse this bucket for index build time
+            timings_.t2_sort_short_list_counters += sub_timer.counters();
 
             auto const& L_list = t1_match_groups[t1_group_l];
             uint32_t num_match_keys = 1u << num_T2_match_key_bits;
@@ -681,12 +689,14 @@ public:
                 });
 
             timings_.t2_gen_L_list += sub_timer.stop();
+            timings_.t2_gen_L_list_counters += sub_timer.counters();
 
             // We folded the old two-pointer scan work into the L loop above,
             // so we don't add to t2_scan_for_matches here.
         }
 
         timings_.t2_matches += timer.stop();
+        timings_.t2_matches_counters += timer.counters();
         return t2_matches;
     }
 
@@ -732,6 +742,7 @@ public:
             match_lists[lookup_index].push_back(match);
         }
         timings_.misc += timer.stop();
+        timings_.misc_counters += timer.counters();
 
         return match_lists;
     }
@@ -750,6 +761,7 @@ public:
         auto const section_boundaries_x2 = computeSectionBoundaries(x2_match_hashes);
 
         timings_.misc += timer.stop();
+        timings_.misc_counters += timer.counters();
 
         if (false) {
             // show section boundaries
@@ -848,17 +860,12 @@ public:
                     ? static_cast<int>(x2_match_hashes.size())
                     : section_boundaries_x2[section + 1];
 
-                int i = x1_start, j = x2_start;
-                while (i < x1_end && j < x2_end) {
-                    uint32_t h1 = x1_hashes[i];
-                    uint32_t h2 = x2_match_hashes[j];
-
-                    if (h1 == h2) {
-                        // scan all equal h1 entries
-                        int ti = i;
-                        while (ti < x1_end && x1_hashes[ti] == h2) {
-                            uint32_t xx1 = x1s[ti];
-                            uint32_t xx2 = x2_match_xs[j];
+                intersect_sorted(SortedKeys::of(x1_hashes.subspan(x1_start, x1_end - x1_start)),
+                    SortedKeys::of(x2_match_hashes.subspan(x2_start, x2_end - x2_start)),
+                    [&](std::size_t i_begin, std::size_t i_end, std::size_t j) {
+                        uint32_t const xx2 = x2_match_xs[x2_start + j];
+                        for (std::size_t ti = x1_start + i_begin; ti < x1_start + i_end; ++ti) {
+                            uint32_t const xx1 = x1s[ti];
 
                             auto pairing = proof_core.pairing_t1(xx1, xx2);
                             if (pairing.has_value()) {
@@ -873,17 +880,8 @@ public:
                                 m.pair_hash = pairing->match_info;
                                 t1_matches[pos] = m;
                             }
-                            ++ti;
                         }
-                        ++j;
-                    }
-                    else if (h1 < h2) {
-                        ++i;
-                    }
-                    else {
-                        ++j;
-                    }
-                }
+                    });
             });
         }
         else {
@@ -922,17 +920,15 @@ public:
                     // "), x2 [" << x2_start << ", " << x2_end << ") length: " << (x1_end -
                     // x1_start) << ", " << (x2_end - x2_start) << std::endl;
 
-                    int i = x1_start, j = x2_start;
-                    while (i < x1_end && j < x2_end) {
-                        uint32_t const h1 = x1_hashes[i];
-                        uint32_t const h2 = x2_match_hashes[j];
-
-                        if (h1 == h2) {
-                            // scan all equal h1 entries
-                            int ti = i;
-                            while (ti < x1_end && x1_hashes[ti] == h2) {
+                    auto const x1_keys = x1_hashes.subspan(x1_start, x1_end - x1_start);
+                    auto const x2_keys = x2_match_hashes.subspan(x2_start, x2_end - x2_start);
+                    intersect_sorted(SortedKeys::of(x1_keys),
+                        SortedKeys::of(x2_keys),
+                        [&](std::size_t i_begin, std::size_t i_end, std::size_t j) {
+                            uint32_t const xx2 = x2_match_xs[x2_start + j];
+                            for (std::size_t ti = x1_start + i_begin; ti < x1_start + i_end;
+                                ++ti) {
                                 uint32_t const xx1 = x1s[ti];
-                                uint32_t const xx2 = x2_match_xs[j];
 
                                 auto pairing = proof_core.pairing_t1(xx1, xx2);
                                 if (pairing.has_value()) {
@@ -947,21 +943,13 @@ public:
                                     m.pair_hash = pairing->match_info;
                                     t1_matches[pos] = m;
                                 }
-                                ++ti;
                             }
-                            ++j;
-                        }
-                        else if (h1 < h2) {
-                            ++i;
-                        }
-                        else {
-                            ++j;
-                        }
-                    }
+                        });
                 });
             }
         }
         timings_.match_x1_x2_sorted_lists += timer.stop();
+        timings_.match_x1_x2_sorted_lists_counters += timer.counters();
 
         // 5) trim to actual match count and return
         int const total = t1_num_matches.load(std::memory_order_relaxed);
@@ -1187,6 +1175,7 @@ public:
         x2_potential_match_xs.resize(num_threads * MAX_RESULTS_PER_THREAD);
         x2_potential_match_hashes.resize(num_threads * MAX_RESULTS_PER_THREAD);
         timings_.allocating += timer.stop();
+        timings_.allocating_counters += timer.counters();
 
         // per-thread match counts
         std::vector<int> matches_per_thread(num_threads, 0);
@@ -1334,6 +1323,7 @@ public:
                 matches_per_thread[t] = thread_matches;
             });
             timings_.chachafilterx2sbybitmask += timer.stop();
+            timings_.chachafilterx2sbybitmask_counters += timer.counters();
         }
 
         if (failed.load()) {
@@ -1347,6 +1337,7 @@ public:
         for (int m: matches_per_thread)
             total += m;
         timings_.misc += timer.stop();
+        timings_.misc_counters += timer.counters();
         // std::cout << "TOTAL x2 potential matches: " << total << std::endl;
 
         timer.start("Compacting x2 potential matches");
@@ -1363,6 +1354,7 @@ public:
         x2_potential_match_hashes.resize(total);
         // std::cout << "x2_potential_match_xs size: " << x2_potential_match_xs.size() << std::endl;
         timings_.misc += timer.stop();
+        timings_.misc_counters += timer.counters();
     }
 
     void hashX1Candidates(std::span<uint32_t const> const x_bits_list,
@@ -1425,6 +1417,7 @@ public:
         });
 
         timings_.hashing_x1s += timer.stop();
+        timings_.hashing_x1s_counters += timer.counters();
     }
 
     // Phase 4 helper: Build a bitmask from the sorted x1 hashes.
@@ -1438,6 +1431,7 @@ public:
         timer.start("Allocating bitmask and setting to zero");
         x1_bitmask.assign(BITMASK_SIZE, 0);
         timings_.bitmaskfillzero += timer.stop();
+        timings_.bitmaskfillzero_counters += timer.counters();
 
         // TODO: could be multi-threaded
         timer.start("Setting bitmask hash");
@@ -1448,6 +1442,7 @@ public:
             x1_bitmask[slot] |= (1 << bit);
         }
         timings_.bitmasksetx1s += timer.stop();
+        timings_.bitmasksetx1s_counters += timer.counters();
 
 #ifdef DEBUG_VERIFY
         if (false) {
@@ -13,7 +13,8 @@ void printUsage()
     std::cout << "Usage:\n"
               << "  analytics simdiskusage [plotIdFilter=256] [diskTB=20] [diskSeekMs=10] "
                  "[diskReadMBs=70]\n"
-              << "  analytics hashbench [N (for 2^N)] [rounds=16] [threads=max]\n";
+              << "  analytics hashbench [N (for 2^N)] [rounds=16] [threads=max]\n"
+              << "  analytics codecbench [plotFile] [maxChunks=16] [repeats=5]\n";
 }
 
 int hashBench(int N, int rounds, int num_threads)
@@ -130,6 +131,133 @@ int hashBench(int N, int rounds, int num_threads)
     return 0;
 }
 
+// Recompresses the chunks of a plot with each delta codec, as the plotter would write them, and
+// reports the size and the single-threaded decode speed: of the deltas alone (GB/s of deltas) and
+// of whole chunks into fragments (GB/s of 8-byte fragments).
+int codecBench(std::string const& plot_file_name, uint64_t max_chunks, int repeats)
+{
+    PlotFile plot_file(plot_file_name, PlotFile::ReadMethod::Mapped);
+    ProofParams const params = plot_file.getProofParams();
+    int const k = params.get_k();
+    int const stub_bits = k - PlotFile::MINUS_STUB_BITS;
+    int const block_bits = k + PlotFile::SEEK_BLOCK_RANGE_BITS;
+    int const num_blocks_bits = PlotFile::CHUNK_SPAN_RANGE_BITS - PlotFile::SEEK_BLOCK_RANGE_BITS;
+    uint64_t const range_per_chunk = 1ULL << (k + PlotFile::CHUNK_SPAN_RANGE_BITS);
+    uint64_t const num_chunks = std::min(plot_file.getNumChunks(), max_chunks);
+
+    std::vector<std::vector<ProofFragment>> chunks(num_chunks);
+    std::vector<std::vector<uint8_t>> block_deltas; // the seek blocks' deltas
+    uint64_t num_fragments = 0;
+    for (uint64_t c = 0; c < num_chunks; ++c) {
+        chunks[c] = plot_file.readChunk(c);
+        num_fragments += chunks[c].size();
+        auto begin = chunks[c].begin();
+        for (uint64_t b = 0; b < (1ULL << num_blocks_bits); ++b) {
+            uint64_t const block_start = c * range_per_chunk + (b << block_bits);
+            auto const end = std::lower_bound(
+                begin, chunks[c].end(), block_start + (1ULL << block_bits));
+            block_deltas.push_back(ChunkCompressor::deltifyAndStubProofFragments(
+                block_start, std::span<ProofFragment const>(begin, end), stub_bits)
+                                       .first);
+            begin = end;
+        }
+    }
+    std::cout << "Plot " << plot_file_name << ": k" << k << ", written with "
+              << delta_codec_name(plot_file.getDeltaCodec()) << " deltas; " << num_chunks
+              << " chunks, " << num_fragments << " fragments, " << block_deltas.size()
+              << " seek blocks\n";
+    if (num_fragments == 0) {
+        return 1;
+    }
+
+    auto const seconds_since = [](std::chrono::steady_clock::time_point t0) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    };
+    // fse-shared codes every block with one table trained on all of them (as a plot would)
+    std::array<uint64_t, 256> counts {};
+    for (std::vector<uint8_t> const& deltas: block_deltas) {
+        for (uint8_t d: deltas)
+            ++counts[d];
+    }
+    std::shared_ptr<SharedFseTable const> const fse_table = SharedFseTable::train(counts);
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "codec        chunk bytes  bits/fragment  vs fse   deltas GB/s  chunks GB/s\n";
+    uint64_t fse_bytes = 0;
+    for (DeltaCodec codec: kDeltaCodecs) {
+        if (codec == DeltaCodec::FseShared && !fse_table) {
+            continue; // a single delta value
+        }
+        DeltaCoding const coding(codec, fse_table.get());
+        std::vector<std::vector<uint8_t>> compressed(num_chunks);
+        // the shared table is stored once, in the plot header
+        uint64_t total_bytes = codec == DeltaCodec::FseShared ? fse_table->serialized().size() : 0;
+        for (uint64_t c = 0; c < num_chunks; ++c) {
+            compressed[c] = ChunkCompressor::compressSeekableProofFragments(
+                chunks[c], c * range_per_chunk, block_bits, num_blocks_bits, stub_bits, coding);
+            total_bytes += compressed[c].size();
+        }
+        if (codec == DeltaCodec::Fse) {
+            fse_bytes = total_bytes;
+        }
+
+        // blocks the codec cannot shrink are stored raw and never decoded, so they do not count
+        // towards the deltas' speed
+        std::vector<std::vector<uint8_t>> coded(block_deltas.size());
+        uint64_t coded_deltas = 0;
+        for (size_t b = 0; b < block_deltas.size(); ++b) {
+            coded[b] = DeltaCoder::encode(coding, block_deltas[b]);
+            if (!coded[b].empty()) {
+                coded_deltas += block_deltas[b].size();
+            }
+        }
+        std::vector<uint8_t> decoded;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            for (size_t b = 0; b < block_deltas.size(); ++b) {
+                if (coded[b].empty()) {
+                    continue; // stored raw
+                }
+                decoded.resize(block_deltas[b].size());
+                DeltaCoder::decode(coding, coded[b], decoded);
+            }
+        }
+        double const delta_seconds = seconds_since(t0);
+
+        t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            for (uint64_t c = 0; c < num_chunks; ++c) {
+                std::vector<ProofFragment> const fragments
+                    = ChunkCompressor::decompressSeekableProofFragments(compressed[c],
+                        c * range_per_chunk,
+                        block_bits,
+                        num_blocks_bits,
+                        stub_bits,
+                        coding);
+                if (fragments != chunks[c]) {
+                    std::cerr << "Error: " << delta_codec_name(codec) << " round trip of chunk "
+                              << c << " differs\n";
+                    return 1;
+                }
+            }
+        }
+        double const chunk_seconds = seconds_since(t0);
+
+        double const decoded_deltas = static_cast<double>(coded_deltas) * repeats;
+        double const decoded_fragments = static_cast<double>(num_fragments) * repeats;
+        double const bits_per_fragment
+            = static_cast<double>(total_bytes) * 8.0 / static_cast<double>(num_fragments);
+        double const vs_fse
+            = (static_cast<double>(total_bytes) / static_cast<double>(fse_bytes) - 1.0) * 100.0;
+        std::cout << std::left << std::setw(11) << delta_codec_name(codec) << std::right
+                  << std::setw(13) << total_bytes << std::setw(15) << bits_per_fragment
+                  << std::setw(7) << vs_fse << "%" << std::setw(13)
+                  << decoded_deltas / delta_seconds / 1e9 << std::setw(13)
+                  << decoded_fragments * sizeof(ProofFragment) / chunk_seconds / 1e9 << "\n";
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[])
 try {
     std::cout << "ChiaPOS2 Analytics" << std::endl;
@@ -198,7 +326,10 @@ try {
         }
         std::cout << "Analyzing plot file: " << plotFile << " for groupings of " << numPlotsInGroup
                   << " plots over " << num_trials << " trials.\n";
-        PlotFile plot_file(plotFile);
+        PlotFile plot_file(plotFile, PlotFile::ReadMethod::Mapped);
+        // consecutive sets share a seek block; decode each block once
+        auto chunk_cache = std::make_shared<ChunkCache>(size_t(64) << 20);
+        plot_file.setChunkCache(chunk_cache);
         ProofParams params = plot_file.getProofParams();
         // get number of challenge ranges in plot
         uint32_t num_challenge_ranges = params.get_num_chaining_sets();
@@ -216,6 +347,9 @@ try {
             std::vector<ProofFragment> fragments = plot_file.getProofFragmentsInRange(range);
             challenge_range_counts[challenge_range] = static_cast<int>(fragments.size());
         }
+        ChunkCache::Stats const cache_stats = chunk_cache->stats();
+        std::cout << "Chunk cache: " << cache_stats.hits << " hits, " << cache_stats.misses
+                  << " misses\n";
 
         // set random generator from 0 to num_challenge_ranges - 1
         std::mt19937 rng(std::random_device {}());
@@ -299,6 +433,22 @@ try {
         }
         return hashBench(N, rounds, num_threads);
     }
+    else if (mode == "codecbench") {
+        if (argc < 3 || argc > 5) {
+            std::cerr << "Usage: " << argv[0]
+                      << " codecbench [plotFile] [maxChunks=16] [repeats=5]\n";
+            return 1;
+        }
+        uint64_t max_chunks = 16;
+        int repeats = 5;
+        if (argc >= 4) {
+            max_chunks = std::stoull(argv[3]);
+        }
+        if (argc >= 5) {
+            repeats = std::max(1, std::stoi(argv[4]));
+        }
+        return codecBench(argv[2], max_chunks, repeats);
+    }
     else {
         std::cerr << "Unknown mode: " << mode << std::endl;
         printUsage();
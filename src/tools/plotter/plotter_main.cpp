@@ -1,12 +1,16 @@
 #include "common/Utils.hpp"
+#include "plot/AsyncProgressSink.hpp"
+#include "plot/ChromeTraceSink.hpp"
 #include "plot/PlotFile.hpp"
 #include "plot/Plotter.hpp"
 #include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <future>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,7 +25,24 @@ static void print_usage(char const* prog)
         << "    [plot_index]   : optional, defaults to 0\n"
         << "    [meta_group]   : optional, defaults to 0\n"
         << "    [verbose]      : optional, 0 (default) for progress bar, 1 for verbose output\n"
-        << "    [--testnet]    : optional, use testnet parameters\n";
+        << "    [--testnet]    : optional, use testnet parameters\n"
+        << "    [--checkpoint-dir <dir>] : optional, checkpoint each table to <dir> and resume\n"
+        << "                               from the latest checkpoint found there\n"
+        << "    [--ram-budget-mb <mb>]   : optional, cap plotting memory; tables are built in\n"
+        << "                               several passes and spilled to disk when needed\n"
+        << "    [--pair-join sort|hash]  : optional, L/R join strategy (default sort)\n"
+        << "    [--wavefront]            : optional, experimental: overlap each table's sort\n"
+        << "                               with the next table's matching\n"
+        << "    [--report-json <file>]   : optional, write a per-table performance report\n"
+        << "    [--trace <file>]         : optional, write a Chrome trace / Perfetto timeline\n"
+        << "    [--perf-counters]        : optional, hardware counters per phase in the report\n"
+        << "                               and trace (Linux perf events)\n"
+        << "    [--delta-codec fse|huffman|rans|fse-shared] : optional, entropy coder for the\n"
+        << "                               chunk deltas (default fse; huffman and rans decode\n"
+        << "                               faster; fse-shared keeps one FSE table per plot)\n"
+        << "  " << prog << " bench-join <k> <plot_id_hex> [strength] [repeats]\n"
+        << "    Plots in memory with the sort-merge and the hash join, checks both produce the\n"
+        << "    same plot and prints the best wall time of each over [repeats] (default 1) runs\n";
 }
 
 static void render_progress_line(
@@ -58,6 +79,70 @@ static void render_progress_line(
               << "\x1b[K" << std::flush;
 }
 
+static PairJoin parse_pair_join(std::string const& name)
+{
+    if (name == "sort")
+        return PairJoin::SortMerge;
+    if (name == "hash")
+        return PairJoin::HashJoin;
+    throw std::runtime_error("unknown pair join '" + name + "', expected sort or hash");
+}
+
+// bench-join <k> <plot_id_hex> [strength] [repeats]
+static int bench_join(int argc, char* argv[])
+{
+    if (argc < 4) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    int const k = std::atoi(argv[2]);
+    std::string const plot_id_hex = argv[3];
+    int const strength = argc >= 5 ? std::atoi(argv[4]) : 2;
+    int const repeats = std::max(1, argc >= 6 ? std::atoi(argv[5]) : 1);
+    if ((k < 18) || (k > 32) || (k % 2 != 0) || plot_id_hex.size() != 64 || strength < 2
+        || strength > 255) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    ProofParams params(Utils::hexToBytes(plot_id_hex).data(),
+        numeric_cast<uint8_t>(k),
+        numeric_cast<uint8_t>(strength),
+        0);
+    Plotter plotter(params);
+
+    struct Strategy {
+        char const* name;
+        PairJoin join;
+    };
+    Strategy const strategies[] = { { "sort-merge", PairJoin::SortMerge },
+        { "hash-join", PairJoin::HashJoin } };
+
+    std::optional<PlotData> reference;
+    for (auto const& strategy: strategies) {
+        Plotter::Options opt;
+        opt.pair_join = strategy.join;
+        double best_s = 0.0;
+        for (int r = 0; r < repeats; ++r) {
+            auto const start = std::chrono::steady_clock::now();
+            PlotData plot = plotter.run(opt);
+            double const s
+                = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best_s = (r == 0) ? s : std::min(best_s, s);
+
+            if (!reference)
+                reference = std::move(plot);
+            else if (!(plot == *reference)) {
+                std::cerr << "Error: " << strategy.name << " produced a different plot.\n";
+                return 1;
+            }
+        }
+        std::cout << "k" << k << " " << strategy.name << ": " << best_s << " s (best of "
+                  << repeats << ")" << std::endl;
+    }
+    return 0;
+}
+
 // example usage: ./plotter test 18 0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF
 // 2
 int main(int argc, char* argv[])
@@ -68,6 +153,9 @@ try {
     }
 
     std::string cmd = argv[1];
+    if (cmd == "bench-join") {
+        return bench_join(argc, argv);
+    }
     if (cmd != "test") {
         print_usage(argv[0]);
         return 1;
@@ -82,6 +170,14 @@ try {
 
     // Scan for --testnet flag and remove it from argv before positional parsing
     bool testnet = false;
+    std::string checkpoint_dir;
+    std::size_t ram_budget_mb = 0;
+    PairJoin pair_join = PairJoin::SortMerge;
+    bool wavefront = false;
+    std::string report_json;
+    std::string trace_path;
+    bool perf_counters = false;
+    DeltaCodec delta_codec = DeltaCodec::Fse;
     std::vector<char*> positional_args;
     positional_args.push_back(argv[0]);
     positional_args.push_back(argv[1]);
@@ -89,6 +185,36 @@ try {
         if (std::string(argv[i]) == "--testnet") {
             testnet = true;
         }
+        else if (std::string(argv[i]) == "--checkpoint-dir" && i + 1 < argc) {
+            checkpoint_dir = argv[++i];
+        }
+        else if (std::string(argv[i]) == "--ram-budget-mb" && i + 1 < argc) {
+            ram_budget_mb = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (std::string(argv[i]) == "--pair-join" && i + 1 < argc) {
+            pair_join = parse_pair_join(argv[++i]);
+        }
+        else if (std::string(argv[i]) == "--wavefront") {
+            wavefront = true;
+        }
+        else if (std::string(argv[i]) == "--report-json" && i + 1 < argc) {
+            report_json = argv[++i];
+        }
+        else if (std::string(argv[i]) == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+        }
+        else if (std::string(argv[i]) == "--perf-counters") {
+            perf_counters = true;
+        }
+        else if (std::string(argv[i]) == "--delta-codec" && i + 1 < argc) {
+            std::optional<DeltaCodec> const codec = parse_delta_codec(argv[++i]);
+            if (!codec) {
+                std::cerr << "Error: unknown delta codec '" << argv[i]
+                          << "', expected fse, huffman, rans or fse-shared.\n";
+                return 1;
+            }
+            delta_codec = *codec;
+        }
         else {
             positional_args.push_back(argv[i]);
         }
@@ -154,6 +280,16 @@ try {
     Plotter::Options opt;
     opt.validate = false;
     opt.verbose = verbose;
+    opt.checkpoint_dir = checkpoint_dir;
+    opt.ram_budget_bytes = ram_budget_mb * 1024 * 1024;
+    opt.pair_join = pair_join;
+    opt.wavefront = wavefront;
+    opt.perf_counters = perf_counters;
+    if (perf_counters && !PerfCounterSession().available())
+        std::cerr << "Warning: hardware performance counters are not available.\n";
+    PlotReport report;
+    if (!report_json.empty())
+        opt.report = &report;
 
     ProofParams params(Utils::hexToBytes(plot_id_hex).data(),
         numeric_cast<uint8_t>(k),
@@ -161,8 +297,25 @@ try {
         numeric_cast<uint8_t>(testnet ? 1 : 0));
     Plotter plotter(params);
 
+    if (opt.ram_budget_bytes != 0) {
+        PlotMemoryPlan const plan = plotter.plan_memory(opt);
+        std::cout << "Memory plan: peak " << (plan.peak_bytes >> 20) << " MiB (default layout "
+                  << (plan.default_peak_bytes >> 20) << " MiB, minimum "
+                  << (plan.min_peak_bytes >> 20) << " MiB), " << plan.total_passes()
+                  << " table passes" << std::endl;
+        if (!plan.feasible) {
+            std::cerr << "Error: RAM budget is below the minimum for k" << k << ".\n";
+            return 1;
+        }
+    }
+
     PlotData plot;
 
+    TraceRecorder trace;
+    std::optional<ScopedTraceRecording> trace_recording;
+    if (!trace_path.empty())
+        trace_recording.emplace(trace);
+
     if (testnet) {
         std::cout << "TESTNET plot -- will NOT be valid on mainnet." << std::endl;
     }
@@ -174,17 +327,24 @@ try {
 #endif
 
     if (verbose) {
+        // console output must not hold up the plotting threads
         VerboseConsoleSink console_sink;
-        opt.sink = &console_sink;
-        plot = plotter.run(opt);
+        AsyncProgressSink async_sink(console_sink, std::size_t(1) << 14);
+        ChromeTraceSink trace_sink(trace, async_sink);
+        opt.sink = trace_path.empty() ? static_cast<IProgressSink*>(&async_sink) : &trace_sink;
+        plot = plotter.run_or_resume(opt);
+        async_sink.flush();
+        if (async_sink.dropped() != 0)
+            std::cout << "(" << async_sink.dropped() << " progress events dropped)\n";
         std::cout << "Total T3 entries: " << plot.t3_proof_fragments.size() << "\n";
     }
     else {
         AtomicProgressSink atomic_sink;
-        opt.sink = &atomic_sink;
+        ChromeTraceSink trace_sink(trace, atomic_sink);
+        opt.sink = trace_path.empty() ? static_cast<IProgressSink*>(&atomic_sink) : &trace_sink;
 
         auto start = std::chrono::steady_clock::now();
-        auto fut = std::async(std::launch::async, [&]() { return plotter.run(opt); });
+        auto fut = std::async(std::launch::async, [&]() { return plotter.run_or_resume(opt); });
 
         while (fut.wait_for(std::chrono::milliseconds(500)) != std::future_status::ready) {
             render_progress_line(atomic_sink.snapshot(), start);
@@ -195,6 +355,22 @@ try {
         plot = fut.get();
     }
 
+    if (!trace_path.empty()) {
+        trace_recording.reset();
+        trace.write_file(trace_path);
+        std::cout << "Wrote trace (" << trace.size() << " events) to " << trace_path << std::endl;
+    }
+
+    if (!report_json.empty()) {
+        std::ofstream out(report_json);
+        out << report.to_json() << "\n";
+        if (!out) {
+            std::cerr << "Error: could not write the report to " << report_json << "\n";
+            return 1;
+        }
+        std::cout << "Wrote performance report to " << report_json << std::endl;
+    }
+
 #ifdef RETAIN_X_VALUES
     bool validate = true;
     if (validate) {
@@ -238,7 +414,8 @@ try {
             plotter.getProofParams(),
             numeric_cast<uint16_t>(plot_index),
             numeric_cast<uint8_t>(meta_group),
-            std::array<uint8_t, 32 + 48 + 32>({}));
+            std::array<uint8_t, 32 + 48 + 32>({}),
+            delta_codec);
         double write_time_ms = writeTimer.stop();
 
         double bits_per_entry = (static_cast<double>(bytes_written) * 8.0)
@@ -248,7 +425,8 @@ try {
             return 1;
         }
         std::cout << "Wrote plot file: " << filename << " (" << bytes_written << " bytes) "
-                  << "[" << bits_per_entry << " bits/entry]" << " in " << write_time_ms << " ms\n";
+                  << "[" << bits_per_entry << " bits/entry, " << delta_codec_name(delta_codec)
+                  << " deltas]" << " in " << write_time_ms << " ms\n";
     }
 
     return 0;
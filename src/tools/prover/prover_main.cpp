@@ -194,6 +194,8 @@ try {
     if (mode == "check") {
         std::array<uint8_t, 32> challenge = { 0 };
         Prover prover(plotfile);
+        auto chunk_cache = std::make_shared<ChunkCache>(size_t(256) << 20);
+        prover.setChunkCache(chunk_cache);
         // set random seed
         srand(static_cast<unsigned int>(time(nullptr)));
         size_t num_chains_found = 0;
@@ -264,6 +266,10 @@ try {
                   << "  %:" << ((float)num_chains_found / (float)total_trials) << std::endl;
         std::cout << "   Found 1 in " << (float)total_trials / (float)num_chains_found << " trials."
                   << std::endl;
+        ChunkCache::Stats const cache_stats = chunk_cache->stats();
+        std::cout << "Chunk cache: " << cache_stats.hits << " hits, " << cache_stats.misses
+                  << " misses (" << cache_stats.hit_rate() * 100.0 << "%), "
+                  << cache_stats.evictions << " evictions" << std::endl;
         std::cout << "Prover done." << std::endl;
         return 0;
     }
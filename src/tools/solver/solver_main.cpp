@@ -1,3 +1,5 @@
+#include "common/PerfCounters.hpp"
+#include "common/Trace.hpp"
 #include "common/Utils.hpp"
 #include "plot/PlotFile.hpp"
 #include "pos/ProofFragment.hpp"
@@ -5,7 +7,40 @@
 #include "solve/Solver.hpp"
 #include <cstdlib>
 #include <iostream>
+#include <optional>
 #include <string>
+#include <vector>
+
+// When non-empty, solves are recorded as a Chrome trace / Perfetto timeline to this file.
+static std::string trace_path;
+// Count hardware events per solver phase (in the summary and the trace) and for the whole solve.
+static bool perf_counters = false;
+
+template <typename Fn>
+static auto instrumented(Fn fn)
+{
+    TraceRecorder trace;
+    std::optional<ScopedTraceRecording> recording;
+    if (!trace_path.empty())
+        recording.emplace(trace);
+    std::optional<PerfCounterSession> perf;
+    if (perf_counters)
+        perf.emplace();
+    auto result = fn();
+    if (perf) {
+        PerfCounterValues const total = perf->read();
+        if (total.valid)
+            std::cout << "Hardware counters: {" << total.json_fields() << "}" << std::endl;
+        else
+            std::cout << "Hardware counters are not available." << std::endl;
+    }
+    if (recording) {
+        recording.reset();
+        trace.write_file(trace_path);
+        std::cout << "Wrote trace (" << trace.size() << " events) to " << trace_path << std::endl;
+    }
+    return result;
+}
 
 int benchmark(uint8_t k, uint8_t plot_strength)
 {
@@ -38,8 +73,10 @@ int benchmark(uint8_t k, uint8_t plot_strength)
         x_bits_list_vector.push_back(x_bits_list[i]);
     }
     std::vector<uint32_t> const x_solution;
-    std::vector<std::array<uint32_t, TOTAL_XS_IN_PROOF>> all_proofs = solver.solve(
-        std::span<uint32_t const, TOTAL_T1_PAIRS_IN_PROOF>(x_bits_list_vector), x_solution);
+    std::vector<std::array<uint32_t, TOTAL_XS_IN_PROOF>> all_proofs = instrumented([&]() {
+        return solver.solve(
+            std::span<uint32_t const, TOTAL_T1_PAIRS_IN_PROOF>(x_bits_list_vector), x_solution);
+    });
 
     solver.timings().printSummary();
 
@@ -65,8 +102,10 @@ int xbits(std::string const& plot_id_hex,
     std::cout << "Using prefetching." << std::endl;
 
     std::vector<uint32_t> const x_solution;
-    std::vector<std::array<uint32_t, TOTAL_XS_IN_PROOF>> all_proofs
-        = solver.solve(std::span<uint32_t const, TOTAL_XS_IN_PROOF / 2>(x_bits_list), x_solution);
+    std::vector<std::array<uint32_t, TOTAL_XS_IN_PROOF>> all_proofs = instrumented([&]() {
+        return solver.solve(
+            std::span<uint32_t const, TOTAL_XS_IN_PROOF / 2>(x_bits_list), x_solution);
+    });
 
     solver.timings().printSummary();
 
@@ -86,13 +125,31 @@ int xbits(std::string const& plot_id_hex,
 
 int main(int argc, char* argv[])
 try {
+    // --trace <file> and --perf-counters may appear anywhere; the modes parse the remaining
+    // arguments by position
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        if (std::string(argv[i]) == "--trace" && i + 1 < argc)
+            trace_path = argv[++i];
+        else if (std::string(argv[i]) == "--perf-counters")
+            perf_counters = true;
+        else
+            args.push_back(argv[i]);
+    }
+    argc = static_cast<int>(args.size());
+    args.push_back(nullptr);
+    argv = args.data();
+
     if (argc < 3) {
         std::cerr << "Usage: " << argv[0] << " <mode> <arg>\n"
                   << "Modes:\n"
                   << "  benchmark <k-size> [strength (default 2)]   Run benchmark with the given "
                      "k-size integer and optional plot strength\n"
                   << "  xbits <plot_id_hex> <xbits_hex> <strength>   Solve for proofs given plot "
-                     "ID, partial x-bits, and plot strength\n";
+                     "ID, partial x-bits, and plot strength\n"
+                  << "Options:\n"
+                  << "  --trace <file>   Write a Chrome trace / Perfetto timeline of the solve\n"
+                  << "  --perf-counters  Count cycles, instructions, LLC and dTLB misses (Linux)\n";
         return 1;
     }
 
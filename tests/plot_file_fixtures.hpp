@@ -0,0 +1,596 @@
+#pragma once
+
+// Plot files written by earlier versions of the writer, so tests can check that the current
+// reader still decodes them: format version 1 (whole-chunk compression) and version 2 (seekable
+// chunks, before the delta codec byte). Each is the output of
+//   PlotFile::writeData(file, plot_fixture_chunks(), plot_fixture_params(), 0, 0, memo)
+// with a zeroed 112-byte memo, built from the last commit that wrote that version.
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Utils.hpp"
+#include "plot/PlotData.hpp"
+#include "pos/ProofParams.hpp"
+
+inline ProofParams plot_fixture_params()
+{
+    std::string const plot_id_hex
+        = "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835";
+    return ProofParams(Utils::hexToBytes(plot_id_hex).data(), 18, 2, 0);
+}
+
+// Two chunks with fragments in their first sixteenth, spaced like a k18 plot's.
+inline ChunkedProofFragments plot_fixture_chunks()
+{
+    constexpr int k = 18;
+    uint64_t const range_per_chunk = 1ULL << (k + 16);
+    int const stub_bits = k - 2;
+    ChunkedProofFragments chunked;
+    uint64_t rng = 0x9e3779b97f4a7c15ULL;
+    for (uint64_t c = 0; c < 2; ++c) {
+        std::vector<ProofFragment> chunk;
+        ProofFragment f = c * range_per_chunk;
+        for (;;) {
+            rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+            f += (rng >> 40) % (64ULL << stub_bits);
+            if (f >= c * range_per_chunk + range_per_chunk / 16)
+                break;
+            chunk.push_back(f);
+        }
+        chunked.proof_fragments_chunks.push_back(std::move(chunk));
+    }
+    return chunked;
+}
+
+inline constexpr uint8_t plot_fixture_v1[] = {
+    0x70, 0x6f, 0x73, 0x32, 0x01, 0xc6, 0xb8, 0x47, 0x29, 0xc2, 0x3d, 0xc6, 0xd6, 0x0c, 0x92, 0xf2,
+    0x2c, 0x17, 0x08, 0x3f, 0x47, 0x84, 0x5c, 0x11, 0x79, 0x22, 0x7c, 0x55, 0x09, 0xf0, 0x7a, 0x5d,
+    0x28, 0x04, 0xa7, 0xb8, 0x35, 0x12, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc9, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xaf,
+    0x01, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x42, 0x10, 0x14, 0x0a, 0x41, 0x18, 0x06, 0x61, 0x10,
+    0x84, 0x81, 0x10, 0x8c, 0x61, 0x18, 0x06, 0x40, 0x28, 0x00, 0x61, 0x10, 0x08, 0x80, 0x10, 0x08,
+    0x82, 0x18, 0x03, 0x10, 0x31, 0xc8, 0x18, 0x83, 0x08, 0x31, 0x86, 0x18, 0x23, 0x43, 0x44, 0xc0,
+    0xc6, 0x0d, 0x9c, 0x31, 0x47, 0x09, 0xaa, 0x2f, 0x40, 0xeb, 0x87, 0x68, 0xb9, 0xf4, 0xb4, 0x8e,
+    0xe9, 0x58, 0x05, 0x71, 0xd8, 0x22, 0x88, 0xd4, 0x4f, 0xbe, 0x78, 0xea, 0x89, 0x02, 0x5d, 0x2e,
+    0x60, 0xc9, 0xca, 0xf6, 0x26, 0x82, 0xcd, 0x24, 0xa2, 0x94, 0x1a, 0x45, 0xc3, 0x29, 0x0b, 0xff,
+    0x0f, 0x28, 0xe2, 0x33, 0x4e, 0x47, 0x49, 0x8d, 0x1f, 0x9c, 0xa8, 0x13, 0x9b, 0x87, 0xfe, 0x46,
+    0xc9, 0xc1, 0x21, 0xdc, 0x74, 0x97, 0xf8, 0xfc, 0xbd, 0xde, 0x74, 0x91, 0xf4, 0x53, 0x49, 0xcf,
+    0x51, 0x5f, 0x7b, 0xee, 0xa8, 0x27, 0x6c, 0x26, 0x9d, 0x9a, 0x1e, 0x5f, 0xb1, 0xc0, 0x61, 0x2c,
+    0x41, 0x4c, 0x63, 0xb9, 0x47, 0xb0, 0x44, 0xc2, 0x83, 0x8a, 0xe4, 0x35, 0xfc, 0x63, 0x8c, 0xf5,
+    0x20, 0x47, 0xf5, 0xae, 0x94, 0x16, 0x56, 0x54, 0x33, 0xc1, 0xc0, 0x72, 0x00, 0x10, 0x75, 0xef,
+    0xcf, 0x13, 0xc3, 0x08, 0xe5, 0xf2, 0x15, 0xad, 0xe1, 0x71, 0xe8, 0xe2, 0x1b, 0x8c, 0xbc, 0x44,
+    0x3a, 0x8d, 0x92, 0x89, 0xb2, 0xa1, 0x53, 0xd4, 0x95, 0x47, 0x9b, 0xce, 0x4d, 0x54, 0x74, 0xbc,
+    0x2e, 0x2c, 0x97, 0x7f, 0xc8, 0x4c, 0xea, 0xab, 0x4f, 0x25, 0xfe, 0x41, 0xa9, 0xcf, 0xd9, 0xb5,
+    0xa6, 0xe5, 0x34, 0x2c, 0xd7, 0xd6, 0x1b, 0x2b, 0x23, 0xa8, 0x85, 0x68, 0x9a, 0x87, 0xe9, 0xab,
+    0x86, 0x72, 0x90, 0xf8, 0x64, 0x30, 0x86, 0x59, 0xb5, 0xf4, 0xc2, 0xbe, 0x87, 0xec, 0xc6, 0xb6,
+    0xf6, 0x3b, 0x20, 0xfc, 0xea, 0xcc, 0xdb, 0x07, 0x5d, 0xb0, 0x88, 0x85, 0xff, 0x5f, 0x62, 0x45,
+    0x5b, 0x49, 0x04, 0x31, 0x35, 0xd3, 0xa8, 0xf7, 0x7c, 0xa7, 0x2c, 0x4c, 0xc5, 0xad, 0xc9, 0x09,
+    0xc9, 0x58, 0x14, 0xfb, 0xb4, 0xac, 0xfc, 0x8b, 0x58, 0x92, 0x16, 0xec, 0xbe, 0xff, 0x90, 0x55,
+    0x31, 0x54, 0xf6, 0x99, 0xb5, 0x67, 0xb3, 0xe7, 0x93, 0x50, 0xc9, 0x4d, 0x40, 0x69, 0x65, 0x45,
+    0xc5, 0x2d, 0xd8, 0x98, 0x36, 0x48, 0x64, 0x43, 0x8c, 0xe6, 0xb2, 0xc3, 0x4c, 0x44, 0xb2, 0x04,
+    0xc8, 0x5f, 0x7b, 0x73, 0x0b, 0xe8, 0x37, 0xdc, 0x88, 0x2d, 0xbb, 0x6c, 0x70, 0x45, 0xc5, 0x49,
+    0x36, 0x18, 0x1b, 0xfc, 0x93, 0x0f, 0xad, 0x16, 0x6a, 0xae, 0xf8, 0x41, 0x61, 0x83, 0x10, 0xae,
+    0x91, 0xbb, 0x62, 0x46, 0x0c, 0xd5, 0xa1, 0xf0, 0x0e, 0xf3, 0x6d, 0x1d, 0xa3, 0xa9, 0xde, 0xa5,
+    0xb1, 0xa5, 0x04, 0xd2, 0x8d, 0xe1, 0xf6, 0xc2, 0xbc, 0x70, 0x27, 0x76, 0xd6, 0x34, 0x39, 0xc5,
+    0xc3, 0xad, 0xe8, 0x4a, 0x7c, 0xbd, 0xab, 0xd4, 0x85, 0xfd, 0xc1, 0x90, 0xcd, 0xc7, 0x53, 0x4c,
+    0x2d, 0x7e, 0x39, 0xb6, 0x7a, 0x7e, 0xbc, 0xeb, 0x87, 0x0c, 0xda, 0x8c, 0x70, 0xbf, 0x55, 0x59,
+    0x8a, 0xb7, 0xd1, 0x52, 0x1c, 0x08, 0xee, 0xea, 0x75, 0x80, 0x90, 0xc4, 0xcf, 0x69, 0x2f, 0x7b,
+    0x15, 0xd8, 0x10, 0x6e, 0xe6, 0x69, 0x02, 0xe9, 0x1b, 0x90, 0xa7, 0xca, 0xdb, 0x55, 0xc0, 0x88,
+    0xac, 0xc1, 0x77, 0x5c, 0x36, 0xe8, 0xde, 0x0f, 0x6a, 0x07, 0xcb, 0xa4, 0x55, 0x41, 0xa9, 0x85,
+    0x95, 0x4d, 0xda, 0x96, 0x21, 0xf3, 0x4f, 0xf6, 0x3a, 0x45, 0x1e, 0x19, 0x59, 0x89, 0x8d, 0x51,
+    0x7e, 0x7d, 0x35, 0x27, 0x14, 0x8c, 0x0d, 0x10, 0xb0, 0xb1, 0x49, 0xe6, 0xd0, 0xfd, 0x23, 0x5d,
+    0xba, 0x76, 0xa7, 0xc5, 0xeb, 0xcd, 0x03, 0x48, 0xe7, 0x53, 0x05, 0xad, 0xbd, 0x33, 0x88, 0xc2,
+    0x79, 0x21, 0x0f, 0x0b, 0xbc, 0x09, 0xba, 0x1a, 0xa6, 0x51, 0xc6, 0x1d, 0x8d, 0x7f, 0x33, 0x71,
+    0xf5, 0x97, 0xea, 0x07, 0x50, 0x1b, 0xbf, 0xa9, 0xb3, 0xb8, 0xac, 0x99, 0xb6, 0x9f, 0xbe, 0x9a,
+    0x31, 0xbb, 0x33, 0x84, 0xb7, 0x3d, 0x72, 0x5a, 0xe4, 0xf1, 0xfc, 0x84, 0xa4, 0x9e, 0x9b, 0x85,
+    0xac, 0xb4, 0xb7, 0x91, 0x2c, 0x69, 0x71, 0xec, 0xde, 0xf3, 0x3f, 0xf9, 0x54, 0x12, 0x1c, 0xde,
+    0xc1, 0x9c, 0x9f, 0x1e, 0xd8, 0xa1, 0x9e, 0xab, 0xfc, 0xcf, 0x05, 0xbb, 0x4c, 0x61, 0x6f, 0x79,
+    0x30, 0x94, 0xac, 0x8e, 0x6c, 0x6b, 0xe5, 0x33, 0xab, 0xbf, 0xfe, 0x57, 0x9a, 0xf8, 0xc3, 0xce,
+    0xbc, 0x26, 0x88, 0x63, 0x62, 0xc1, 0x05, 0x87, 0x43, 0xc5, 0xd6, 0xc2, 0x58, 0x66, 0x66, 0x5d,
+    0xbc, 0xac, 0x3f, 0x9d, 0xb5, 0x8f, 0x10, 0xf3, 0x36, 0xb9, 0xa6, 0xe7, 0xb1, 0x38, 0x80, 0x98,
+    0xaa, 0xa3, 0xa4, 0x4f, 0x54, 0xe5, 0xb2, 0x18, 0x25, 0xd5, 0x6b, 0x73, 0xe9, 0x93, 0x0c, 0x2f,
+    0x28, 0xc3, 0xc5, 0x25, 0x04, 0x49, 0x3d, 0x7f, 0x7d, 0x32, 0x3e, 0xe7, 0xdf, 0x0a, 0xbc, 0xad,
+    0xdd, 0x34, 0x50, 0x06, 0x90, 0x2c, 0xf4, 0x6e, 0xd3, 0x1a, 0x45, 0x32, 0x87, 0xe6, 0xdd, 0x35,
+    0x24, 0x34, 0xba, 0x37, 0x0e, 0x01, 0x66, 0xbd, 0x7c, 0x6e, 0x99, 0x38, 0x9c, 0x52, 0x94, 0xa4,
+    0x9d, 0xfe, 0xaf, 0x56, 0xb6, 0x9b, 0x76, 0xf0, 0x66, 0xe2, 0x57, 0x46, 0x11, 0x99, 0x93, 0xf6,
+    0x20, 0x12, 0x12, 0xe1, 0x61, 0x3d, 0x4e, 0x58, 0xa9, 0xa2, 0x2c, 0x7a, 0x56, 0x94, 0xfc, 0x81,
+    0xeb, 0xff, 0x36, 0x59, 0xe0, 0x98, 0x94, 0xdb, 0xc8, 0x5b, 0x7b, 0x56, 0x4c, 0xca, 0x29, 0xf8,
+    0x49, 0x89, 0xb3, 0x0c, 0x9f, 0xb6, 0x34, 0x29, 0x29, 0x43, 0x0f, 0x29, 0xc6, 0x58, 0x14, 0xd0,
+    0x5c, 0x50, 0x58, 0xed, 0xb4, 0xbf, 0x6f, 0x74, 0xe2, 0x07, 0x0d, 0xbc, 0x01, 0x41, 0x55, 0x2d,
+    0x33, 0x51, 0x46, 0xde, 0x45, 0xe0, 0x33, 0x08, 0x78, 0x59, 0x59, 0x4c, 0xe0, 0x12, 0x08, 0x9c,
+    0xcb, 0xdc, 0x31, 0x30, 0x62, 0x02, 0x6d, 0xba, 0xfe, 0xc2, 0x54, 0x37, 0xe4, 0xfb, 0x7f, 0xbc,
+    0x18, 0x5a, 0x11, 0x3b, 0xe3, 0xaf, 0xa3, 0x14, 0x79, 0xef, 0x18, 0xf8, 0xd4, 0x71, 0x35, 0x87,
+    0xe7, 0x29, 0x70, 0x26, 0x8a, 0xa4, 0x24, 0x01, 0x50, 0x21, 0xbf, 0x48, 0xc1, 0xd6, 0x83, 0x17,
+    0xc2, 0x59, 0x82, 0xb8, 0xb4, 0x52, 0x13, 0xb1, 0x18, 0xf3, 0x9c, 0x93, 0x93, 0x6c, 0x60, 0x76,
+    0xdf, 0x21, 0xda, 0xc4, 0x20, 0xc5, 0xd6, 0x9b, 0x0a, 0xb5, 0x2d, 0xf7, 0x9f, 0xba, 0xb8, 0xdb,
+    0x95, 0x62, 0x97, 0x82, 0xef, 0xf0, 0xaf, 0xe9, 0xf2, 0x60, 0xe7, 0x3b, 0xd2, 0x48, 0x3e, 0x19,
+    0xa4, 0x80, 0x1c, 0x44, 0xcb, 0xe4, 0x01, 0xee, 0x89, 0xc7, 0xc2, 0x20, 0xe2, 0x8a, 0xfd, 0xc9,
+    0x40, 0x45, 0x5d, 0xf5, 0x55, 0x9e, 0x21, 0xc7, 0xb6, 0xfe, 0x53, 0xd8, 0x91, 0x63, 0x96, 0x83,
+    0x8c, 0x10, 0xdc, 0x3d, 0x53, 0x1e, 0xb4, 0xa6, 0x61, 0x11, 0x0c, 0x99, 0x8c, 0x4d, 0xe8, 0x4d,
+    0x0f, 0x24, 0x18, 0x9e, 0xc6, 0x27, 0x53, 0x2b, 0x28, 0x78, 0xe9, 0x84, 0x83, 0x95, 0xbc, 0x60,
+    0x54, 0x97, 0x32, 0x72, 0x1c, 0x9f, 0x93, 0xaf, 0x6d, 0x0f, 0x5f, 0x4c, 0x39, 0xe9, 0x3f, 0x82,
+    0xec, 0x54, 0xe7, 0x21, 0xe0, 0x8d, 0x8f, 0x40, 0x09, 0x4c, 0xe3, 0xd2, 0xf8, 0xb1, 0x35, 0xe9,
+    0xbc, 0x11, 0xf1, 0x45, 0xc8, 0x55, 0xd7, 0x6b, 0x1a, 0xb5, 0xc2, 0x65, 0x66, 0x3f, 0x56, 0x68,
+    0x7d, 0x75, 0xe3, 0x20, 0xff, 0xac, 0xed, 0x3e, 0x38, 0xa0, 0x55, 0x0d, 0x12, 0xd3, 0xba, 0xb1,
+    0x4c, 0xaa, 0x7a, 0x0b, 0x68, 0xc5, 0xa1, 0x46, 0x9f, 0x6e, 0xd1, 0x09, 0x21, 0x66, 0x0a, 0x1f,
+    0xf7, 0x6a, 0x1b, 0x96, 0x19, 0xd3, 0x08, 0x57, 0xdf, 0xce, 0x02, 0x2d, 0x73, 0xea, 0xf1, 0xa9,
+    0xf0, 0xb5, 0xf8, 0xf8, 0xf8, 0x73, 0x71, 0x43, 0xcb, 0xa7, 0x63, 0x9e, 0x42, 0x50, 0x67, 0x4d,
+    0x8a, 0xed, 0xe0, 0x6d, 0x41, 0xd4, 0x66, 0xec, 0x7e, 0x48, 0xca, 0x73, 0xa6, 0x61, 0x8c, 0x30,
+    0x7e, 0xef, 0x3c, 0x50, 0xf8, 0x82, 0xa4, 0x46, 0xa0, 0x5e, 0xe4, 0xcb, 0xb4, 0x4f, 0x32, 0xac,
+    0x8d, 0x35, 0x48, 0x15, 0xe6, 0x8e, 0x1e, 0xf5, 0x1d, 0x41, 0x45, 0xc5, 0xf0, 0x79, 0xa7, 0x01,
+    0x5c, 0x29, 0xa2, 0xad, 0x55, 0xa9, 0x2e, 0x1f, 0xf8, 0xaa, 0xaa, 0x6a, 0x81, 0x89, 0xf1, 0xa0,
+    0xbf, 0x66, 0xe2, 0x9e, 0x07, 0xc1, 0x8d, 0x4f, 0x05, 0x89, 0x6c, 0xbf, 0x56, 0x8f, 0x9e, 0xf3,
+    0xc8, 0xba, 0xa8, 0xb4, 0x0e, 0xfe, 0x19, 0xfe, 0xbf, 0x96, 0xba, 0x63, 0x94, 0xaf, 0x19, 0x34,
+    0x4a, 0x6c, 0xf2, 0xc1, 0xee, 0x8f, 0x3b, 0x2a, 0xbb, 0xeb, 0x6e, 0x53, 0xf3, 0x66, 0xa6, 0xf5,
+    0x8a, 0x0c, 0x31, 0x62, 0x3c, 0xcb, 0x61, 0xfb, 0xa8, 0x24, 0xc0, 0x31, 0x80, 0x20, 0x81, 0x53,
+    0x5f, 0x1e, 0xb8, 0x72, 0x3d, 0x34, 0x38, 0x35, 0x2b, 0x7a, 0x0a, 0x2c, 0xff, 0x44, 0xe0, 0x92,
+    0x08, 0xd7, 0x8d, 0x2d, 0x60, 0xf9, 0x36, 0x8b, 0x5f, 0xf5, 0x34, 0x24, 0xa4, 0xe9, 0x56, 0x49,
+    0x97, 0xc0, 0xa2, 0x1b, 0x4c, 0xdc, 0x8e, 0x3f, 0x34, 0x3f, 0x0a, 0x8c, 0x0d, 0xab, 0xca, 0x5b,
+    0x03, 0xe2, 0xc9, 0xd2, 0x28, 0x8b, 0xd7, 0x59, 0x85, 0x9d, 0xe9, 0xcb, 0x88, 0x14, 0x0a, 0x97,
+    0x6a, 0x2e, 0x60, 0x98, 0x2c, 0x07, 0x9c, 0x1e, 0x05, 0x08, 0xc8, 0x7c, 0x78, 0x53, 0x2b, 0x07,
+    0x7c, 0x64, 0xe7, 0x21, 0x0f, 0x1a, 0x71, 0xe7, 0x1c, 0x71, 0x83, 0x0d, 0x4f, 0x24, 0x14, 0xfb,
+    0x72, 0x61, 0x33, 0xfd, 0xd1, 0x5a, 0x70, 0x48, 0xfa, 0x23, 0xc6, 0x21, 0xf1, 0x42, 0xe3, 0xda,
+    0x84, 0x81, 0xe1, 0x7f, 0x86, 0x4c, 0xc4, 0x70, 0x1b, 0x4b, 0x94, 0x3b, 0x85, 0xb4, 0x80, 0x4f,
+    0x47, 0x63, 0x03, 0xee, 0x31, 0x48, 0x6a, 0x65, 0xf4, 0x49, 0xcc, 0xd3, 0xab, 0x9d, 0x45, 0xfc,
+    0xf1, 0xcc, 0xc8, 0xe7, 0x88, 0xd6, 0x72, 0x34, 0x4a, 0xaa, 0x59, 0x4f, 0xc9, 0xc6, 0x8c, 0x26,
+    0x1f, 0x33, 0x0a, 0xd2, 0x5a, 0xb0, 0xd1, 0x48, 0x52, 0x2b, 0x14, 0x43, 0xaa, 0x51, 0xe3, 0xa6,
+    0x42, 0x41, 0x3b, 0x2b, 0xc7, 0xbd, 0x49, 0xf8, 0xb4, 0x5e, 0x54, 0xdc, 0xf5, 0x78, 0xe4, 0x91,
+    0x97, 0xad, 0x19, 0x8a, 0xd0, 0x2d, 0x1c, 0x3b, 0xfc, 0xa6, 0x73, 0x4d, 0x0d, 0x9c, 0xe5, 0xf7,
+    0x2f, 0x9e, 0x0f, 0xf3, 0xdc, 0x52, 0xd6, 0xd4, 0x41, 0xf5, 0x45, 0xb0, 0xd7, 0x99, 0x3a, 0x58,
+    0x3b, 0x1b, 0xcf, 0x78, 0xb6, 0xa5, 0x12, 0x4c, 0x3c, 0x09, 0x91, 0x72, 0x7a, 0xf3, 0x62, 0xfb,
+    0xa7, 0xc5, 0xfa, 0x91, 0x1c, 0x99, 0x1d, 0xc1, 0x45, 0x11, 0x39, 0x36, 0xa0, 0xde, 0x3c, 0x04,
+    0xb5, 0xb0, 0x46, 0xa5, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00,
+    0xc4, 0x01, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x32, 0x00, 0x10, 0x08, 0x04, 0x31, 0x08, 0xc4,
+    0x40, 0x08, 0x03, 0x31, 0x10, 0x03, 0x31, 0x10, 0xc4, 0x20, 0x10, 0x02, 0x30, 0x0c, 0xc3, 0x30,
+    0x10, 0x63, 0x0c, 0x31, 0xc8, 0x10, 0x83, 0x0c, 0x32, 0xc6, 0x18, 0x18, 0x99, 0x91, 0x81, 0x48,
+    0xdb, 0x36, 0x31, 0xd4, 0x5f, 0x0a, 0xad, 0xcd, 0x55, 0x05, 0xa3, 0xb8, 0xc7, 0x30, 0xf3, 0xfe,
+    0xe0, 0x70, 0x0a, 0x94, 0xcf, 0x67, 0x89, 0x6d, 0x24, 0x5b, 0x9e, 0x67, 0xb9, 0xb7, 0x40, 0x31,
+    0xcc, 0x12, 0x77, 0xb8, 0x0f, 0x33, 0xab, 0x6e, 0x92, 0xb4, 0x75, 0x0a, 0x99, 0xa9, 0xf0, 0x43,
+    0x19, 0x97, 0x92, 0x8a, 0xff, 0x50, 0x61, 0xbc, 0x95, 0x2e, 0xed, 0x6a, 0x0d, 0xa0, 0xc8, 0x00,
+    0xc0, 0xe5, 0x6d, 0x13, 0xd1, 0x5d, 0x0c, 0x97, 0x47, 0xac, 0x34, 0xa2, 0xbf, 0xd8, 0xb8, 0xc5,
+    0x46, 0x99, 0xbd, 0xd2, 0x50, 0x54, 0x79, 0x85, 0x4e, 0x2d, 0xd1, 0xba, 0xb9, 0x8a, 0xfa, 0xc8,
+    0x5a, 0x30, 0xc9, 0x9d, 0x16, 0x0f, 0xe6, 0x43, 0x0e, 0xc6, 0x55, 0xcf, 0x45, 0x6a, 0x59, 0x26,
+    0xaf, 0x18, 0xdf, 0xc8, 0xc1, 0x3b, 0x2f, 0x19, 0x8d, 0x62, 0x37, 0x8f, 0x89, 0x1d, 0xb0, 0x88,
+    0xd1, 0x5e, 0x17, 0xb7, 0xc8, 0x48, 0xbd, 0xc9, 0xa1, 0x35, 0x13, 0x98, 0xce, 0xce, 0x44, 0x8d,
+    0xbf, 0x0c, 0x71, 0x88, 0x08, 0xe8, 0x4e, 0x7a, 0x03, 0x44, 0xe3, 0x80, 0x8b, 0x1f, 0x31, 0xbf,
+    0x6e, 0xbc, 0x06, 0x75, 0xe0, 0x8a, 0x90, 0x50, 0xb7, 0xdf, 0xd7, 0xe2, 0x57, 0x2c, 0xe1, 0xdb,
+    0x76, 0x71, 0x7f, 0x0a, 0xd7, 0x1a, 0xb2, 0xbd, 0xb3, 0x2a, 0x1a, 0xf5, 0x3c, 0x06, 0xea, 0xff,
+    0x98, 0xd5, 0x39, 0x8f, 0x24, 0x46, 0xa3, 0x98, 0x3d, 0x91, 0xba, 0x5a, 0x2b, 0x5f, 0x7e, 0xda,
+    0xfc, 0x8c, 0xae, 0x3b, 0x81, 0x09, 0x08, 0x6d, 0x1b, 0xbf, 0x98, 0x17, 0x65, 0x09, 0xe7, 0x1b,
+    0x48, 0xb0, 0x8d, 0xb3, 0xfe, 0xdc, 0x1d, 0xe4, 0x4f, 0x27, 0x81, 0x16, 0x39, 0x63, 0xc3, 0x1d,
+    0xbe, 0x28, 0x51, 0x0e, 0x83, 0x25, 0x93, 0x35, 0xb0, 0x14, 0x18, 0x26, 0x99, 0x48, 0xaa, 0xb4,
+    0x87, 0x91, 0x39, 0xea, 0xfe, 0x62, 0xdf, 0x9c, 0x24, 0x77, 0x94, 0x11, 0x18, 0x10, 0x68, 0x50,
+    0x6f, 0xbb, 0x38, 0x2f, 0x7e, 0x40, 0x63, 0x16, 0xde, 0x31, 0x8e, 0xa7, 0xc7, 0xbc, 0xed, 0x12,
+    0x66, 0xb0, 0x66, 0xb7, 0xcc, 0x93, 0x82, 0xec, 0x07, 0x81, 0xf6, 0x42, 0x22, 0x99, 0x30, 0x8b,
+    0xde, 0x5e, 0x0b, 0x34, 0x34, 0x3a, 0x1b, 0x3d, 0xcc, 0x67, 0xdb, 0xfa, 0x6b, 0x2c, 0x5e, 0xac,
+    0x70, 0x8a, 0x76, 0xc1, 0x44, 0x26, 0x01, 0xed, 0x35, 0xe3, 0x80, 0x9a, 0x89, 0x9e, 0x28, 0x1b,
+    0x07, 0xb1, 0xa5, 0x85, 0x4d, 0x3e, 0xb9, 0x50, 0x70, 0x3c, 0x67, 0xa4, 0x70, 0x3b, 0x56, 0xca,
+    0xaa, 0xbf, 0x63, 0x99, 0x26, 0xac, 0x2a, 0xdf, 0xb4, 0x12, 0xb8, 0x02, 0x88, 0xf7, 0x9a, 0xcb,
+    0x6d, 0xe3, 0x41, 0xbe, 0x86, 0x5a, 0x92, 0xe3, 0xf1, 0x45, 0xe2, 0x04, 0x53, 0x91, 0x23, 0x99,
+    0xd8, 0x89, 0x9c, 0x90, 0x4d, 0xcc, 0x62, 0xfc, 0x1a, 0x10, 0x98, 0x3a, 0x2e, 0x04, 0xf3, 0x35,
+    0x8f, 0xa1, 0xde, 0x97, 0x3c, 0x3b, 0x9c, 0xd6, 0xd1, 0x7e, 0xd8, 0x19, 0x0c, 0x7e, 0x4b, 0x4f,
+    0x8b, 0xdd, 0xf5, 0xf5, 0x4c, 0xf8, 0x38, 0x5b, 0x76, 0x1c, 0x06, 0xaf, 0x53, 0x1b, 0x14, 0xf6,
+    0xae, 0xa8, 0x90, 0x57, 0x3a, 0xaf, 0xc5, 0x01, 0x0c, 0x8a, 0x99, 0xaa, 0xef, 0x06, 0xc5, 0xff,
+    0xae, 0xd8, 0xcb, 0x9c, 0xe8, 0x96, 0x2b, 0xa8, 0x4c, 0x6a, 0x65, 0x31, 0xd1, 0x7e, 0xfa, 0xa4,
+    0x0f, 0xe4, 0x8d, 0x2e, 0xf2, 0x30, 0x5a, 0x2e, 0x6c, 0xbb, 0x20, 0xfc, 0xc0, 0x9e, 0x7f, 0xd3,
+    0x0c, 0x2d, 0x58, 0x2d, 0xe6, 0x6c, 0xcc, 0x94, 0x73, 0xa7, 0xa1, 0x8b, 0xc0, 0x9a, 0x10, 0x26,
+    0xf6, 0x3f, 0xa6, 0xb6, 0x52, 0x75, 0x81, 0x67, 0x53, 0xf9, 0x29, 0x4a, 0xd3, 0xde, 0x5b, 0x24,
+    0x23, 0x6d, 0xd2, 0x21, 0x89, 0xb9, 0xa7, 0x65, 0x27, 0xeb, 0xd0, 0xaf, 0x2c, 0x70, 0xd9, 0xd4,
+    0x07, 0x3b, 0xb7, 0x5f, 0x2b, 0x20, 0xed, 0x4f, 0x72, 0x7a, 0x6d, 0x38, 0xf7, 0x0f, 0x24, 0xe2,
+    0xe0, 0x76, 0x64, 0x99, 0x7e, 0xab, 0xb5, 0xd9, 0x75, 0xed, 0x8f, 0xc9, 0x6d, 0x61, 0xa1, 0xdb,
+    0x45, 0xfa, 0xab, 0x3d, 0x2a, 0x5e, 0x54, 0xb2, 0x49, 0x47, 0x90, 0xa5, 0x37, 0x71, 0x92, 0xa7,
+    0xa2, 0x96, 0x42, 0xc3, 0x4b, 0x69, 0xba, 0x44, 0x9a, 0x64, 0xaa, 0x26, 0x2c, 0xd0, 0xff, 0x6a,
+    0x40, 0xa2, 0x09, 0x7f, 0x82, 0xc9, 0xf8, 0x0d, 0x44, 0x55, 0xdf, 0x4a, 0xf2, 0xfb, 0xea, 0x73,
+    0x25, 0xa2, 0x7b, 0x2c, 0x76, 0x44, 0x5d, 0x4f, 0xee, 0xd4, 0x16, 0xc9, 0x63, 0xaa, 0x05, 0xad,
+    0x73, 0x65, 0xdc, 0x6a, 0x2f, 0xa0, 0xf9, 0x8f, 0x2d, 0xbb, 0x2c, 0x49, 0x79, 0xf5, 0xef, 0x87,
+    0x52, 0x1f, 0xb1, 0xdc, 0xd6, 0xfe, 0xb2, 0x24, 0x38, 0xaf, 0xe0, 0xdd, 0x21, 0x3a, 0xf0, 0xf5,
+    0xb5, 0xc8, 0x13, 0x4a, 0xb1, 0x30, 0x51, 0x36, 0x7b, 0xd1, 0x82, 0x98, 0x76, 0x39, 0x13, 0xef,
+    0x7f, 0x18, 0x10, 0xc2, 0x96, 0xd8, 0x33, 0x03, 0xb4, 0x7a, 0xe8, 0xac, 0xfa, 0xce, 0x63, 0x46,
+    0x99, 0x13, 0xe9, 0xfc, 0xa6, 0x59, 0xaa, 0x0f, 0x56, 0x5a, 0xc4, 0xf0, 0xaf, 0x13, 0x1b, 0x58,
+    0x8d, 0x9c, 0x10, 0x11, 0xfa, 0x3c, 0x80, 0x65, 0x12, 0x79, 0xb3, 0x7d, 0x5f, 0x6b, 0x8c, 0xd5,
+    0x13, 0x28, 0x04, 0xe9, 0xad, 0x3f, 0x5a, 0xd1, 0x4d, 0xe6, 0x7a, 0xf1, 0x12, 0xbb, 0x9d, 0x0a,
+    0xe7, 0x16, 0xe8, 0xf0, 0xdf, 0x52, 0x4a, 0x45, 0x3e, 0xb4, 0x9c, 0x65, 0x51, 0x83, 0xb2, 0x0b,
+    0xcc, 0x11, 0x40, 0x69, 0x6a, 0xf4, 0x32, 0x53, 0x22, 0x94, 0x57, 0x0f, 0xf7, 0x0a, 0x1c, 0x01,
+    0x65, 0xa8, 0xca, 0x11, 0x7b, 0x75, 0x39, 0x59, 0xc9, 0xb6, 0x1d, 0xfc, 0x1b, 0x0d, 0x11, 0x18,
+    0xf1, 0x82, 0x69, 0xf4, 0xa8, 0xb0, 0xfd, 0xe6, 0x21, 0x03, 0x44, 0x1e, 0x1d, 0xf3, 0xa0, 0x79,
+    0x80, 0x77, 0x35, 0x9e, 0xf2, 0xa8, 0xd2, 0x9c, 0x29, 0x51, 0x1e, 0x8a, 0x1f, 0xa8, 0xfe, 0x1e,
+    0x73, 0x29, 0x57, 0xcc, 0xd7, 0x7a, 0xdc, 0xf7, 0xdd, 0xd8, 0xf5, 0x2e, 0xc7, 0x41, 0x04, 0xa9,
+    0x6d, 0x8b, 0x06, 0x5d, 0xa9, 0x7d, 0x93, 0xef, 0x37, 0xbf, 0x62, 0x71, 0xd2, 0x70, 0xbd, 0xdf,
+    0xf1, 0x4c, 0x24, 0x33, 0x82, 0x9a, 0xc2, 0xe3, 0x61, 0x94, 0x4f, 0xe7, 0xf5, 0xe6, 0x6d, 0xa7,
+    0xf8, 0x32, 0x18, 0xce, 0x80, 0x84, 0xcf, 0x26, 0x9e, 0x42, 0x8c, 0x41, 0x66, 0x3c, 0x84, 0xa3,
+    0xcf, 0x7a, 0x78, 0xe0, 0x62, 0x10, 0xdc, 0x97, 0x19, 0x92, 0x31, 0x7d, 0xb7, 0x9a, 0x95, 0x26,
+    0x49, 0x35, 0x87, 0x8f, 0x4c, 0x75, 0xff, 0x8b, 0x27, 0xd8, 0x58, 0x38, 0xe0, 0x69, 0x88, 0x49,
+    0x3e, 0x2b, 0x28, 0xbd, 0x2e, 0x72, 0x98, 0x1e, 0x02, 0x1d, 0x5f, 0x0b, 0xf5, 0xeb, 0xde, 0x0c,
+    0xe2, 0x17, 0x02, 0x6e, 0x49, 0x78, 0x9d, 0x6f, 0x07, 0x0f, 0xfe, 0xc2, 0x7b, 0x39, 0x26, 0x56,
+    0x1b, 0x3f, 0x92, 0xc7, 0x60, 0x00, 0x95, 0x04, 0xfd, 0x32, 0x9c, 0x18, 0x48, 0x28, 0x62, 0xaa,
+    0x7d, 0xa2, 0xac, 0x26, 0x55, 0xa2, 0xb7, 0x36, 0xa9, 0x3a, 0xdc, 0xfe, 0xa5, 0xae, 0x72, 0x0d,
+    0xfb, 0xfb, 0x7f, 0x6f, 0x76, 0x93, 0xbf, 0x3f, 0x38, 0x3b, 0x43, 0xd9, 0xad, 0x48, 0x64, 0xe7,
+    0x9f, 0x76, 0x78, 0x15, 0x27, 0xa3, 0xbe, 0x17, 0x99, 0x38, 0xd0, 0x2f, 0xf3, 0x63, 0xbf, 0xd3,
+    0xd7, 0xc0, 0x82, 0xb4, 0x76, 0x15, 0x4b, 0x1a, 0x0e, 0x57, 0xd6, 0xf3, 0x2d, 0x1a, 0xe7, 0x85,
+    0x07, 0x0e, 0x12, 0xcf, 0xe1, 0xe3, 0x64, 0x99, 0x78, 0xd5, 0xfd, 0xaa, 0xd4, 0x6b, 0xf4, 0x50,
+    0x0b, 0x13, 0xff, 0xdd, 0xb8, 0xa3, 0x65, 0x89, 0xe9, 0x2e, 0x61, 0x61, 0xd5, 0x34, 0x49, 0x5a,
+    0x49, 0xc0, 0xb0, 0xf9, 0xa3, 0xe3, 0x6d, 0xd4, 0x37, 0x7d, 0xc9, 0xcc, 0xea, 0x5b, 0xc2, 0x25,
+    0xbc, 0xd8, 0x67, 0xc0, 0x3b, 0x2c, 0xc1, 0x4d, 0xe5, 0x25, 0xac, 0x62, 0x88, 0xfe, 0x1d, 0x39,
+    0x3e, 0x8d, 0x5c, 0x9c, 0x07, 0x7f, 0xca, 0x77, 0xf1, 0x53, 0x52, 0x39, 0x50, 0xf4, 0xfe, 0x63,
+    0xc7, 0x9a, 0x50, 0x2f, 0x0c, 0x61, 0x61, 0x42, 0x53, 0xb8, 0x8a, 0x73, 0x81, 0xf2, 0xb4, 0x42,
+    0x21, 0x57, 0x9e, 0x90, 0xa1, 0xfe, 0x7b, 0x9c, 0x23, 0x16, 0xbe, 0xde, 0x25, 0x77, 0xc2, 0x6d,
+    0xcf, 0x7d, 0x6f, 0x78, 0x83, 0x33, 0x3c, 0x54, 0x5d, 0x72, 0xcd, 0xa5, 0xac, 0xb1, 0x02, 0x2f,
+    0x72, 0xf4, 0x93, 0xc6, 0xf7, 0x47, 0xf3, 0x94, 0x25, 0x30, 0x04, 0xf9, 0x35, 0xb8, 0x17, 0x61,
+    0x13, 0x47, 0xa9, 0x8f, 0x57, 0xb0, 0x9f, 0xc3, 0x5f, 0x65, 0xa9, 0xdd, 0x09, 0xfb, 0xda, 0x46,
+    0x06, 0x0f, 0xd0, 0x9f, 0x8b, 0x5b, 0xfd, 0x11, 0x0e, 0x5e, 0x28, 0xaf, 0x94, 0x2f, 0x47, 0xc8,
+    0x19, 0x37, 0xab, 0xf0, 0xd8, 0x0c, 0x70, 0x86, 0xb8, 0x4b, 0x8b, 0x09, 0xd8, 0x96, 0x9e, 0xd1,
+    0xd4, 0x22, 0xac, 0xc9, 0xde, 0x69, 0x73, 0x35, 0x7f, 0xd6, 0x09, 0xca, 0x75, 0xed, 0x15, 0xe9,
+    0x5b, 0xc9, 0xd5, 0x26, 0xc9, 0xfc, 0xaf, 0xe8, 0x33, 0xa4, 0xb9, 0x9f, 0x37, 0x7a, 0xf1, 0xe8,
+    0x6b, 0x1c, 0xbc, 0xb3, 0x95, 0x38, 0x34, 0x79, 0xf0, 0x83, 0x25, 0x7d, 0xae, 0x30, 0x84, 0xbf,
+    0x87, 0x7d, 0x5e, 0x68, 0xa3, 0xff, 0xd7, 0xde, 0x38, 0xf7, 0x2e, 0x6c, 0x71, 0xf4, 0xff, 0xdd,
+    0x20, 0x14, 0xb1, 0x03, 0x1e, 0x50, 0x28, 0xaf, 0x7c, 0x21, 0x0f, 0x42, 0x93, 0x94, 0xe8, 0x72,
+    0xf5, 0xb3, 0xf5, 0xbd, 0x4c, 0x3b, 0x04, 0xe4, 0x74, 0x31, 0x95, 0x09, 0x2f, 0x92, 0x5d, 0xa6,
+    0x5a, 0x70, 0xdf, 0x3b, 0x85, 0x79, 0x4d, 0xcd, 0x45, 0x31, 0x6a, 0x5f, 0x30, 0x4e, 0x5f, 0xe6,
+    0x6f, 0x5c, 0x55, 0xcc, 0x7b, 0xb1, 0xf4, 0xb3, 0xa9, 0x88, 0x57, 0x40, 0x39, 0x8e, 0xb1, 0x20,
+    0x92, 0x56, 0x08, 0x2e, 0x51, 0x73, 0x0c, 0xb7, 0xfa, 0xb3, 0x9d, 0xdc, 0xff, 0xc3, 0x02, 0xe8,
+    0x67, 0xbb, 0x83, 0x81, 0x5c, 0x24, 0x57, 0xb7, 0xc0, 0xb8, 0x13, 0xf7, 0x90, 0x22, 0x8b, 0x6b,
+    0xf2, 0xbf, 0x4e, 0xc8, 0x93, 0x73, 0x60, 0xc3, 0x0d, 0x4a, 0xab, 0x5b, 0xaf, 0xee, 0x57, 0x74,
+    0x37, 0xdf, 0xb6, 0xa3, 0x2a, 0xd6, 0xf7, 0x8e, 0x6a, 0x90, 0xfa, 0x5f, 0xfc, 0xd7, 0x29, 0x03,
+    0x99, 0xc3, 0x5a, 0x4e, 0x96, 0x0c, 0x87, 0x5d, 0x9c, 0xf8, 0xd8, 0x9a, 0x8a, 0x64, 0xde, 0x85,
+    0x11, 0x84, 0x17, 0x8c, 0xd1, 0x76, 0xb1, 0xd0, 0xd8, 0xbd, 0xf0, 0x9e, 0x5a, 0x0d, 0x11, 0xe5,
+    0xf6, 0xb5, 0x18, 0x25, 0xc5, 0x58, 0x3d, 0xcc, 0x31, 0x2d, 0xf2, 0x37, 0x93, 0xb4, 0xc4, 0xfa,
+    0xa5, 0x1a, 0xda, 0x33, 0xd7, 0x09, 0x4f, 0xbf, 0x5d, 0x95, 0x5f, 0x44, 0x4a, 0x5b, 0xb1, 0x92,
+    0xd2, 0x99, 0x9e, 0xfb, 0xb3, 0xf1, 0xd1, 0xe9, 0xc3, 0xcc, 0x8a, 0xb7, 0x79, 0xc9, 0x12, 0x3d,
+    0xc0, 0x6a, 0x6c, 0x26, 0x0f, 0x56, 0xa7, 0x8c, 0x01, 0x25, 0x15, 0xa9, 0x0a, 0x34, 0x81, 0x76,
+    0xd7, 0x0c
+};
+
+inline constexpr uint8_t plot_fixture_v2[] = {
+    0x70, 0x6f, 0x73, 0x32, 0x02, 0xc6, 0xb8, 0x47, 0x29, 0xc2, 0x3d, 0xc6, 0xd6, 0x0c, 0x92, 0xf2,
+    0x2c, 0x17, 0x08, 0x3f, 0x47, 0x84, 0x5c, 0x11, 0x79, 0x22, 0x7c, 0x55, 0x09, 0xf0, 0x7a, 0x5d,
+    0x28, 0x04, 0xa7, 0xb8, 0x35, 0x12, 0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x0a, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x77, 0x01, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00,
+    0x51, 0x06, 0x00, 0x00, 0x5d, 0x06, 0x00, 0x00, 0x69, 0x06, 0x00, 0x00, 0x75, 0x06, 0x00, 0x00,
+    0x81, 0x06, 0x00, 0x00, 0x8d, 0x06, 0x00, 0x00, 0x99, 0x06, 0x00, 0x00, 0xa5, 0x06, 0x00, 0x00,
+    0xb1, 0x06, 0x00, 0x00, 0xbd, 0x06, 0x00, 0x00, 0xc9, 0x06, 0x00, 0x00, 0xd5, 0x06, 0x00, 0x00,
+    0xe1, 0x06, 0x00, 0x00, 0xed, 0x06, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0x05, 0x07, 0x00, 0x00,
+    0x11, 0x07, 0x00, 0x00, 0x1d, 0x07, 0x00, 0x00, 0x29, 0x07, 0x00, 0x00, 0x35, 0x07, 0x00, 0x00,
+    0x41, 0x07, 0x00, 0x00, 0x4d, 0x07, 0x00, 0x00, 0x59, 0x07, 0x00, 0x00, 0x65, 0x07, 0x00, 0x00,
+    0x71, 0x07, 0x00, 0x00, 0x7d, 0x07, 0x00, 0x00, 0x89, 0x07, 0x00, 0x00, 0x95, 0x07, 0x00, 0x00,
+    0xa1, 0x07, 0x00, 0x00, 0xad, 0x07, 0x00, 0x00, 0xb9, 0x07, 0x00, 0x00, 0xc5, 0x07, 0x00, 0x00,
+    0xd1, 0x07, 0x00, 0x00, 0xdd, 0x07, 0x00, 0x00, 0xe9, 0x07, 0x00, 0x00, 0xf5, 0x07, 0x00, 0x00,
+    0x01, 0x08, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00,
+    0x31, 0x08, 0x00, 0x00, 0x3d, 0x08, 0x00, 0x00, 0x49, 0x08, 0x00, 0x00, 0x55, 0x08, 0x00, 0x00,
+    0x61, 0x08, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00, 0x79, 0x08, 0x00, 0x00, 0x85, 0x08, 0x00, 0x00,
+    0x91, 0x08, 0x00, 0x00, 0x9d, 0x08, 0x00, 0x00, 0xa9, 0x08, 0x00, 0x00, 0xb5, 0x08, 0x00, 0x00,
+    0xc1, 0x08, 0x00, 0x00, 0xcd, 0x08, 0x00, 0x00, 0xd9, 0x08, 0x00, 0x00, 0xe5, 0x08, 0x00, 0x00,
+    0xf1, 0x08, 0x00, 0x00, 0xfd, 0x08, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x15, 0x09, 0x00, 0x00,
+    0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x2c, 0x2a, 0x33, 0x3c,
+    0x37, 0x24, 0x36, 0x10, 0x3b, 0x28, 0x32, 0x1a, 0x0c, 0x20, 0x1e, 0x37, 0x16, 0x14, 0x34, 0x35,
+    0x02, 0x0e, 0x3b, 0x19, 0x3d, 0x36, 0x12, 0x19, 0x28, 0x2a, 0x0f, 0x13, 0x17, 0x2b, 0x16, 0x27,
+    0x29, 0x39, 0x1b, 0x0b, 0x26, 0x06, 0x0b, 0x24, 0x11, 0x0f, 0x06, 0x0f, 0x07, 0x35, 0x26, 0x1a,
+    0x2e, 0x1f, 0x0e, 0x23, 0x1d, 0x12, 0x23, 0x2f, 0x1b, 0x1c, 0x0d, 0x21, 0x3f, 0x1e, 0x20, 0x26,
+    0x34, 0x35, 0x11, 0x3c, 0x0b, 0x20, 0x37, 0x1f, 0x08, 0x0c, 0x2f, 0x07, 0x38, 0x1b, 0x07, 0x3a,
+    0x3c, 0x35, 0x30, 0x03, 0x03, 0x05, 0x04, 0x2a, 0x3d, 0x1b, 0x1d, 0x31, 0x26, 0x3e, 0x13, 0x16,
+    0x2e, 0x1d, 0x3f, 0x34, 0x1d, 0x01, 0x09, 0x12, 0x2e, 0x18, 0x07, 0x22, 0x20, 0x2a, 0x3c, 0x03,
+    0x0f, 0x39, 0x32, 0x37, 0x28, 0xee, 0xea, 0x75, 0x80, 0x90, 0xc4, 0xcf, 0x69, 0x2f, 0x7b, 0x15,
+    0xd8, 0x10, 0x6e, 0xe6, 0x69, 0x02, 0xe9, 0x1b, 0x90, 0xa7, 0xca, 0xdb, 0x55, 0xc0, 0x88, 0xac,
+    0xc1, 0x77, 0x5c, 0x36, 0xe8, 0xde, 0x0f, 0x6a, 0x07, 0xcb, 0xa4, 0x55, 0x41, 0xa9, 0x85, 0x95,
+    0x4d, 0xda, 0x96, 0x21, 0xf3, 0x4f, 0xf6, 0x3a, 0x45, 0x1e, 0x19, 0x59, 0x89, 0x8d, 0x51, 0x7e,
+    0x7d, 0x35, 0x27, 0x14, 0x8c, 0x0d, 0x10, 0xb0, 0xb1, 0x49, 0xe6, 0xd0, 0xfd, 0x23, 0x5d, 0xba,
+    0x76, 0xa7, 0xc5, 0xeb, 0xcd, 0x03, 0x48, 0xe7, 0x53, 0x05, 0xad, 0xbd, 0x33, 0x88, 0xc2, 0x79,
+    0x21, 0x0f, 0x0b, 0xbc, 0x09, 0xba, 0x1a, 0xa6, 0x51, 0xc6, 0x1d, 0x8d, 0x7f, 0x33, 0x71, 0xf5,
+    0x97, 0xea, 0x07, 0x50, 0x1b, 0xbf, 0xa9, 0xb3, 0xb8, 0xac, 0x99, 0xb6, 0x9f, 0xbe, 0x9a, 0x31,
+    0xbb, 0x33, 0x84, 0xb7, 0x3d, 0x72, 0x5a, 0xe4, 0xf1, 0xfc, 0x84, 0xa4, 0x9e, 0x9b, 0x85, 0xac,
+    0xb4, 0xb7, 0x91, 0x2c, 0x69, 0x71, 0xec, 0xde, 0xf3, 0x3f, 0xf9, 0x54, 0x12, 0x1c, 0xde, 0xc1,
+    0x9c, 0x9f, 0x1e, 0xd8, 0xa1, 0x9e, 0xab, 0xfc, 0xcf, 0x05, 0xbb, 0x4c, 0x61, 0x6f, 0x79, 0x30,
+    0x94, 0xac, 0x8e, 0x6c, 0x6b, 0xe5, 0x33, 0xab, 0xbf, 0xfe, 0x57, 0x9a, 0xf8, 0xc3, 0xce, 0xbc,
+    0x26, 0x88, 0x63, 0x62, 0xc1, 0x05, 0x87, 0x43, 0xc5, 0xd6, 0xc2, 0x58, 0x66, 0x66, 0x5d, 0xbc,
+    0xac, 0x3f, 0x9d, 0xb5, 0x8f, 0x10, 0xf3, 0x36, 0xb9, 0xa6, 0xe7, 0xb1, 0x38, 0x80, 0x98, 0xaa,
+    0xa3, 0xa4, 0x4f, 0x54, 0xe5, 0xb2, 0x18, 0x25, 0xd5, 0x6b, 0x73, 0xe9, 0x93, 0x0c, 0x2f, 0x28,
+    0xc3, 0xc5, 0x25, 0x04, 0x49, 0x3d, 0x7f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x01, 0x00, 0x00, 0x15, 0x18, 0x38, 0x0c, 0x1c, 0x00, 0x3f, 0x2f, 0x16, 0x03, 0x21, 0x04, 0x2f,
+    0x11, 0x25, 0x0a, 0x38, 0x02, 0x3e, 0x02, 0x2c, 0x2e, 0x07, 0x2b, 0x0c, 0x2b, 0x25, 0x0f, 0x1e,
+    0x33, 0x31, 0x22, 0x1a, 0x3b, 0x06, 0x22, 0x3f, 0x26, 0x2c, 0x0c, 0x04, 0x36, 0x19, 0x3e, 0x0f,
+    0x19, 0x1f, 0x0e, 0x19, 0x10, 0x0e, 0x37, 0x36, 0x37, 0x1b, 0x16, 0x02, 0x18, 0x14, 0x38, 0x06,
+    0x07, 0x08, 0x04, 0x12, 0x2b, 0x1b, 0x29, 0x3b, 0x33, 0x09, 0x1c, 0x0a, 0x02, 0x30, 0x09, 0x3b,
+    0x38, 0x20, 0x1f, 0x33, 0x2a, 0x21, 0x34, 0x26, 0x3c, 0x2f, 0x05, 0x16, 0x1f, 0x31, 0x0b, 0x03,
+    0x0d, 0x0a, 0x19, 0x3f, 0x1d, 0x08, 0x36, 0x21, 0x14, 0x29, 0x28, 0x0c, 0x31, 0x02, 0x3c, 0x2d,
+    0x37, 0x01, 0x0f, 0x1b, 0x14, 0x1d, 0x00, 0x39, 0x1c, 0x08, 0x31, 0x05, 0x22, 0x29, 0x21, 0x03,
+    0x23, 0x0f, 0x28, 0x06, 0x31, 0x07, 0x18, 0x0d, 0x38, 0x13, 0xde, 0xd1, 0x3e, 0xe7, 0xdf, 0x0a,
+    0xbc, 0xad, 0xdd, 0x34, 0x50, 0x06, 0x90, 0x2c, 0xf4, 0x6e, 0xd3, 0x1a, 0x45, 0x32, 0x87, 0xe6,
+    0xdd, 0x35, 0x24, 0x34, 0xba, 0x37, 0x0e, 0x01, 0x66, 0xbd, 0x7c, 0x6e, 0x99, 0x38, 0x9c, 0x52,
+    0x94, 0xa4, 0x9d, 0xfe, 0xaf, 0x56, 0xb6, 0x9b, 0x76, 0xf0, 0x66, 0xe2, 0x57, 0x46, 0x11, 0x99,
+    0x93, 0xf6, 0x20, 0x12, 0x12, 0xe1, 0x61, 0x3d, 0x4e, 0x58, 0xa9, 0xa2, 0x2c, 0x7a, 0x56, 0x94,
+    0xfc, 0x81, 0xeb, 0xff, 0x36, 0x59, 0xe0, 0x98, 0x94, 0xdb, 0xc8, 0x5b, 0x7b, 0x56, 0x4c, 0xca,
+    0x29, 0xf8, 0x49, 0x89, 0xb3, 0x0c, 0x9f, 0xb6, 0x34, 0x29, 0x29, 0x43, 0x0f, 0x29, 0xc6, 0x58,
+    0x14, 0xd0, 0x5c, 0x50, 0x58, 0xed, 0xb4, 0xbf, 0x6f, 0x74, 0xe2, 0x07, 0x0d, 0xbc, 0x01, 0x41,
+    0x55, 0x2d, 0x33, 0x51, 0x46, 0xde, 0x45, 0xe0, 0x33, 0x08, 0x78, 0x59, 0x59, 0x4c, 0xe0, 0x12,
+    0x08, 0x9c, 0xcb, 0xdc, 0x31, 0x30, 0x62, 0x02, 0x6d, 0xba, 0xfe, 0xc2, 0x54, 0x37, 0xe4, 0xfb,
+    0x7f, 0xbc, 0x18, 0x5a, 0x11, 0x3b, 0xe3, 0xaf, 0xa3, 0x14, 0x79, 0xef, 0x18, 0xf8, 0xd4, 0x71,
+    0x35, 0x87, 0xe7, 0x29, 0x70, 0x26, 0x8a, 0xa4, 0x24, 0x01, 0x50, 0x21, 0xbf, 0x48, 0xc1, 0xd6,
+    0x83, 0x17, 0xc2, 0x59, 0x82, 0xb8, 0xb4, 0x52, 0x13, 0xb1, 0x18, 0xf3, 0x9c, 0x93, 0x93, 0x6c,
+    0x60, 0x76, 0xdf, 0x21, 0xda, 0xc4, 0x20, 0xc5, 0xd6, 0x9b, 0x0a, 0xb5, 0x2d, 0xf7, 0x9f, 0xba,
+    0xb8, 0xdb, 0x95, 0x62, 0x97, 0x82, 0xef, 0xf0, 0xaf, 0xe9, 0xf2, 0x60, 0xe7, 0x3b, 0xd2, 0x48,
+    0x3e, 0x19, 0xa4, 0x80, 0x1c, 0x44, 0xcb, 0xe4, 0x01, 0xee, 0x89, 0xc7, 0xc2, 0x20, 0xe2, 0x8a,
+    0xfd, 0xc9, 0x40, 0x45, 0x5d, 0xf5, 0x55, 0x9e, 0x21, 0xc7, 0xb6, 0xfe, 0x53, 0xd8, 0x91, 0x63,
+    0x96, 0x83, 0x8c, 0x10, 0xdc, 0x3d, 0x53, 0x1e, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x01, 0x00, 0x00, 0x1e, 0x2f, 0x01, 0x16, 0x16, 0x16, 0x3a, 0x10, 0x13, 0x1f, 0x1f, 0x0c,
+    0x08, 0x3c, 0x03, 0x33, 0x21, 0x2b, 0x0b, 0x1f, 0x21, 0x10, 0x0f, 0x2d, 0x11, 0x00, 0x28, 0x05,
+    0x10, 0x0e, 0x0b, 0x0d, 0x29, 0x24, 0x32, 0x00, 0x0f, 0x05, 0x0f, 0x25, 0x10, 0x04, 0x09, 0x01,
+    0x1a, 0x23, 0x2c, 0x38, 0x07, 0x3d, 0x3b, 0x1b, 0x0c, 0x0e, 0x20, 0x3d, 0x35, 0x06, 0x3a, 0x0a,
+    0x1d, 0x28, 0x10, 0x0d, 0x20, 0x38, 0x25, 0x0d, 0x27, 0x0c, 0x11, 0x01, 0x0f, 0x0f, 0x32, 0x0a,
+    0x3a, 0x3d, 0x13, 0x30, 0x3f, 0x02, 0x03, 0x23, 0x11, 0x1d, 0x30, 0x30, 0x38, 0x01, 0x02, 0x35,
+    0x27, 0x25, 0x00, 0x00, 0x1d, 0x08, 0x2f, 0x0f, 0x00, 0x28, 0x3b, 0x02, 0x03, 0x23, 0x09, 0x32,
+    0x2c, 0x16, 0x06, 0x1f, 0x2b, 0x3e, 0x23, 0x0f, 0x21, 0x1b, 0x24, 0x0f, 0x35, 0x09, 0x02, 0x16,
+    0x1b, 0x2c, 0x36, 0x11, 0x27, 0x25, 0x39, 0x32, 0x18, 0x20, 0x2b, 0x38, 0x03, 0x03, 0x2c, 0x2f,
+    0x28, 0x06, 0x17, 0x29, 0x00, 0x7b, 0x42, 0x61, 0x11, 0x0c, 0x99, 0x8c, 0x4d, 0xe8, 0x4d, 0x0f,
+    0x24, 0x18, 0x9e, 0xc6, 0x27, 0x53, 0x2b, 0x28, 0x78, 0xe9, 0x84, 0x83, 0x95, 0xbc, 0x60, 0x54,
+    0x97, 0x32, 0x72, 0x1c, 0x9f, 0x93, 0xaf, 0x6d, 0x0f, 0x5f, 0x4c, 0x39, 0xe9, 0x3f, 0x82, 0xec,
+    0x54, 0xe7, 0x21, 0xe0, 0x8d, 0x8f, 0x40, 0x09, 0x4c, 0xe3, 0xd2, 0xf8, 0xb1, 0x35, 0xe9, 0xbc,
+    0x11, 0xf1, 0x45, 0xc8, 0x55, 0xd7, 0x6b, 0x1a, 0xb5, 0xc2, 0x65, 0x66, 0x3f, 0x56, 0x68, 0x7d,
+    0x75, 0xe3, 0x20, 0xff, 0xac, 0xed, 0x3e, 0x38, 0xa0, 0x55, 0x0d, 0x12, 0xd3, 0xba, 0xb1, 0x4c,
+    0xaa, 0x7a, 0x0b, 0x68, 0xc5, 0xa1, 0x46, 0x9f, 0x6e, 0xd1, 0x09, 0x21, 0x66, 0x0a, 0x1f, 0xf7,
+    0x6a, 0x1b, 0x96, 0x19, 0xd3, 0x08, 0x57, 0xdf, 0xce, 0x02, 0x2d, 0x73, 0xea, 0xf1, 0xa9, 0xf0,
+    0xb5, 0xf8, 0xf8, 0xf8, 0x73, 0x71, 0x43, 0xcb, 0xa7, 0x63, 0x9e, 0x42, 0x50, 0x67, 0x4d, 0x8a,
+    0xed, 0xe0, 0x6d, 0x41, 0xd4, 0x66, 0xec, 0x7e, 0x48, 0xca, 0x73, 0xa6, 0x61, 0x8c, 0x30, 0x7e,
+    0xef, 0x3c, 0x50, 0xf8, 0x82, 0xa4, 0x46, 0xa0, 0x5e, 0xe4, 0xcb, 0xb4, 0x4f, 0x32, 0xac, 0x8d,
+    0x35, 0x48, 0x15, 0xe6, 0x8e, 0x1e, 0xf5, 0x1d, 0x41, 0x45, 0xc5, 0xf0, 0x79, 0xa7, 0x01, 0x5c,
+    0x29, 0xa2, 0xad, 0x55, 0xa9, 0x2e, 0x1f, 0xf8, 0xaa, 0xaa, 0x6a, 0x81, 0x89, 0xf1, 0xa0, 0xbf,
+    0x66, 0xe2, 0x9e, 0x07, 0xc1, 0x8d, 0x4f, 0x05, 0x89, 0x6c, 0xbf, 0x56, 0x8f, 0x9e, 0xf3, 0xc8,
+    0xba, 0xa8, 0xb4, 0x0e, 0xfe, 0x19, 0xfe, 0xbf, 0x96, 0xba, 0x63, 0x94, 0xaf, 0x19, 0x34, 0x4a,
+    0x6c, 0xf2, 0xc1, 0xee, 0x8f, 0x3b, 0x2a, 0xbb, 0xeb, 0x6e, 0x53, 0xf3, 0x66, 0xa6, 0xf5, 0x8a,
+    0x0c, 0x31, 0x62, 0x3c, 0xcb, 0x61, 0xfb, 0xa8, 0x24, 0xc0, 0x31, 0x80, 0x20, 0x81, 0x53, 0x5f,
+    0x1e, 0xb8, 0x72, 0x3d, 0x34, 0x38, 0x35, 0x2b, 0x7a, 0x0a, 0x2c, 0xff, 0x44, 0xe0, 0x92, 0x08,
+    0xd7, 0x8d, 0x2d, 0x60, 0xf9, 0x36, 0x8b, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec,
+    0x00, 0x00, 0x00, 0x02, 0x1f, 0x20, 0x2e, 0x3d, 0x13, 0x3d, 0x27, 0x30, 0x3c, 0x16, 0x2a, 0x37,
+    0x2d, 0x28, 0x3b, 0x2d, 0x0f, 0x25, 0x22, 0x1e, 0x05, 0x36, 0x21, 0x21, 0x03, 0x36, 0x36, 0x06,
+    0x00, 0x12, 0x2b, 0x1a, 0x3e, 0x32, 0x37, 0x02, 0x1e, 0x3e, 0x2e, 0x0a, 0x0f, 0x15, 0x3d, 0x3e,
+    0x12, 0x2a, 0x38, 0x03, 0x1f, 0x3d, 0x02, 0x17, 0x15, 0x1d, 0x3e, 0x02, 0x29, 0x22, 0x33, 0x3d,
+    0x30, 0x2a, 0x18, 0x2c, 0x11, 0x35, 0x15, 0x00, 0x19, 0x2c, 0x15, 0x25, 0x2b, 0x11, 0x10, 0x34,
+    0x20, 0x2c, 0x34, 0x0d, 0x22, 0x15, 0x16, 0x2d, 0x25, 0x03, 0x19, 0x21, 0x0d, 0x35, 0x0d, 0x22,
+    0x28, 0x3e, 0x15, 0x22, 0x10, 0x27, 0x21, 0x27, 0x3e, 0x13, 0x33, 0x22, 0x1e, 0x37, 0x17, 0x28,
+    0x20, 0x12, 0x27, 0x0d, 0x36, 0x3c, 0x01, 0x18, 0x38, 0x6e, 0x76, 0x34, 0x24, 0xa4, 0xe9, 0x56,
+    0x49, 0x97, 0xc0, 0xa2, 0x1b, 0x4c, 0xdc, 0x8e, 0x3f, 0x34, 0x3f, 0x0a, 0x8c, 0x0d, 0xab, 0xca,
+    0x5b, 0x03, 0xe2, 0xc9, 0xd2, 0x28, 0x8b, 0xd7, 0x59, 0x85, 0x9d, 0xe9, 0xcb, 0x88, 0x14, 0x0a,
+    0x97, 0x6a, 0x2e, 0x60, 0x98, 0x2c, 0x07, 0x9c, 0x1e, 0x05, 0x08, 0xc8, 0x7c, 0x78, 0x53, 0x2b,
+    0x07, 0x7c, 0x64, 0xe7, 0x21, 0x0f, 0x1a, 0x71, 0xe7, 0x1c, 0x71, 0x83, 0x0d, 0x4f, 0x24, 0x14,
+    0xfb, 0x72, 0x61, 0x33, 0xfd, 0xd1, 0x5a, 0x70, 0x48, 0xfa, 0x23, 0xc6, 0x21, 0xf1, 0x42, 0xe3,
+    0xda, 0x84, 0x81, 0xe1, 0x7f, 0x86, 0x4c, 0xc4, 0x70, 0x1b, 0x4b, 0x94, 0x3b, 0x85, 0xb4, 0x80,
+    0x4f, 0x47, 0x63, 0x03, 0xee, 0x31, 0x48, 0x6a, 0x65, 0xf4, 0x49, 0xcc, 0xd3, 0xab, 0x9d, 0x45,
+    0xfc, 0xf1, 0xcc, 0xc8, 0xe7, 0x88, 0xd6, 0x72, 0x34, 0x4a, 0xaa, 0x59, 0x4f, 0xc9, 0xc6, 0x8c,
+    0x26, 0x1f, 0x33, 0x0a, 0xd2, 0x5a, 0xb0, 0xd1, 0x48, 0x52, 0x2b, 0x14, 0x43, 0xaa, 0x51, 0xe3,
+    0xa6, 0x42, 0x41, 0x3b, 0x2b, 0xc7, 0xbd, 0x49, 0xf8, 0xb4, 0x5e, 0x54, 0xdc, 0xf5, 0x78, 0xe4,
+    0x91, 0x97, 0xad, 0x19, 0x8a, 0xd0, 0x2d, 0x1c, 0x3b, 0xfc, 0xa6, 0x73, 0x4d, 0x0d, 0x9c, 0xe5,
+    0xf7, 0x2f, 0x9e, 0x0f, 0xf3, 0xdc, 0x52, 0xd6, 0xd4, 0x41, 0xf5, 0x45, 0xb0, 0xd7, 0x99, 0x3a,
+    0x58, 0x3b, 0x1b, 0xcf, 0x78, 0xb6, 0xa5, 0x12, 0x4c, 0x3c, 0x09, 0x91, 0x72, 0x7a, 0xf3, 0x62,
+    0xfb, 0xa7, 0xc5, 0xfa, 0x91, 0x1c, 0x99, 0x1d, 0xc1, 0x45, 0x11, 0x39, 0x36, 0xa0, 0xde, 0x3c,
+    0x04, 0xb5, 0xb0, 0x46, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x8f, 0x01, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x99, 0x06, 0x00,
+    0x00, 0xa5, 0x06, 0x00, 0x00, 0xb1, 0x06, 0x00, 0x00, 0xbd, 0x06, 0x00, 0x00, 0xc9, 0x06, 0x00,
+    0x00, 0xd5, 0x06, 0x00, 0x00, 0xe1, 0x06, 0x00, 0x00, 0xed, 0x06, 0x00, 0x00, 0xf9, 0x06, 0x00,
+    0x00, 0x05, 0x07, 0x00, 0x00, 0x11, 0x07, 0x00, 0x00, 0x1d, 0x07, 0x00, 0x00, 0x29, 0x07, 0x00,
+    0x00, 0x35, 0x07, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00, 0x4d, 0x07, 0x00, 0x00, 0x59, 0x07, 0x00,
+    0x00, 0x65, 0x07, 0x00, 0x00, 0x71, 0x07, 0x00, 0x00, 0x7d, 0x07, 0x00, 0x00, 0x89, 0x07, 0x00,
+    0x00, 0x95, 0x07, 0x00, 0x00, 0xa1, 0x07, 0x00, 0x00, 0xad, 0x07, 0x00, 0x00, 0xb9, 0x07, 0x00,
+    0x00, 0xc5, 0x07, 0x00, 0x00, 0xd1, 0x07, 0x00, 0x00, 0xdd, 0x07, 0x00, 0x00, 0xe9, 0x07, 0x00,
+    0x00, 0xf5, 0x07, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x19, 0x08, 0x00,
+    0x00, 0x25, 0x08, 0x00, 0x00, 0x31, 0x08, 0x00, 0x00, 0x3d, 0x08, 0x00, 0x00, 0x49, 0x08, 0x00,
+    0x00, 0x55, 0x08, 0x00, 0x00, 0x61, 0x08, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00, 0x79, 0x08, 0x00,
+    0x00, 0x85, 0x08, 0x00, 0x00, 0x91, 0x08, 0x00, 0x00, 0x9d, 0x08, 0x00, 0x00, 0xa9, 0x08, 0x00,
+    0x00, 0xb5, 0x08, 0x00, 0x00, 0xc1, 0x08, 0x00, 0x00, 0xcd, 0x08, 0x00, 0x00, 0xd9, 0x08, 0x00,
+    0x00, 0xe5, 0x08, 0x00, 0x00, 0xf1, 0x08, 0x00, 0x00, 0xfd, 0x08, 0x00, 0x00, 0x09, 0x09, 0x00,
+    0x00, 0x15, 0x09, 0x00, 0x00, 0x21, 0x09, 0x00, 0x00, 0x2d, 0x09, 0x00, 0x00, 0x39, 0x09, 0x00,
+    0x00, 0x45, 0x09, 0x00, 0x00, 0x51, 0x09, 0x00, 0x00, 0x5d, 0x09, 0x00, 0x00, 0x69, 0x09, 0x00,
+    0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x1a, 0x3d, 0x19,
+    0x1b, 0x0d, 0x1b, 0x38, 0x1a, 0x0d, 0x05, 0x05, 0x3c, 0x1c, 0x3d, 0x35, 0x2c, 0x16, 0x1e, 0x33,
+    0x11, 0x35, 0x3b, 0x04, 0x33, 0x0c, 0x21, 0x37, 0x04, 0x0f, 0x27, 0x3f, 0x0a, 0x2a, 0x33, 0x1d,
+    0x0f, 0x1d, 0x33, 0x35, 0x22, 0x34, 0x04, 0x15, 0x12, 0x28, 0x39, 0x35, 0x14, 0x36, 0x10, 0x34,
+    0x0f, 0x16, 0x05, 0x26, 0x35, 0x0a, 0x1e, 0x15, 0x28, 0x18, 0x12, 0x00, 0x23, 0x2f, 0x15, 0x25,
+    0x02, 0x19, 0x17, 0x21, 0x1a, 0x0d, 0x1f, 0x2d, 0x06, 0x01, 0x17, 0x1f, 0x1f, 0x25, 0x3e, 0x29,
+    0x1a, 0x08, 0x0f, 0x3c, 0x31, 0x3c, 0x3a, 0x1a, 0x1e, 0x26, 0x22, 0x14, 0x20, 0x0c, 0x3f, 0x09,
+    0x3e, 0x0f, 0x1f, 0x27, 0x26, 0x09, 0x2d, 0x34, 0x00, 0x2f, 0x0e, 0x13, 0x3f, 0x1d, 0x22, 0x03,
+    0x15, 0x07, 0x13, 0x3d, 0x2a, 0x2f, 0x17, 0x09, 0x04, 0x31, 0x08, 0x13, 0x30, 0x29, 0x0c, 0x7e,
+    0x4b, 0x4f, 0x8b, 0xdd, 0xf5, 0xf5, 0x4c, 0xf8, 0x38, 0x5b, 0x76, 0x1c, 0x06, 0xaf, 0x53, 0x1b,
+    0x14, 0xf6, 0xae, 0xa8, 0x90, 0x57, 0x3a, 0xaf, 0xc5, 0x01, 0x0c, 0x8a, 0x99, 0xaa, 0xef, 0x06,
+    0xc5, 0xff, 0xae, 0xd8, 0xcb, 0x9c, 0xe8, 0x96, 0x2b, 0xa8, 0x4c, 0x6a, 0x65, 0x31, 0xd1, 0x7e,
+    0xfa, 0xa4, 0x0f, 0xe4, 0x8d, 0x2e, 0xf2, 0x30, 0x5a, 0x2e, 0x6c, 0xbb, 0x20, 0xfc, 0xc0, 0x9e,
+    0x7f, 0xd3, 0x0c, 0x2d, 0x58, 0x2d, 0xe6, 0x6c, 0xcc, 0x94, 0x73, 0xa7, 0xa1, 0x8b, 0xc0, 0x9a,
+    0x10, 0x26, 0xf6, 0x3f, 0xa6, 0xb6, 0x52, 0x75, 0x81, 0x67, 0x53, 0xf9, 0x29, 0x4a, 0xd3, 0xde,
+    0x5b, 0x24, 0x23, 0x6d, 0xd2, 0x21, 0x89, 0xb9, 0xa7, 0x65, 0x27, 0xeb, 0xd0, 0xaf, 0x2c, 0x70,
+    0xd9, 0xd4, 0x07, 0x3b, 0xb7, 0x5f, 0x2b, 0x20, 0xed, 0x4f, 0x72, 0x7a, 0x6d, 0x38, 0xf7, 0x0f,
+    0x24, 0xe2, 0xe0, 0x76, 0x64, 0x99, 0x7e, 0xab, 0xb5, 0xd9, 0x75, 0xed, 0x8f, 0xc9, 0x6d, 0x61,
+    0xa1, 0xdb, 0x45, 0xfa, 0xab, 0x3d, 0x2a, 0x5e, 0x54, 0xb2, 0x49, 0x47, 0x90, 0xa5, 0x37, 0x71,
+    0x92, 0xa7, 0xa2, 0x96, 0x42, 0xc3, 0x4b, 0x69, 0xba, 0x44, 0x9a, 0x64, 0xaa, 0x26, 0x2c, 0xd0,
+    0xff, 0x6a, 0x40, 0xa2, 0x09, 0x7f, 0x82, 0xc9, 0xf8, 0x0d, 0x44, 0x55, 0xdf, 0x4a, 0xf2, 0xfb,
+    0xea, 0x73, 0x25, 0xa2, 0x7b, 0x2c, 0x76, 0x44, 0x5d, 0x4f, 0xee, 0xd4, 0x16, 0xc9, 0x63, 0xaa,
+    0x05, 0xad, 0x73, 0x65, 0xdc, 0x6a, 0x2f, 0xa0, 0xf9, 0x8f, 0x2d, 0xbb, 0x2c, 0x49, 0x79, 0xf5,
+    0xef, 0x87, 0x52, 0x1f, 0xb1, 0xdc, 0xd6, 0xfe, 0xb2, 0x24, 0x38, 0xaf, 0xe0, 0xdd, 0x21, 0x3a,
+    0xf0, 0xf5, 0xb5, 0xc8, 0x13, 0x4a, 0xb1, 0x30, 0x51, 0x36, 0x7b, 0xd1, 0x82, 0x98, 0x76, 0x39,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x16, 0x1d, 0x3e,
+    0x17, 0x14, 0x3c, 0x05, 0x17, 0x3e, 0x00, 0x1c, 0x11, 0x22, 0x3b, 0x2d, 0x24, 0x1e, 0x10, 0x36,
+    0x3a, 0x13, 0x34, 0x33, 0x1b, 0x3c, 0x28, 0x23, 0x1d, 0x1e, 0x25, 0x18, 0x2b, 0x07, 0x1f, 0x3d,
+    0x11, 0x1c, 0x13, 0x1e, 0x09, 0x00, 0x12, 0x12, 0x14, 0x39, 0x1a, 0x0e, 0x0f, 0x2b, 0x09, 0x12,
+    0x31, 0x15, 0x33, 0x29, 0x31, 0x3d, 0x2c, 0x2b, 0x14, 0x2c, 0x0c, 0x0f, 0x2a, 0x06, 0x03, 0x10,
+    0x29, 0x29, 0x24, 0x32, 0x03, 0x0b, 0x3b, 0x2c, 0x0a, 0x24, 0x11, 0x1b, 0x13, 0x05, 0x32, 0x02,
+    0x22, 0x24, 0x07, 0x23, 0x0f, 0x0f, 0x25, 0x00, 0x36, 0x20, 0x1f, 0x1a, 0x2a, 0x10, 0x27, 0x19,
+    0x3c, 0x24, 0x14, 0x02, 0x38, 0x05, 0x3d, 0x3a, 0x1d, 0x00, 0x04, 0x34, 0x3c, 0x18, 0x2a, 0x2b,
+    0x0e, 0x32, 0x3f, 0x0c, 0x14, 0x2b, 0x37, 0x38, 0x2e, 0x2f, 0x20, 0x02, 0x09, 0x61, 0xe7, 0x7f,
+    0x18, 0x10, 0xc2, 0x96, 0xd8, 0x33, 0x03, 0xb4, 0x7a, 0xe8, 0xac, 0xfa, 0xce, 0x63, 0x46, 0x99,
+    0x13, 0xe9, 0xfc, 0xa6, 0x59, 0xaa, 0x0f, 0x56, 0x5a, 0xc4, 0xf0, 0xaf, 0x13, 0x1b, 0x58, 0x8d,
+    0x9c, 0x10, 0x11, 0xfa, 0x3c, 0x80, 0x65, 0x12, 0x79, 0xb3, 0x7d, 0x5f, 0x6b, 0x8c, 0xd5, 0x13,
+    0x28, 0x04, 0xe9, 0xad, 0x3f, 0x5a, 0xd1, 0x4d, 0xe6, 0x7a, 0xf1, 0x12, 0xbb, 0x9d, 0x0a, 0xe7,
+    0x16, 0xe8, 0xf0, 0xdf, 0x52, 0x4a, 0x45, 0x3e, 0xb4, 0x9c, 0x65, 0x51, 0x83, 0xb2, 0x0b, 0xcc,
+    0x11, 0x40, 0x69, 0x6a, 0xf4, 0x32, 0x53, 0x22, 0x94, 0x57, 0x0f, 0xf7, 0x0a, 0x1c, 0x01, 0x65,
+    0xa8, 0xca, 0x11, 0x7b, 0x75, 0x39, 0x59, 0xc9, 0xb6, 0x1d, 0xfc, 0x1b, 0x0d, 0x11, 0x18, 0xf1,
+    0x82, 0x69, 0xf4, 0xa8, 0xb0, 0xfd, 0xe6, 0x21, 0x03, 0x44, 0x1e, 0x1d, 0xf3, 0xa0, 0x79, 0x80,
+    0x77, 0x35, 0x9e, 0xf2, 0xa8, 0xd2, 0x9c, 0x29, 0x51, 0x1e, 0x8a, 0x1f, 0xa8, 0xfe, 0x1e, 0x73,
+    0x29, 0x57, 0xcc, 0xd7, 0x7a, 0xdc, 0xf7, 0xdd, 0xd8, 0xf5, 0x2e, 0xc7, 0x41, 0x04, 0xa9, 0x6d,
+    0x8b, 0x06, 0x5d, 0xa9, 0x7d, 0x93, 0xef, 0x37, 0xbf, 0x62, 0x71, 0xd2, 0x70, 0xbd, 0xdf, 0xf1,
+    0x4c, 0x24, 0x33, 0x82, 0x9a, 0xc2, 0xe3, 0x61, 0x94, 0x4f, 0xe7, 0xf5, 0xe6, 0x6d, 0xa7, 0xf8,
+    0x32, 0x18, 0xce, 0x80, 0x84, 0xcf, 0x26, 0x9e, 0x42, 0x8c, 0x41, 0x66, 0x3c, 0x84, 0xa3, 0xcf,
+    0x7a, 0x78, 0xe0, 0x62, 0x10, 0xdc, 0x97, 0x19, 0x92, 0x31, 0x7d, 0xb7, 0x9a, 0x95, 0x26, 0x49,
+    0x35, 0x87, 0x8f, 0x4c, 0x75, 0xff, 0x8b, 0x27, 0xd8, 0x58, 0x38, 0xe0, 0x69, 0x88, 0x49, 0x3e,
+    0x2b, 0x28, 0xbd, 0x2e, 0x72, 0x98, 0x1e, 0x02, 0x1d, 0x5f, 0x0b, 0xf5, 0xeb, 0xde, 0x0c, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x09, 0x35, 0x29, 0x3d, 0x22,
+    0x29, 0x1f, 0x3a, 0x06, 0x04, 0x3b, 0x1e, 0x19, 0x0a, 0x2a, 0x02, 0x03, 0x10, 0x3e, 0x28, 0x06,
+    0x10, 0x36, 0x18, 0x1f, 0x17, 0x1b, 0x1f, 0x10, 0x21, 0x02, 0x2c, 0x28, 0x0f, 0x14, 0x2e, 0x04,
+    0x3b, 0x08, 0x1b, 0x0d, 0x34, 0x02, 0x09, 0x13, 0x0e, 0x05, 0x3f, 0x2e, 0x0d, 0x1c, 0x11, 0x0c,
+    0x2e, 0x05, 0x03, 0x0a, 0x0d, 0x39, 0x3d, 0x25, 0x23, 0x01, 0x31, 0x16, 0x16, 0x1c, 0x13, 0x12,
+    0x07, 0x09, 0x15, 0x08, 0x13, 0x25, 0x21, 0x04, 0x05, 0x33, 0x38, 0x12, 0x26, 0x12, 0x38, 0x0c,
+    0x14, 0x21, 0x2b, 0x2c, 0x30, 0x15, 0x0b, 0x2b, 0x05, 0x12, 0x1a, 0x28, 0x0f, 0x03, 0x2f, 0x0a,
+    0x33, 0x1e, 0x14, 0x24, 0x0f, 0x29, 0x02, 0x0a, 0x0c, 0x2a, 0x15, 0x16, 0x0c, 0x2c, 0x05, 0x0a,
+    0x27, 0x2b, 0x18, 0x17, 0x27, 0x20, 0x1d, 0x24, 0x27, 0x04, 0x02, 0x0b, 0x2f, 0x21, 0x17, 0x03,
+    0x31, 0x1e, 0x05, 0x2b, 0x38, 0x14, 0x04, 0x02, 0x20, 0x31, 0x1d, 0x11, 0x31, 0x06, 0x05, 0x38,
+    0x30, 0xed, 0x64, 0x02, 0x6e, 0x49, 0x78, 0x9d, 0x6f, 0x07, 0x0f, 0xfe, 0xc2, 0x7b, 0x39, 0x26,
+    0x56, 0x1b, 0x3f, 0x92, 0xc7, 0x60, 0x00, 0x95, 0x04, 0xfd, 0x32, 0x9c, 0x18, 0x48, 0x28, 0x62,
+    0xaa, 0x7d, 0xa2, 0xac, 0x26, 0x55, 0xa2, 0xb7, 0x36, 0xa9, 0x3a, 0xdc, 0xfe, 0xa5, 0xae, 0x72,
+    0x0d, 0xfb, 0xfb, 0x7f, 0x6f, 0x76, 0x93, 0xbf, 0x3f, 0x38, 0x3b, 0x43, 0xd9, 0xad, 0x48, 0x64,
+    0xe7, 0x9f, 0x76, 0x78, 0x15, 0x27, 0xa3, 0xbe, 0x17, 0x99, 0x38, 0xd0, 0x2f, 0xf3, 0x63, 0xbf,
+    0xd3, 0xd7, 0xc0, 0x82, 0xb4, 0x76, 0x15, 0x4b, 0x1a, 0x0e, 0x57, 0xd6, 0xf3, 0x2d, 0x1a, 0xe7,
+    0x85, 0x07, 0x0e, 0x12, 0xcf, 0xe1, 0xe3, 0x64, 0x99, 0x78, 0xd5, 0xfd, 0xaa, 0xd4, 0x6b, 0xf4,
+    0x50, 0x0b, 0x13, 0xff, 0xdd, 0xb8, 0xa3, 0x65, 0x89, 0xe9, 0x2e, 0x61, 0x61, 0xd5, 0x34, 0x49,
+    0x5a, 0x49, 0xc0, 0xb0, 0xf9, 0xa3, 0xe3, 0x6d, 0xd4, 0x37, 0x7d, 0xc9, 0xcc, 0xea, 0x5b, 0xc2,
+    0x25, 0xbc, 0xd8, 0x67, 0xc0, 0x3b, 0x2c, 0xc1, 0x4d, 0xe5, 0x25, 0xac, 0x62, 0x88, 0xfe, 0x1d,
+    0x39, 0x3e, 0x8d, 0x5c, 0x9c, 0x07, 0x7f, 0xca, 0x77, 0xf1, 0x53, 0x52, 0x39, 0x50, 0xf4, 0xfe,
+    0x63, 0xc7, 0x9a, 0x50, 0x2f, 0x0c, 0x61, 0x61, 0x42, 0x53, 0xb8, 0x8a, 0x73, 0x81, 0xf2, 0xb4,
+    0x42, 0x21, 0x57, 0x9e, 0x90, 0xa1, 0xfe, 0x7b, 0x9c, 0x23, 0x16, 0xbe, 0xde, 0x25, 0x77, 0xc2,
+    0x6d, 0xcf, 0x7d, 0x6f, 0x78, 0x83, 0x33, 0x3c, 0x54, 0x5d, 0x72, 0xcd, 0xa5, 0xac, 0xb1, 0x02,
+    0x2f, 0x72, 0xf4, 0x93, 0xc6, 0xf7, 0x47, 0xf3, 0x94, 0x25, 0x30, 0x04, 0xf9, 0x35, 0xb8, 0x17,
+    0x61, 0x13, 0x47, 0xa9, 0x8f, 0x57, 0xb0, 0x9f, 0xc3, 0x5f, 0x65, 0xa9, 0xdd, 0x09, 0xfb, 0xda,
+    0x46, 0x06, 0x0f, 0xd0, 0x9f, 0x8b, 0x5b, 0xfd, 0x11, 0x0e, 0x5e, 0x28, 0xaf, 0x94, 0x2f, 0x47,
+    0xc8, 0x19, 0x37, 0xab, 0xf0, 0xd8, 0x0c, 0x70, 0x86, 0xb8, 0x4b, 0x8b, 0x09, 0xd8, 0x96, 0x9e,
+    0xd1, 0xd4, 0x22, 0xac, 0xc9, 0xde, 0x69, 0x73, 0x35, 0x7f, 0xd6, 0x09, 0xca, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x08, 0x22, 0x09, 0x02, 0x25,
+    0x12, 0x0d, 0x1a, 0x02, 0x36, 0x07, 0x25, 0x0f, 0x1b, 0x0d, 0x09, 0x3b, 0x0e, 0x24, 0x1c, 0x15,
+    0x1c, 0x2a, 0x14, 0x21, 0x03, 0x34, 0x10, 0x08, 0x2e, 0x39, 0x2d, 0x23, 0x0d, 0x03, 0x0b, 0x0f,
+    0x27, 0x01, 0x21, 0x0d, 0x23, 0x12, 0x26, 0x11, 0x1a, 0x05, 0x24, 0x1b, 0x05, 0x2b, 0x1c, 0x38,
+    0x0b, 0x00, 0x29, 0x22, 0x2a, 0x00, 0x3e, 0x28, 0x06, 0x25, 0x06, 0x10, 0x29, 0x32, 0x07, 0x2a,
+    0x03, 0x37, 0x17, 0x2e, 0x1f, 0x2f, 0x2d, 0x14, 0x2e, 0x3a, 0x25, 0x02, 0x07, 0x0c, 0x0a, 0x3f,
+    0x22, 0x36, 0x29, 0x34, 0x2d, 0x02, 0x3e, 0x22, 0x08, 0x0b, 0x36, 0x0e, 0x08, 0x20, 0x1d, 0x3f,
+    0x18, 0x11, 0x11, 0x26, 0x11, 0x2d, 0x33, 0x0a, 0x04, 0x2f, 0x0d, 0x2c, 0x26, 0x3b, 0x03, 0x1a,
+    0x08, 0x0e, 0x01, 0x39, 0x2d, 0x25, 0x3e, 0x13, 0x20, 0x2c, 0x17, 0x34, 0x0b, 0x0a, 0x3f, 0x3a,
+    0x11, 0x30, 0x28, 0x32, 0xd6, 0xc4, 0x15, 0xe9, 0x5b, 0xc9, 0xd5, 0x26, 0xc9, 0xfc, 0xaf, 0xe8,
+    0x33, 0xa4, 0xb9, 0x9f, 0x37, 0x7a, 0xf1, 0xe8, 0x6b, 0x1c, 0xbc, 0xb3, 0x95, 0x38, 0x34, 0x79,
+    0xf0, 0x83, 0x25, 0x7d, 0xae, 0x30, 0x84, 0xbf, 0x87, 0x7d, 0x5e, 0x68, 0xa3, 0xff, 0xd7, 0xde,
+    0x38, 0xf7, 0x2e, 0x6c, 0x71, 0xf4, 0xff, 0xdd, 0x20, 0x14, 0xb1, 0x03, 0x1e, 0x50, 0x28, 0xaf,
+    0x7c, 0x21, 0x0f, 0x42, 0x93, 0x94, 0xe8, 0x72, 0xf5, 0xb3, 0xf5, 0xbd, 0x4c, 0x3b, 0x04, 0xe4,
+    0x74, 0x31, 0x95, 0x09, 0x2f, 0x92, 0x5d, 0xa6, 0x5a, 0x70, 0xdf, 0x3b, 0x85, 0x79, 0x4d, 0xcd,
+    0x45, 0x31, 0x6a, 0x5f, 0x30, 0x4e, 0x5f, 0xe6, 0x6f, 0x5c, 0x55, 0xcc, 0x7b, 0xb1, 0xf4, 0xb3,
+    0xa9, 0x88, 0x57, 0x40, 0x39, 0x8e, 0xb1, 0x20, 0x92, 0x56, 0x08, 0x2e, 0x51, 0x73, 0x0c, 0xb7,
+    0xfa, 0xb3, 0x9d, 0xdc, 0xff, 0xc3, 0x02, 0xe8, 0x67, 0xbb, 0x83, 0x81, 0x5c, 0x24, 0x57, 0xb7,
+    0xc0, 0xb8, 0x13, 0xf7, 0x90, 0x22, 0x8b, 0x6b, 0xf2, 0xbf, 0x4e, 0xc8, 0x93, 0x73, 0x60, 0xc3,
+    0x0d, 0x4a, 0xab, 0x5b, 0xaf, 0xee, 0x57, 0x74, 0x37, 0xdf, 0xb6, 0xa3, 0x2a, 0xd6, 0xf7, 0x8e,
+    0x6a, 0x90, 0xfa, 0x5f, 0xfc, 0xd7, 0x29, 0x03, 0x99, 0xc3, 0x5a, 0x4e, 0x96, 0x0c, 0x87, 0x5d,
+    0x9c, 0xf8, 0xd8, 0x9a, 0x8a, 0x64, 0xde, 0x85, 0x11, 0x84, 0x17, 0x8c, 0xd1, 0x76, 0xb1, 0xd0,
+    0xd8, 0xbd, 0xf0, 0x9e, 0x5a, 0x0d, 0x11, 0xe5, 0xf6, 0xb5, 0x18, 0x25, 0xc5, 0x58, 0x3d, 0xcc,
+    0x31, 0x2d, 0xf2, 0x37, 0x93, 0xb4, 0xc4, 0xfa, 0xa5, 0x1a, 0xda, 0x33, 0xd7, 0x09, 0x4f, 0xbf,
+    0x5d, 0x95, 0x5f, 0x44, 0x4a, 0x5b, 0xb1, 0x92, 0xd2, 0x99, 0x9e, 0xfb, 0xb3, 0xf1, 0xd1, 0xe9,
+    0xc3, 0xcc, 0x8a, 0xb7, 0x79, 0xc9, 0x12, 0x3d, 0xc0, 0x6a, 0x6c, 0x26, 0x0f, 0x56, 0xa7, 0x8c,
+    0x01, 0x25, 0x15, 0xa9, 0x0a, 0x34, 0x81, 0x76, 0xd7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
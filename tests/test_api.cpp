@@ -0,0 +1,84 @@
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+#include "api.cpp" // the C API is built only into the Rust crate; compile it in here
+#include "common/Utils.hpp"
+#include "test_util.h"
+
+TEST_SUITE_BEGIN("api");
+
+TEST_CASE("plot-handle-concurrent-qualities")
+{
+    constexpr uint8_t k = 18;
+    constexpr uint8_t strength = 2;
+    ProofParams const params(
+        Utils::hexToBytes("0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF")
+            .data(),
+        k, strength, 0);
+    std::string const file_name = "plot_api_handle.bin";
+    Plotter plotter(params);
+    PlotFile::writeData(
+        file_name, plotter.run(), params, 0, 0, std::array<uint8_t, 32 + 48 + 32>({}));
+
+    // challenge 01... has quality chains on this plot (see plot-k18-strength2-4-5)
+    constexpr uint32_t kMaxOutputs = 16;
+    std::vector<std::array<uint8_t, 32>> challenges(8);
+    std::vector<std::vector<QualityChain>> expected(challenges.size());
+    for (size_t c = 0; c < challenges.size(); ++c) {
+        challenges[c].fill(0);
+        challenges[c][0] = static_cast<uint8_t>(1 + c);
+        expected[c].resize(kMaxOutputs);
+        expected[c].resize(qualities_for_challenge(
+            file_name.c_str(), challenges[c].data(), expected[c].data(), kMaxOutputs));
+    }
+    ENSURE(!expected[0].empty());
+
+    // every thread runs every challenge on one handle and must see what a fresh open sees: two
+    // handles sharing a chunk cache, then one without a cache
+    PlotChunkCache* const cache = chunk_cache_new(uint64_t(64) << 20);
+    ENSURE(cache != nullptr);
+    PlotHandle* const cached[2] = { plot_open(file_name.c_str(), cache),
+        plot_open(file_name.c_str(), cache) };
+    PlotHandle* const handle = plot_open(file_name.c_str(), nullptr);
+    std::shared_ptr<ChunkCache> const shared_cache = cache->cache;
+    chunk_cache_free(cache); // the handles keep it
+    ENSURE(cached[0] != nullptr);
+    ENSURE(cached[1] != nullptr);
+    ENSURE(handle != nullptr);
+    std::atomic<int> mismatches { 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            PlotHandle* const plot = t < 4 ? cached[t % 2] : handle;
+            for (int round = 0; round < 4; ++round) {
+                for (size_t i = 0; i < challenges.size(); ++i) {
+                    size_t const c = (i + static_cast<size_t>(t)) % challenges.size();
+                    std::vector<QualityChain> found(kMaxOutputs);
+                    found.resize(qualities_for_challenge_h(
+                        plot, challenges[c].data(), found.data(), kMaxOutputs));
+                    bool const same = found.size() == expected[c].size()
+                        && std::equal(found.begin(), found.end(), expected[c].begin(),
+                            [](QualityChain const& a, QualityChain const& b) {
+                                return a.chain_links == b.chain_links;
+                            });
+                    if (!same)
+                        ++mismatches;
+                }
+            }
+        });
+    }
+    for (std::thread& thread: threads)
+        thread.join();
+    // the second handle and later rounds find what the first decoded
+    ChunkCache::Stats const stats = shared_cache->stats();
+    ENSURE(stats.hits > 0);
+    ENSURE(stats.misses > 0);
+    plot_close(cached[0]);
+    plot_close(cached[1]);
+    plot_close(handle);
+    std::filesystem::remove(file_name);
+    ENSURE(mismatches == 0);
+}
+
+TEST_SUITE_END();
@@ -1,7 +1,10 @@
 #include "common/Timer.hpp"
 #include "plot/ChunkCompressor.hpp"
 #include "test_util.h"
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 TEST_CASE("compress_proof_fragments")
@@ -36,6 +39,199 @@ TEST_CASE("compress_proof_fragments")
         compression_ratio * 100.0);
 }
 
+TEST_CASE("compress_seekable_proof_fragments")
+{
+    // 4 blocks of range 1024 from 5000; the third is empty, the last holds one fragment
+    std::vector<ProofFragment> proof_fragments
+        = { 5000, 5100, 5999, 6000, 6010, 6500, 6900, 8999 };
+    int const stub_bits = 4;
+
+    std::vector<uint8_t> const chunk = ChunkCompressor::compressSeekableProofFragments(
+        proof_fragments, 5000, 10, 2, stub_bits);
+    ENSURE(ChunkCompressor::decompressSeekableProofFragments(chunk, 5000, 10, 2, stub_bits)
+        == proof_fragments);
+
+    std::vector<std::vector<ProofFragment>> const blocks
+        = { { 5000, 5100, 5999, 6000, 6010 }, { 6500, 6900 }, {}, { 8999 } };
+    for (uint32_t b = 0; b < 4; ++b) {
+        auto const [offset, size] = ChunkCompressor::seekBlockExtent(chunk, 4, b);
+        ENSURE(offset + size <= chunk.size());
+        std::span<uint8_t const> const bytes(chunk.data() + offset, size);
+        ENSURE(ChunkCompressor::decompressProofFragments(bytes, 5000 + b * 1024, stub_bits)
+            == blocks[b]);
+    }
+    CHECK_THROWS_AS(ChunkCompressor::seekBlockExtent(chunk, 8, 0), std::runtime_error);
+
+    ENSURE(ChunkCompressor::seekableFragmentCount(chunk, 2) == proof_fragments.size());
+    std::vector<ProofFragment> out(proof_fragments.size() + 1);
+    CHECK_THROWS_AS(ChunkCompressor::decompressSeekableProofFragmentsInto(
+                        chunk, 5000, 10, 2, stub_bits, out),
+        std::invalid_argument);
+    out.pop_back();
+    ChunkCompressor::decompressSeekableProofFragmentsInto(chunk, 5000, 10, 2, stub_bits, out);
+    ENSURE(out == proof_fragments);
+}
+
+TEST_CASE("decompress_proof_fragments_all_widths")
+{
+    // the fused decode against deltas + stubs from decompress(), over every stub width and block
+    // sizes around the 4-wide steps and the stub tail, on both kernels
+    printfln("avx2 decode kernel: %s", ChunkCompressor::decodeUsesAvx2() ? "yes" : "no");
+    uint64_t rng = 0x2545f4914f6cdd1dULL;
+    for (int stub_bits = 1; stub_bits < 56; ++stub_bits) {
+        for (size_t n: { size_t(0), size_t(1), size_t(3), size_t(4), size_t(9), size_t(517) }) {
+            uint64_t const start = (rng >> 8) & 0xFFFFFFFFFFULL;
+            std::vector<ProofFragment> proof_fragments;
+            ProofFragment f = start;
+            for (size_t i = 0; i < n; ++i) {
+                rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+                f += (rng >> 20) % (200ULL << stub_bits);
+                proof_fragments.push_back(f);
+            }
+            std::vector<uint8_t> const compressed
+                = ChunkCompressor::compressProofFragments(proof_fragments, start, stub_bits);
+            std::vector<ProofFragment> const decoded
+                = ChunkCompressor::decompressProofFragments(compressed, start, stub_bits);
+            ENSURE(decoded == proof_fragments);
+            std::vector<ProofFragment> scalar(n);
+            ChunkCompressor::decompressProofFragmentsIntoScalar(
+                compressed, start, stub_bits, scalar);
+            ENSURE(scalar == proof_fragments);
+
+            std::vector<uint8_t> deltas;
+            std::vector<uint64_t> stubs;
+            ChunkCompressor::decompress(compressed, static_cast<uint8_t>(stub_bits), deltas, stubs);
+            ENSURE(deltas.size() == n);
+            ProofFragment previous = start;
+            for (size_t i = 0; i < n; ++i) {
+                previous += (uint64_t(deltas[i]) << stub_bits) | stubs[i];
+                ENSURE(previous == decoded[i]);
+            }
+        }
+    }
+
+    // stub bytes cut short
+    std::vector<ProofFragment> const proof_fragments = { 10, 20, 30, 40, 50 };
+    std::vector<uint8_t> compressed
+        = ChunkCompressor::compressProofFragments(proof_fragments, 0, 12);
+    compressed[8] = 2; // stub_bytes_size: 2 bytes for 5 * 12 bits
+    CHECK_THROWS_AS(
+        ChunkCompressor::decompressProofFragments(compressed, 0, 12), std::runtime_error);
+}
+
+TEST_CASE("delta_codecs")
+{
+    uint64_t rng = 0x9e3779b97f4a7c15ULL;
+    auto next = [&rng]() {
+        rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+        return rng >> 33;
+    };
+    // skewed like real deltas, a single symbol, incompressible, and more than one Huffman segment
+    std::vector<std::vector<uint8_t>> inputs(6);
+    inputs[1] = { 7 };
+    inputs[2].assign(1000, 3);
+    for (int i = 0; i < 1000; ++i)
+        inputs[3].push_back(static_cast<uint8_t>(next() % 16 * (next() % 4)));
+    for (int i = 0; i < 5000; ++i)
+        inputs[4].push_back(static_cast<uint8_t>(next()));
+    for (int i = 0; i < 300000; ++i)
+        inputs[5].push_back(static_cast<uint8_t>(next() % 8 + (next() % 64 == 0 ? 200 : 0)));
+
+    std::vector<ProofFragment> const proof_fragments
+        = { 5000, 5100, 5999, 6000, 6010, 6500, 6900, 8999 };
+
+    // fse-shared: one table for every input, as a plot trains it on all of its blocks
+    std::array<uint64_t, 256> counts {};
+    for (std::vector<uint8_t> const& deltas: inputs) {
+        for (uint8_t d: deltas)
+            ++counts[d];
+    }
+    ChunkCompressor::countSeekableDeltas(proof_fragments, 5000, 10, 2, 4, counts);
+    std::shared_ptr<SharedFseTable const> const fse_table = SharedFseTable::train(counts);
+    ENSURE(fse_table != nullptr);
+
+    for (DeltaCodec codec: kDeltaCodecs) {
+        ENSURE(parse_delta_codec(delta_codec_name(codec)) == codec);
+        DeltaCoding const coding(codec, fse_table.get());
+        for (std::vector<uint8_t> const& deltas: inputs) {
+            std::vector<uint8_t> const coded = DeltaCoder::encode(coding, deltas);
+            if (coded.empty())
+                continue; // stored raw by the caller
+            ENSURE(coded.size() < deltas.size());
+            std::vector<uint8_t> decoded(deltas.size());
+            DeltaCoder::decode(coding, coded, decoded);
+            ENSURE(decoded == deltas);
+        }
+        // (the shared table, fitted to the mix, need not beat storing one input raw)
+        if (codec != DeltaCodec::FseShared) {
+            ENSURE(!DeltaCoder::encode(coding, inputs[3]).empty());
+        }
+        ENSURE(!DeltaCoder::encode(coding, inputs[5]).empty());
+
+        std::vector<uint8_t> const chunk = ChunkCompressor::compressSeekableProofFragments(
+            proof_fragments, 5000, 10, 2, 4, coding);
+        ENSURE(ChunkCompressor::decompressSeekableProofFragments(chunk, 5000, 10, 2, 4, coding)
+            == proof_fragments);
+    }
+    ENSURE(!parse_delta_codec("zstd"));
+
+    // damaged rANS data is an error
+    std::vector<uint8_t> coded = DeltaCoder::encode(DeltaCodec::Rans, inputs[3]);
+    std::vector<uint8_t> decoded(inputs[3].size());
+    coded.pop_back();
+    CHECK_THROWS_AS(DeltaCoder::decode(DeltaCodec::Rans, coded, decoded), std::runtime_error);
+}
+
+TEST_CASE("shared_fse_table")
+{
+    std::vector<uint8_t> deltas;
+    for (int i = 0; i < 20000; ++i)
+        deltas.push_back(static_cast<uint8_t>((i * 7919) % 13 * ((i % 5) != 0)));
+    std::array<uint64_t, 256> counts {};
+    for (uint8_t d: deltas)
+        ++counts[d];
+    std::shared_ptr<SharedFseTable const> const table = SharedFseTable::train(counts);
+    ENSURE(table != nullptr);
+
+    // without the per-block table the stream is smaller than plain FSE's
+    std::vector<uint8_t> const coded = DeltaCoder::encode({ DeltaCodec::FseShared, table.get() },
+        deltas);
+    ENSURE(!coded.empty());
+    ENSURE(coded.size() < DeltaCoder::encode(DeltaCodec::Fse, deltas).size());
+
+    // the serialized table decodes what the original encoded
+    std::shared_ptr<SharedFseTable const> const loaded
+        = SharedFseTable::deserialize(table->serialized());
+    ENSURE(std::ranges::equal(loaded->serialized(), table->serialized()));
+    std::vector<uint8_t> decoded(deltas.size());
+    DeltaCoder::decode({ DeltaCodec::FseShared, loaded.get() }, coded, decoded);
+    ENSURE(decoded == deltas);
+
+    // counts beyond 32 bits are scaled down, keeping rare deltas
+    std::array<uint64_t, 256> huge {};
+    huge[0] = 1ULL << 40;
+    huge[1] = 3ULL << 38;
+    huge[200] = 1;
+    std::shared_ptr<SharedFseTable const> const scaled = SharedFseTable::train(huge);
+    ENSURE(scaled != nullptr);
+    ENSURE(scaled->encodes(200));
+    ENSURE(!scaled->encodes(2));
+
+    // one distinct delta has no table; a delta the table was not trained on, a missing table
+    // and a damaged table are errors
+    std::array<uint64_t, 256> single {};
+    single[4] = 1000;
+    ENSURE(SharedFseTable::train(single) == nullptr);
+    deltas.push_back(100);
+    CHECK_THROWS_AS(DeltaCoder::encode({ DeltaCodec::FseShared, table.get() }, deltas),
+        std::invalid_argument);
+    CHECK_THROWS_AS(DeltaCoder::encode(DeltaCodec::FseShared, decoded),
+        std::invalid_argument);
+    std::vector<uint8_t> damaged(table->serialized().begin(), table->serialized().end());
+    damaged[0] |= 0x0F; // table log 20
+    CHECK_THROWS_AS(SharedFseTable::deserialize(damaged), std::runtime_error);
+}
+
 TEST_CASE("compress_indexes")
 {
     std::vector<int> indexes = { 2006,
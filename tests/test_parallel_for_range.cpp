@@ -1,9 +1,14 @@
 #include "test_util.h"
 
 #include "common/ParallelForRange.hpp"
+#include "common/ParallelPrefixSum.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <random>
 #include <set>
+#include <stdexcept>
 #include <vector>
 
 TEST_CASE("parallel_for_range on list visits each element exactly once")
@@ -55,3 +60,152 @@ TEST_CASE("parallel_for_range on scalar range visits each element exactly once")
         }
     }
 }
+
+TEST_CASE("parallel_for_dynamic visits each index exactly once")
+{
+    int const N = 10000;
+
+    std::vector<unsigned> thread_counts = { 0, 1, 2, 3, 4, 8, 16, 32, 64 };
+    std::vector<int> grains = { 1, 7, 64, N, 2 * N };
+
+    for (unsigned tc: thread_counts) {
+        for (int grain: grains) {
+            std::vector<std::atomic<int>> counts(N);
+            for (int i = 0; i < N; ++i)
+                counts[i].store(0, std::memory_order_relaxed);
+
+            // offset start, so claimed blocks are not aligned to zero
+            parallel_for_dynamic(
+                5, N, [&](int v) { counts[v].fetch_add(1, std::memory_order_relaxed); }, tc, grain);
+
+            for (int i = 0; i < N; ++i) {
+                CHECK_EQ(counts[i].load(std::memory_order_relaxed), i < 5 ? 0 : 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("histogram_offsets matches a serial scan")
+{
+    std::mt19937 rng(7);
+
+    // small tables take the serial path, large ones the blocked parallel one
+    struct Shape {
+        std::size_t rows;
+        std::size_t radix;
+    };
+    std::vector<Shape> shapes = { { 1, 16 }, { 3, 256 }, { 64, 2048 }, { 37, 4096 } };
+    std::vector<unsigned> thread_counts = { 0, 1, 2, 5, 16 };
+
+    for (auto const& shape: shapes) {
+        std::vector<uint32_t> counts(shape.rows * shape.radix);
+        for (auto& c: counts)
+            c = rng() % 100;
+
+        std::vector<std::size_t> want_start(shape.radix + 1, 0);
+        std::vector<std::size_t> want_rows(counts.size(), 0);
+        std::size_t acc = 0;
+        for (std::size_t r = 0; r < shape.radix; ++r) {
+            want_start[r] = acc;
+            for (std::size_t t = 0; t < shape.rows; ++t) {
+                want_rows[t * shape.radix + r] = acc;
+                acc += counts[t * shape.radix + r];
+            }
+        }
+        want_start[shape.radix] = acc;
+
+        for (unsigned tc: thread_counts) {
+            std::vector<std::size_t> start(shape.radix + 1, 0);
+            std::vector<std::size_t> rows(counts.size(), 0);
+            histogram_offsets(std::span<uint32_t const>(counts),
+                shape.rows,
+                shape.radix,
+                std::span<std::size_t>(start),
+                std::span<std::size_t>(rows),
+                tc);
+            CHECK(start == want_start);
+            CHECK(rows == want_rows);
+
+            std::vector<std::size_t> start_only(shape.radix + 1, 0);
+            histogram_offsets(std::span<uint32_t const>(counts),
+                shape.rows,
+                shape.radix,
+                std::span<std::size_t>(start_only),
+                std::span<std::size_t> {},
+                tc);
+            CHECK(start_only == want_start);
+        }
+    }
+}
+
+TEST_CASE("parallel_for_ordered consumes every result in order within the window")
+{
+    int const N = 2000;
+
+    std::vector<unsigned> thread_counts = { 0, 1, 2, 3, 8, 32 };
+    std::vector<std::size_t> windows = { 0, 1, 5, 64 };
+
+    for (unsigned tc: thread_counts) {
+        for (std::size_t window: windows) {
+            std::atomic<int> claimed { 0 };
+            int consumed = 0;
+            int max_in_flight = 0;
+            std::vector<int> order;
+            parallel_for_ordered(
+                7,
+                N,
+                [&](int i) {
+                    claimed.fetch_add(1, std::memory_order_relaxed);
+                    return std::vector<int>(static_cast<std::size_t>(i % 5), i);
+                },
+                [&](int i, std::vector<int> const& result) {
+                    CHECK(result == std::vector<int>(static_cast<std::size_t>(i % 5), i));
+                    max_in_flight = std::max(max_in_flight, claimed.load() - consumed);
+                    ++consumed;
+                    order.push_back(i);
+                },
+                tc,
+                window);
+
+            std::vector<int> want(N - 7);
+            for (int i = 7; i < N; ++i)
+                want[i - 7] = i;
+            CHECK(order == want);
+            // the window is at least one per thread, two per thread by default; the result being
+            // consumed has left it already
+            std::size_t const threads = std::max(1u, tc);
+            std::size_t const bound = std::max(window == 0 ? 2 * threads : window, threads);
+            CHECK(static_cast<std::size_t>(max_in_flight) <= bound + 1);
+        }
+    }
+}
+
+TEST_CASE("parallel_for_ordered rethrows a failure on the calling thread")
+{
+    for (unsigned tc: { 1u, 4u }) {
+        int consumed = 0;
+        CHECK_THROWS_AS(parallel_for_ordered(
+                            0,
+                            1000,
+                            [](int i) {
+                                if (i == 500)
+                                    throw std::runtime_error("produce");
+                                return i;
+                            },
+                            [&](int, int) { ++consumed; },
+                            tc),
+            std::runtime_error);
+        CHECK(consumed <= 500);
+
+        CHECK_THROWS_AS(parallel_for_ordered(
+                            0,
+                            1000,
+                            [](int i) { return i; },
+                            [](int i, int) {
+                                if (i == 10)
+                                    throw std::logic_error("consume");
+                            },
+                            tc),
+            std::logic_error);
+    }
+}
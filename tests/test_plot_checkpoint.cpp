@@ -0,0 +1,66 @@
+#include "common/Utils.hpp"
+#include "plot/PlotCheckpoint.hpp"
+#include "plot/Plotter.hpp"
+#include "test_util.h"
+
+#include <filesystem>
+
+TEST_SUITE_BEGIN("plot-checkpoint");
+
+TEST_CASE("resume-from-each-table")
+{
+    constexpr int K = 18;
+    constexpr int strength = 2;
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        K, strength, 0);
+
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "pos2_checkpoint_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    Plotter plotter(params);
+    Plotter::Options opts;
+    opts.checkpoint_dir = dir.string();
+    opts.remove_checkpoints_on_success = false;
+    PlotData reference = plotter.run(opts);
+    ENSURE(!reference.t3_proof_fragments.empty());
+
+    for (auto stage: { CheckpointStage::Xs, CheckpointStage::T1, CheckpointStage::T2,
+             CheckpointStage::T3 }) {
+        std::string path = PlotCheckpoint::path_for(opts.checkpoint_dir, params, stage);
+        ENSURE(std::filesystem::exists(path));
+
+        PlotCheckpoint::Header header = PlotCheckpoint::read_header(path);
+        ENSURE(header.stage == stage);
+        ENSURE(header.count > 0);
+
+        printfln("Resuming from table %d (%llu entries)", int(stage),
+            static_cast<unsigned long long>(header.count));
+        PlotData resumed = plotter.resume(path, opts);
+        ENSURE(resumed == reference);
+    }
+
+    auto latest = PlotCheckpoint::find_latest(opts.checkpoint_dir, params);
+    ENSURE(latest.has_value());
+    ENSURE(*latest == PlotCheckpoint::path_for(opts.checkpoint_dir, params, CheckpointStage::T3));
+
+    // A checkpoint from another plot id must be rejected.
+    ProofParams other(Utils::hexToBytes(
+                          "0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF")
+                          .data(),
+        K, strength, 0);
+    Plotter other_plotter(other);
+    CHECK_THROWS_AS(other_plotter.resume(*latest, opts), std::runtime_error);
+
+    // Successful run cleans up when asked to.
+    opts.remove_checkpoints_on_success = true;
+    PlotData resumed = plotter.run_or_resume(opts);
+    ENSURE(resumed == reference);
+    ENSURE(!PlotCheckpoint::find_latest(opts.checkpoint_dir, params).has_value());
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_SUITE_END();
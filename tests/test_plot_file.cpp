@@ -1,6 +1,10 @@
+#include <filesystem>
+#include <fstream>
+
 #include "common/Utils.hpp"
 #include "plot/PlotFile.hpp"
 #include "plot/Plotter.hpp"
+#include "plot_file_fixtures.hpp"
 #include "test_util.h"
 
 TEST_SUITE_BEGIN("plot-file");
@@ -53,6 +57,270 @@ TEST_CASE("plot-read-write")
     PlotData converted = ChunkedProofFragments::convertToPlotData(partitioned_data);
     ENSURE(plot == converted);
     ENSURE(plotter.getProofParams() == read_plot.params);
+    ENSURE(read_plot.data.proof_fragments_chunks == partitioned_data.proof_fragments_chunks);
+    ENSURE(PlotFile(file_name).readAllProofFragments() == plot.t3_proof_fragments);
+}
+
+TEST_CASE("plot-read-chunks")
+{
+    constexpr int K = 18;
+    ProofParams params(Utils::hexToBytes(PLOT_ID_HEX).data(), K, 2, 0);
+    uint64_t const range_per_chunk = 1ULL << (K + PlotFile::CHUNK_SPAN_RANGE_BITS);
+    int const stub_bits = K - PlotFile::MINUS_STUB_BITS;
+
+    // sorted fragments within each chunk's range, spaced like a real plot's
+    ChunkedProofFragments chunked;
+    uint64_t rng = 0x9e3779b97f4a7c15ULL;
+    for (uint64_t c = 0; c < 4; ++c) {
+        std::vector<ProofFragment> chunk;
+        ProofFragment f = c * range_per_chunk;
+        for (;;) {
+            rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+            f += (rng >> 40) % (64ULL << stub_bits);
+            if (f >= (c + 1) * range_per_chunk)
+                break;
+            chunk.push_back(f);
+        }
+        chunked.proof_fragments_chunks.push_back(std::move(chunk));
+    }
+
+    // both read methods, on the same files
+    for (PlotFile::ReadMethod const method:
+        { PlotFile::ReadMethod::Stream, PlotFile::ReadMethod::Mapped }) {
+        std::string const file_name = "plot_read_chunks.bin";
+        PlotFile::writeData(
+            file_name, chunked, params, 0, 0, std::array<uint8_t, 32 + 48 + 32>({}));
+
+        PlotFile plot_file(file_name, method);
+        for (uint64_t c = 0; c < chunked.proof_fragments_chunks.size(); ++c)
+            ENSURE(plot_file.readChunk(c) == chunked.proof_fragments_chunks[c]);
+        ENSURE(PlotFile::readAllChunkedData(file_name).data.proof_fragments_chunks
+            == chunked.proof_fragments_chunks);
+
+        std::vector<ProofFragment> flat;
+        uint64_t next_chunk = 0;
+        plot_file.forEachChunk([&](uint64_t chunk_index, std::vector<ProofFragment>&& fragments) {
+            ENSURE(chunk_index == next_chunk++);
+            ENSURE(fragments == chunked.proof_fragments_chunks[chunk_index]);
+            flat.insert(flat.end(), fragments.begin(), fragments.end());
+        });
+        ENSURE(next_chunk == chunked.proof_fragments_chunks.size());
+        ENSURE(plot_file.readAllProofFragments() == flat);
+
+        Range const range { 2 * range_per_chunk + 1000,
+            2 * range_per_chunk + (range_per_chunk >> 4) };
+        plot_file.prefetchProofFragmentsInRange(range);
+        std::vector<ProofFragment> expected;
+        for (ProofFragment f: chunked.proof_fragments_chunks[2]) {
+            if (f >= range.start && f < range.end)
+                expected.push_back(f);
+        }
+        ENSURE(!expected.empty());
+        ENSURE(plot_file.getProofFragmentsInRange(range) == expected);
+
+        // chaining sets decode through their seek block only
+        for (size_t set_index: { size_t(0), size_t(1), size_t(1023), size_t(2048), size_t(4095) }) {
+            Range const set = params.get_chaining_set_range(set_index);
+            std::vector<ProofFragment> in_set;
+            for (ProofFragment f: chunked.proof_fragments_chunks[set.start / range_per_chunk]) {
+                if (f >= set.start && f < set.end)
+                    in_set.push_back(f);
+            }
+            ENSURE(plot_file.getProofFragmentsInRange(set) == in_set);
+        }
+        CHECK_THROWS_AS(plot_file.getProofFragmentsInRange(params.get_chaining_set_range(4096)),
+            std::out_of_range);
+
+        // a plan with a repeated set, two sets of one block, neighbouring blocks and a whole chunk
+        std::vector<Range> const ranges = { params.get_chaining_set_range(17),
+            params.get_chaining_set_range(3000),
+            params.get_chaining_set_range(17),
+            params.get_chaining_set_range(18),
+            params.get_chaining_set_range(32),
+            range };
+        std::vector<std::vector<ProofFragment>> const planned
+            = plot_file.getProofFragmentsInRanges(ranges);
+        ENSURE(planned.size() == ranges.size());
+        for (size_t i = 0; i < ranges.size(); ++i)
+            ENSURE(planned[i] == plot_file.getProofFragmentsInRange(ranges[i]));
+
+        // a plan of more blocks than are read at a time
+        std::vector<Range> spread;
+        for (size_t i = 0; i < 3 * PlotFile::MAX_CONCURRENT_READS; ++i)
+            spread.push_back(params.get_chaining_set_range(16 * i + i % 16));
+        std::vector<std::vector<ProofFragment>> const spread_planned
+            = plot_file.getProofFragmentsInRanges(spread);
+        ENSURE(spread_planned.size() == spread.size());
+        for (size_t i = 0; i < spread.size(); ++i)
+            ENSURE(spread_planned[i] == plot_file.getProofFragmentsInRange(spread[i]));
+
+        // through a chunk cache: the same results, and the second pass is all hits
+        auto cache = std::make_shared<ChunkCache>(size_t(16) << 20);
+        plot_file.setChunkCache(cache);
+        ENSURE(plot_file.getProofFragmentsInRanges(ranges) == planned);
+        ENSURE(cache->stats().misses == 4); // sets 17 and 18 share a block; 17 is read once
+        ENSURE(plot_file.getProofFragmentsInRanges(ranges) == planned);
+        ENSURE(plot_file.readChunk(1) == chunked.proof_fragments_chunks[1]);
+        ENSURE(plot_file.readChunk(1) == chunked.proof_fragments_chunks[1]);
+        ENSURE(cache->stats().hits == 4 + 1);
+        ENSURE(cache->stats().misses == 4 + 1);
+        plot_file.setChunkCache(nullptr);
+        CHECK_THROWS_AS(plot_file.readChunk(4), std::out_of_range);
+        ENSURE(plot_file.getDeltaCodec() == DeltaCodec::Fse);
+
+        // the delta codec is recorded in the header, with fse-shared's table; without a table per
+        // block, fse-shared plots are smaller than fse ones
+        for (DeltaCodec const codec: { DeltaCodec::Rans, DeltaCodec::FseShared }) {
+            std::string const codec_file_name
+                = std::string("plot_read_chunks_") + delta_codec_name(codec) + ".bin";
+            PlotFile::writeData(codec_file_name,
+                chunked,
+                params,
+                0,
+                0,
+                std::array<uint8_t, 32 + 48 + 32>({}),
+                codec);
+            PlotFile codec_plot_file(codec_file_name, method);
+            ENSURE(codec_plot_file.getDeltaCodec() == codec);
+            ENSURE(codec_plot_file.readChunk(2) == chunked.proof_fragments_chunks[2]);
+            ENSURE(codec_plot_file.getProofFragmentsInRanges(ranges) == planned);
+            ENSURE(codec_plot_file.readAllChunkedData().data.proof_fragments_chunks
+                == chunked.proof_fragments_chunks);
+            if (codec == DeltaCodec::FseShared) {
+                ENSURE(std::filesystem::file_size(codec_file_name)
+                    < std::filesystem::file_size(file_name));
+            }
+            std::filesystem::remove(codec_file_name);
+        }
+
+        // a chunk cut short by a truncated file is an error, not a read past the end
+        std::filesystem::resize_file(file_name, std::filesystem::file_size(file_name) - 16);
+        PlotFile truncated(file_name, method);
+        ENSURE(truncated.readChunk(0) == chunked.proof_fragments_chunks[0]);
+        CHECK_THROWS_AS(truncated.readChunk(3), std::runtime_error);
+
+        // chunk offsets that do not fit the file are rejected when it is opened
+        PlotFile::writeData(
+            file_name, chunked, params, 0, 0, std::array<uint8_t, 32 + 48 + 32>({}));
+        {
+            // magic, version, plot id, k, strength, index, meta group, memo, seek bits, codec
+            std::streamoff const num_chunks_at = 4 + 1 + 32 + 1 + 1 + 2 + 1 + 1 + 112 + 1 + 1;
+            uint64_t const past_end = std::filesystem::file_size(file_name);
+            std::fstream f(file_name, std::ios::binary | std::ios::in | std::ios::out);
+            f.seekp(num_chunks_at + 8 + 2 * 8);
+            f.write(reinterpret_cast<char const*>(&past_end), sizeof(past_end));
+        }
+        CHECK_THROWS_AS(PlotFile(file_name, method).getNumChunks(), std::runtime_error);
+
+        // a plot replaced under its name is still read as it was when opened
+        PlotFile::writeData(
+            file_name, chunked, params, 0, 0, std::array<uint8_t, 32 + 48 + 32>({}));
+        PlotFile opened(file_name, method);
+        ENSURE(opened.getNumChunks() == 4);
+        ChunkedProofFragments replacement;
+        replacement.proof_fragments_chunks.push_back(chunked.proof_fragments_chunks[0]);
+        PlotFile::writeData(file_name + ".new",
+            replacement,
+            params,
+            0,
+            0,
+            std::array<uint8_t, 32 + 48 + 32>({}));
+        std::filesystem::rename(file_name + ".new", file_name);
+        ENSURE(opened.readChunk(3) == chunked.proof_fragments_chunks[3]);
+        ENSURE(opened.getProofFragmentsInRange(range) == expected);
+        std::filesystem::remove(file_name);
+    }
+}
+
+TEST_CASE("plot-read-old-versions")
+{
+    ProofParams const params = plot_fixture_params();
+    ChunkedProofFragments const chunked = plot_fixture_chunks();
+    std::vector<ProofFragment> flat;
+    for (auto const& chunk: chunked.proof_fragments_chunks)
+        flat.insert(flat.end(), chunk.begin(), chunk.end());
+    // sets with fragments in both chunks, and empty ones past the filled part
+    std::vector<Range> ranges;
+    for (size_t set_index: { 0, 1, 33, 63, 64, 1024, 1050, 2047 })
+        ranges.push_back(params.get_chaining_set_range(set_index));
+
+    for (std::span<uint8_t const> const bytes:
+        { std::span<uint8_t const>(plot_fixture_v1), std::span<uint8_t const>(plot_fixture_v2) }) {
+        std::string const file_name = "plot_read_old_version.bin";
+        {
+            std::ofstream out(file_name, std::ios::binary);
+            out.write(reinterpret_cast<char const*>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+        }
+        for (PlotFile::ReadMethod const method:
+            { PlotFile::ReadMethod::Stream, PlotFile::ReadMethod::Mapped }) {
+            PlotFile plot_file(file_name, method);
+            ENSURE(plot_file.getProofParams() == params);
+            ENSURE(plot_file.getDeltaCodec() == DeltaCodec::Fse);
+            ENSURE(plot_file.getNumChunks() == chunked.proof_fragments_chunks.size());
+            for (uint64_t c = 0; c < chunked.proof_fragments_chunks.size(); ++c)
+                ENSURE(plot_file.readChunk(c) == chunked.proof_fragments_chunks[c]);
+            ENSURE(plot_file.readAllProofFragments() == flat);
+
+            std::vector<std::vector<ProofFragment>> const planned
+                = plot_file.getProofFragmentsInRanges(ranges);
+            for (size_t i = 0; i < ranges.size(); ++i) {
+                std::vector<ProofFragment> expected;
+                for (ProofFragment const f: flat) {
+                    if (f >= ranges[i].start && f < ranges[i].end)
+                        expected.push_back(f);
+                }
+                ENSURE(plot_file.getProofFragmentsInRange(ranges[i]) == expected);
+                ENSURE(planned[i] == expected);
+            }
+            ENSURE(!planned[0].empty());
+            ENSURE(!planned[5].empty());
+            ENSURE(planned[4].empty());
+        }
+        std::filesystem::remove(file_name);
+    }
+}
+
+TEST_CASE("chunk-cache")
+{
+    auto fragments = [](size_t n, ProofFragment first) {
+        std::vector<ProofFragment> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = first + i;
+        return std::make_shared<std::vector<ProofFragment> const>(std::move(v));
+    };
+    auto key = [](uint8_t plot, uint64_t chunk, uint32_t block = ChunkCache::kWholeChunk) {
+        ChunkCache::Key k { .chunk = chunk, .block = block };
+        k.plot_id[0] = plot;
+        return k;
+    };
+
+    ChunkCache cache(3 * 100 * sizeof(ProofFragment));
+    cache.insert(key(1, 0), fragments(100, 0));
+    cache.insert(key(1, 1), fragments(100, 100));
+    cache.insert(key(2, 0), fragments(100, 200));
+    ENSURE(cache.find(key(1, 0))->front() == 0); // now the most recently used
+    ENSURE(cache.find(key(1, 0, 3)) == nullptr); // a block is not its chunk
+
+    cache.insert(key(2, 1), fragments(100, 300)); // evicts (1, 1)
+    ENSURE(cache.find(key(1, 1)) == nullptr);
+    ENSURE(cache.find(key(2, 0))->front() == 200);
+    ENSURE(cache.find(key(2, 1))->front() == 300);
+
+    cache.insert(key(3, 0), fragments(1000, 0)); // larger than the cache: not kept
+    ENSURE(cache.find(key(3, 0)) == nullptr);
+
+    ChunkCache::Stats const stats = cache.stats();
+    ENSURE(stats.entries == 3);
+    ENSURE(stats.bytes == 3 * 100 * sizeof(ProofFragment));
+    ENSURE(stats.hits == 3);
+    ENSURE(stats.misses == 3);
+    ENSURE(stats.evictions == 1);
+    ENSURE(stats.hit_rate() == 0.5);
+
+    cache.clear();
+    ENSURE(cache.stats().entries == 0);
+    ENSURE(cache.stats().bytes == 0);
 }
 
 TEST_SUITE_END();
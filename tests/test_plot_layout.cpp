@@ -0,0 +1,217 @@
+#include <random>
+
+#include "common/Utils.hpp"
+#include "plot/PlotLayout.hpp"
+#include "plot/Plotter.hpp"
+#include "test_util.h"
+
+TEST_SUITE_BEGIN("plot-layout");
+
+TEST_CASE("liveness-solver")
+{
+    LivenessLayoutSolver solver(64);
+    std::size_t const a = solver.add("a", 1000, 0, 1);
+    std::size_t const b = solver.add("b", 500, 1, 2);
+    std::size_t const c = solver.add("c", 800, 2, 3); // disjoint from a, can reuse its bytes
+    std::size_t const total = solver.solve();
+
+    ENSURE(solver.valid());
+    ENSURE(total == solver.lower_bound_bytes());
+    ENSURE(solver.buffer(a).offset % 64 == 0);
+    ENSURE(solver.buffer(b).offset >= solver.buffer(a).end());
+    ENSURE(solver.buffer(c).offset == 0);
+}
+
+TEST_CASE("planned-layouts")
+{
+    auto const plot_id
+        = Utils::hexToBytes("c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835");
+
+    for (int k: { 18, 20, 22, 28, 30, 32 }) {
+        ProofParams params(plot_id.data(), static_cast<uint8_t>(k), 2, 0);
+        PlotLayout::Plan const plan = PlotLayout::plan(params);
+        std::size_t const msp = max_pairs_per_section_possible(params);
+        std::size_t const block = PlotLayout::block_bytes(msp,
+            std::max({ sizeof(Xs_Candidate), sizeof(T1Pairing), sizeof(T2Pairing),
+                sizeof(T3Pairing) }));
+        std::size_t const blocks = (plan.planned_bytes + block - 1) / block;
+
+        printfln("k%d: %zu bytes (lower bound %zu), %zu blocks, l_chunks %u/%u/%u", k,
+            plan.planned_bytes, plan.lower_bound_bytes, blocks, plan.tables[1].l_chunks,
+            plan.tables[2].l_chunks, plan.tables[3].l_chunks);
+        ENSURE(plan.solver.valid());
+        ENSURE(plan.planned_bytes >= plan.lower_bound_bytes);
+
+        // Each sorted table must survive until the next table has been matched.
+        for (int t = 0; t < 3; ++t) {
+            auto const& cur = plan.tables[static_cast<std::size_t>(t)];
+            auto const& next = plan.tables[static_cast<std::size_t>(t) + 1];
+            std::size_t const out_end = cur.out_offset
+                + msp * static_cast<std::size_t>(params.get_num_sections()) * cur.element_bytes;
+            ENSURE((next.target_offset >= out_end
+                || next.target_offset + next.target_bytes <= cur.out_offset));
+        }
+
+        // The previous hand layout used 32 blocks; the planner must not be worse where it fit.
+        if (params.get_num_sections() == 4)
+            ENSURE(blocks <= 32);
+    }
+}
+
+namespace {
+// Records joined (meta_l, meta_r) pairs instead of pairing them.
+struct JoinRecorder : TableConstructorGeneric<T2Pairing, T3Pairing, T3Pairing> {
+    using TableConstructorGeneric::TableConstructorGeneric;
+
+    std::vector<std::pair<uint64_t, uint64_t>> joined;
+
+    void handle_pair_into(T2Pairing const& l, T2Pairing const& r, std::span<T3Pairing>,
+        std::atomic<std::size_t>&) override
+    {
+        joined.emplace_back(l.meta, r.meta);
+    }
+};
+} // namespace
+
+TEST_CASE("l-targets-by-index")
+{
+    ENSURE(!Table1Constructor::kSortsLByIndex);
+    ENSURE(Table2Constructor::kSortsLByIndex);
+    ENSURE(Table3Constructor::kSortsLByIndex);
+    ENSURE(PlotLayout::l_target_bytes(3) == sizeof(LTargetIndex));
+
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        18, 2, 0);
+    ResettableArenaResource target, minor;
+    JoinRecorder full(3, params, target, minor), indexed(3, params, target, minor);
+
+    // Small key range so most keys have several L and R entries.
+    std::mt19937_64 rng(31);
+    auto make = [&](std::size_t n) {
+        std::vector<T2Pairing> v(n);
+        for (auto& e: v)
+            e = T2Pairing {
+                .meta = rng(), .match_info = static_cast<uint32_t>(rng() % 97), .x_bits = 0 };
+        return v;
+    };
+    std::vector<T2Pairing> l = make(1000), r = make(800);
+    std::vector<LTargetIndex> l_index(l.size());
+    for (std::size_t i = 0; i < l.size(); ++i)
+        l_index[i] = LTargetIndex { l[i].match_info, static_cast<uint32_t>(i) };
+
+    auto by_key = [](auto const& a, auto const& b) { return a.match_info < b.match_info; };
+    std::vector<T2Pairing> l_sorted = l;
+    std::stable_sort(l_sorted.begin(), l_sorted.end(), by_key);
+    std::stable_sort(l_index.begin(), l_index.end(), by_key);
+    std::stable_sort(r.begin(), r.end(), by_key);
+
+    std::atomic<std::size_t> count { 0 };
+    full.find_pairs_into(std::span<T2Pairing const>(l_sorted), r, {}, count);
+    indexed.find_pairs_into(std::span<LTargetIndex const>(l_index), l, r, {}, count);
+
+    ENSURE(!full.joined.empty());
+    std::sort(full.joined.begin(), full.joined.end());
+    std::sort(indexed.joined.begin(), indexed.joined.end());
+    ENSURE(full.joined == indexed.joined);
+}
+
+TEST_CASE("planned-plot-k18")
+{
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        18, 2, 0);
+    Plotter plotter(params);
+    PlotData plot = plotter.run(Plotter::Options {});
+    ENSURE(!plot.t3_proof_fragments.empty());
+}
+
+TEST_CASE("hash-join-matches-sort-merge")
+{
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        18, 2, 0);
+    Plotter plotter(params);
+    PlotData const sort_merge = plotter.run(Plotter::Options {});
+
+    Plotter::Options opts;
+    opts.pair_join = PairJoin::HashJoin;
+    PlotData const hash_join = plotter.run(opts);
+    ENSURE(hash_join == sort_merge);
+
+    // Also with chunked L sections in a streaming run.
+    opts.ram_budget_bytes = plotter.plan_memory(opts).min_peak_bytes;
+    ENSURE(plotter.run(opts) == sort_merge);
+}
+
+TEST_CASE("wavefront-matches-eager-sort")
+{
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        18, 2, 0);
+    Plotter plotter(params);
+    PlotData const eager = plotter.run(Plotter::Options {});
+
+    Plotter::Options opts;
+    opts.wavefront = true;
+    ENSURE(plotter.run(opts) == eager);
+    opts.pair_join = PairJoin::HashJoin;
+    ENSURE(plotter.run(opts) == eager);
+}
+
+TEST_CASE("plot-report")
+{
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        18, 2, 0);
+    Plotter plotter(params);
+    PlotData const plain = plotter.run(Plotter::Options {});
+
+    struct ReportNoteSink final : IProgressSink {
+        std::string json;
+        bool on_event(ProgressEvent const& e) noexcept override
+        {
+            if (e.kind == EventKind::Note && e.note_id == NoteId::PlotReport)
+                json = e.msg;
+            return true;
+        }
+    } sink;
+    PlotReport report;
+    Plotter::Options opts;
+    opts.sink = &sink;
+    opts.report = &report;
+    ENSURE(plotter.run(opts) == plain);
+
+    ENSURE(report.k == 18);
+    ENSURE(report.wall_ms > 0.0);
+    ENSURE(report.cpu_ms > 0.0);
+    ENSURE(report.allocated_bytes > 0);
+    ENSURE(report.tables[0].pairs_produced == (uint64_t(1) << 18));
+    for (int t = 1; t <= 3; ++t) {
+        PlotReport::Table const& table = report.tables[t];
+        ENSURE(table.passes == 1);
+        ENSURE(table.items_in == report.tables[t - 1].pairs_produced);
+        ENSURE(table.pairs_produced > 0);
+        ENSURE(table.pairs_produced <= table.capacity);
+        ENSURE(table.match_keys > 0);
+        ENSURE(table.match_key_max_ms >= table.match_key_min_ms);
+        ENSURE(table.target_scratch_peak_bytes > 0);
+    }
+    ENSURE(report.tables[3].pairs_produced == plain.t3_proof_fragments.size());
+    ENSURE(sink.json == report.to_json());
+    ENSURE(sink.json.front() == '{');
+
+    // A streaming run reports its output passes.
+    opts.ram_budget_bytes = plotter.plan_memory(opts).min_peak_bytes;
+    ENSURE(plotter.run(opts) == plain);
+    ENSURE(report.streaming);
+    ENSURE(report.tables[3].passes == plotter.plan_memory(opts).tables[3].output_passes);
+    ENSURE(report.tables[3].pairs_produced == plain.t3_proof_fragments.size());
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+
+#include "common/Utils.hpp"
+#include "plot/PlotMemoryPlan.hpp"
+#include "plot/Plotter.hpp"
+#include "test_util.h"
+
+// Every heap allocation of this test binary goes through a counter, so the peak a plotting run
+// really reaches can be checked against its memory plan.
+namespace {
+std::atomic<std::size_t> heap_live_bytes { 0 };
+std::atomic<std::size_t> heap_peak_bytes { 0 };
+
+// Stored just in front of each allocation.
+struct AllocHeader {
+    void* raw;
+    std::size_t bytes;
+};
+
+void* counted_alloc(std::size_t bytes, std::size_t align)
+{
+    align = std::max(align, alignof(std::max_align_t));
+    void* const raw = std::malloc(bytes + align + sizeof(AllocHeader));
+    if (raw == nullptr)
+        throw std::bad_alloc();
+    std::uintptr_t const first = reinterpret_cast<std::uintptr_t>(raw) + sizeof(AllocHeader);
+    void* const p = reinterpret_cast<void*>((first + align - 1) & ~(std::uintptr_t(align) - 1));
+    static_cast<AllocHeader*>(p)[-1] = AllocHeader { raw, bytes };
+
+    std::size_t const live = heap_live_bytes.fetch_add(bytes) + bytes;
+    std::size_t peak = heap_peak_bytes.load();
+    while (live > peak && !heap_peak_bytes.compare_exchange_weak(peak, live)) { }
+    return p;
+}
+
+void counted_free(void* p) noexcept
+{
+    if (p == nullptr)
+        return;
+    AllocHeader const header = static_cast<AllocHeader*>(p)[-1];
+    heap_live_bytes.fetch_sub(header.bytes);
+    std::free(header.raw);
+}
+
+// Heap peak of fn() above what was live when it started.
+template <typename Fn>
+std::size_t measure_heap_peak(Fn&& fn)
+{
+    std::size_t const base = heap_live_bytes.load();
+    heap_peak_bytes.store(base);
+    fn();
+    return heap_peak_bytes.load() - base;
+}
+}
+
+void* operator new(std::size_t bytes) { return counted_alloc(bytes, 0); }
+void* operator new[](std::size_t bytes) { return counted_alloc(bytes, 0); }
+void* operator new(std::size_t bytes, std::align_val_t al)
+{
+    return counted_alloc(bytes, static_cast<std::size_t>(al));
+}
+void* operator new[](std::size_t bytes, std::align_val_t al)
+{
+    return counted_alloc(bytes, static_cast<std::size_t>(al));
+}
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, std::size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::size_t) noexcept { counted_free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { counted_free(p); }
+
+TEST_SUITE_BEGIN("plot-memory-budget");
+
+TEST_CASE("budgeted-plot-matches-default")
+{
+    constexpr int K = 18;
+    constexpr int strength = 2;
+    ProofParams params(Utils::hexToBytes(
+                           "c6b84729c23dc6d60c92f22c17083f47845c1179227c5509f07a5d2804a7b835")
+                           .data(),
+        K, strength, 0);
+    Plotter plotter(params);
+
+    Plotter::Options opts;
+    PlotMemoryPlan const default_plan = plotter.plan_memory(opts);
+    ENSURE(!default_plan.streaming);
+    ENSURE(default_plan.feasible);
+    ENSURE(default_plan.total_passes() == 3);
+    ENSURE(default_plan.min_peak_bytes < default_plan.default_peak_bytes);
+
+    PlotData reference = plotter.run(opts);
+
+    // Spills go to their own directory here, which must be empty again after each run.
+    std::filesystem::path const spill_dir
+        = std::filesystem::temp_directory_path() / "plot_memory_budget_spills";
+    std::filesystem::remove_all(spill_dir);
+    std::filesystem::create_directories(spill_dir);
+    opts.spill_dir = spill_dir.string();
+
+    // Tightest budget and one in between, both must reproduce the default plot.
+    std::size_t const budgets[] = { default_plan.min_peak_bytes,
+        (default_plan.min_peak_bytes + default_plan.default_peak_bytes) / 2 };
+    for (std::size_t budget: budgets) {
+        opts.ram_budget_bytes = budget;
+        PlotMemoryPlan const plan = plotter.plan_memory(opts);
+        ENSURE(plan.streaming);
+        ENSURE(plan.feasible);
+        ENSURE(plan.peak_bytes <= budget);
+        printfln("budget %zu: peak %zu bytes, %u passes (T1 %u/%u, T2 %u/%u, T3 %u/%u)",
+            budget, plan.peak_bytes, plan.total_passes(), plan.tables[1].output_passes,
+            plan.tables[1].l_chunks, plan.tables[2].output_passes, plan.tables[2].l_chunks,
+            plan.tables[3].output_passes, plan.tables[3].l_chunks);
+
+        PlotData budgeted;
+        std::size_t const measured = measure_heap_peak([&] { budgeted = plotter.run(opts); });
+        printfln("  measured heap peak %zu bytes", measured);
+        ENSURE(budgeted == reference);
+        ENSURE(measured <= plan.peak_bytes);
+        ENSURE(std::filesystem::is_empty(spill_dir));
+    }
+    std::filesystem::remove_all(spill_dir);
+
+    // Below the minimum the dry run reports it, and run refuses to start.
+    opts.ram_budget_bytes = default_plan.min_peak_bytes - 1;
+    ENSURE(!plotter.plan_memory(opts).feasible);
+    CHECK_THROWS_AS(plotter.run(opts), std::runtime_error);
+}
+
+TEST_SUITE_END();
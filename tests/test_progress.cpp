@@ -0,0 +1,238 @@
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/ParallelForRange.hpp"
+#include "common/PerfCounters.hpp"
+#include "common/Timer.hpp"
+#include "common/thread.hpp"
+#include "plot/AsyncProgressSink.hpp"
+#include "plot/ChromeTraceSink.hpp"
+#include "test_util.h"
+
+TEST_SUITE_BEGIN("progress");
+
+namespace {
+
+// Records what it is given; optionally blocks until released, like a stalled consumer.
+struct RecordingSink final : IProgressSink {
+    std::mutex mutex;
+    std::vector<ProgressEvent> events;
+    std::vector<std::string> msgs;
+    std::atomic<bool> blocked { false };
+    bool cancel = false;
+
+    bool on_event(ProgressEvent const& e) noexcept override
+    {
+        while (blocked.load())
+            std::this_thread::yield();
+        std::lock_guard lock(mutex);
+        events.push_back(e);
+        msgs.emplace_back(e.msg ? e.msg : "");
+        return !cancel;
+    }
+};
+
+ProgressEvent match_key_event(uint8_t table_id, uint32_t key)
+{
+    return ProgressEvent { .kind = EventKind::MatchKeyEnd, .table_id = table_id, .match_key = key };
+}
+
+} // namespace
+
+TEST_CASE("async-sink-delivers-in-order")
+{
+    RecordingSink rec;
+    {
+        AsyncProgressSink sink(rec, 64);
+        for (uint32_t i = 0; i < 1000; ++i) {
+            ENSURE(sink.on_event(match_key_event(1, i)));
+            if (i % 50 == 0)
+                sink.flush(); // keep within capacity
+        }
+        std::string msg = "checkpoint path";
+        sink.on_event(ProgressEvent { .kind = EventKind::Note,
+            .note_id = NoteId::CheckpointWritten,
+            .msg = msg.c_str() });
+        msg.assign("overwritten after posting");
+        // longer than the inline buffer
+        std::string const report(3 * AsyncProgressSink::kInlineMsgBytes, 'r');
+        sink.on_event(ProgressEvent {
+            .kind = EventKind::Note, .note_id = NoteId::PlotReport, .msg = report.c_str() });
+    }
+    // destruction delivered the rest
+    ENSURE(rec.events.size() == 1002);
+    for (uint32_t i = 0; i < 1000; ++i)
+        ENSURE(rec.events[i].match_key == i);
+    ENSURE(rec.events[1000].note_id == NoteId::CheckpointWritten);
+    ENSURE(rec.msgs[1000] == "checkpoint path");
+    ENSURE(rec.msgs.back() == std::string(3 * AsyncProgressSink::kInlineMsgBytes, 'r'));
+    ENSURE(rec.msgs.front().empty());
+}
+
+TEST_CASE("async-sink-drops-when-full")
+{
+    RecordingSink rec;
+    rec.blocked = true;
+    AsyncProgressSink sink(rec, 8);
+    ENSURE(sink.capacity() == 8);
+    for (uint32_t i = 0; i < 100; ++i)
+        sink.on_event(match_key_event(2, i));
+    // the consumer may hold one event while blocked
+    ENSURE(sink.dropped() >= 100 - sink.capacity() - 1);
+    ENSURE(sink.dropped() <= 100 - sink.capacity());
+
+    rec.blocked = false;
+    sink.flush();
+    ENSURE(rec.events.size() + sink.dropped() == 100);
+    for (std::size_t i = 1; i < rec.events.size(); ++i)
+        ENSURE(rec.events[i - 1].match_key < rec.events[i].match_key);
+}
+
+TEST_CASE("async-sink-many-producers")
+{
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kPerThread = 5000;
+    RecordingSink rec;
+    AsyncProgressSink sink(rec, 1 << 16);
+    {
+        std::vector<thread> producers;
+        for (uint32_t t = 0; t < kThreads; ++t) {
+            producers.emplace_back([&sink, t]() {
+                for (uint32_t i = 0; i < kPerThread; ++i)
+                    sink.on_event(match_key_event(static_cast<uint8_t>(t), i));
+            });
+        }
+    }
+    sink.flush();
+    ENSURE(sink.dropped() == 0);
+    ENSURE(rec.events.size() == kThreads * kPerThread);
+
+    // each producer's events arrive in its posting order
+    std::vector<int64_t> last(kThreads, -1);
+    for (ProgressEvent const& e: rec.events) {
+        ENSURE(int64_t(e.match_key) == last[e.table_id] + 1);
+        last[e.table_id] = e.match_key;
+    }
+}
+
+TEST_CASE("async-sink-forwards-cancel")
+{
+    RecordingSink rec;
+    rec.cancel = true;
+    AsyncProgressSink sink(rec);
+    sink.on_event(ProgressEvent { .kind = EventKind::PlotBegin });
+    sink.flush();
+    ENSURE(!sink.on_event(ProgressEvent { .kind = EventKind::PlotEnd }));
+}
+
+TEST_CASE("chrome-trace-sink")
+{
+    TraceRecorder trace;
+    RecordingSink rec;
+    ChromeTraceSink sink(trace, rec);
+
+    // nothing is recorded while no trace is active
+    parallel_for_range(0, 4, [](int) {}, 2);
+    ENSURE(trace.size() == 0);
+    {
+        ScopedTraceRecording recording(trace);
+        ScopedEvent table(sink,
+            ProgressEvent { .kind = EventKind::TableBegin, .table_id = 2, .num_items_in = 7 });
+        {
+            ScopedEvent key(sink,
+                ProgressEvent { .kind = EventKind::MatchKeyBegin, .table_id = 2, .match_key = 5 });
+            Timer timer;
+            timer.start("Finding \"pairs\"");
+            parallel_for_range(0, 4, [](int) {}, 2);
+            timer.stop();
+        }
+        std::string const path = "out/dir";
+        sink.on_event(ProgressEvent { .kind = EventKind::Note,
+            .note_id = NoteId::CheckpointWritten,
+            .msg = path.c_str() });
+    }
+    std::string const json = trace.to_json();
+
+    ENSURE(rec.events.size() == 5); // all forwarded
+    ENSURE(trace.size() == 6); // key, 2 workers, timer phase, note, table
+    ENSURE(json.find("\"traceEvents\"") != std::string::npos);
+    ENSURE(json.find("\"name\":\"T2 key 5\"") != std::string::npos);
+    ENSURE(json.find("\"name\":\"table 2\"") != std::string::npos);
+    ENSURE(json.find("\"items_in\":7") != std::string::npos);
+    ENSURE(json.find("\"name\":\"Finding \\\"pairs\\\"\"") != std::string::npos);
+    ENSURE(json.find("\"name\":\"worker 0\"") != std::string::npos);
+    ENSURE(json.find("\"msg\":\"out/dir\"") != std::string::npos);
+    ENSURE(json.find("\"ph\":\"i\"") != std::string::npos);
+}
+
+TEST_CASE("trace-concurrent-loops-get-own-lanes")
+{
+    TraceRecorder trace;
+    {
+        ScopedTraceRecording recording(trace);
+        // two loops of two workers each, all four alive at once
+        std::latch all_running(4);
+        auto const loop = [&] {
+            parallel_for_range(0, 2, [&](int) { all_running.arrive_and_wait(); }, 2);
+        };
+        thread a(loop);
+        thread b(loop);
+    }
+    std::string const json = trace.to_json();
+
+    ENSURE(trace.size() == 4);
+    for (int worker = 0; worker < 4; ++worker)
+        ENSURE(json.find("\"name\":\"worker " + std::to_string(worker) + "\"")
+            != std::string::npos);
+}
+
+TEST_CASE("perf-counter-values")
+{
+    PerfCounterValues const start { 100, 150, 10, 5, true };
+    PerfCounterValues const end { 300, 550, 14, 5, true };
+    PerfCounterValues const delta = end.since(start);
+    ENSURE(delta.valid);
+    ENSURE(delta.cycles == 200);
+    ENSURE(delta.instructions == 400);
+    ENSURE(delta.ipc() == 2.0);
+    ENSURE(delta.llc_miss_bytes() == 4 * 64);
+    ENSURE(delta.dtlb_misses == 0);
+    ENSURE(!end.since(PerfCounterValues {}).valid);
+
+    PerfCounterValues sum;
+    sum += PerfCounterValues {}; // invalid values do not count
+    ENSURE(!sum.valid);
+    sum += delta;
+    sum += delta;
+    ENSURE(sum.valid);
+    ENSURE(sum.instructions == 800);
+    ENSURE(sum.json_fields().find("\"ipc\":2.0") != std::string::npos);
+    ENSURE(PerfCounterValues {}.json_fields().empty());
+}
+
+TEST_CASE("perf-counters-in-timer")
+{
+    Timer timer;
+    timer.start("phase");
+    timer.stop();
+    ENSURE(!timer.counters().valid); // no session
+
+    PerfCounterSession session;
+    ENSURE((active_perf_counters() == (session.available() ? &session : nullptr)));
+    std::atomic<uint64_t> sum { 0 };
+    timer.start("phase");
+    parallel_for_range(0, 2, [&](int i) {
+        for (uint64_t j = 0; j < 100000; ++j)
+            sum.fetch_add(j * i, std::memory_order_relaxed);
+    });
+    timer.stop();
+    ENSURE(timer.counters().valid == session.available());
+    if (session.available())
+        ENSURE(timer.counters().cycles + timer.counters().instructions > 0);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,180 @@
+#include "plot/RadixSort.hpp"
+#include "plot/TableConstructorGeneric.hpp"
+#include "test_util.h"
+
+#include <random>
+
+TEST_SUITE_BEGIN("radix-sort");
+
+namespace {
+
+template <typename T, typename KeyType, typename KeyExtractor>
+void check_sort(std::size_t n, int num_bits, std::size_t misalign, KeyExtractor key, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    KeyType const mask = num_bits >= static_cast<int>(sizeof(KeyType) * 8)
+        ? ~KeyType(0)
+        : static_cast<KeyType>((KeyType(1) << num_bits) - 1);
+
+    // Offset both spans from the allocation start to exercise unaligned staging slots.
+    std::vector<T> data_storage(n + misalign), buffer_storage(n + misalign);
+    std::span<T> data(data_storage.data() + misalign, n);
+    std::span<T> buffer(buffer_storage.data() + misalign, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        // Tag the input order at both ends of the element; the key overwrites at most one.
+        T e {};
+        uint32_t const tag = static_cast<uint32_t>(i);
+        std::memcpy(&e, &tag, sizeof(tag));
+        std::memcpy(reinterpret_cast<std::byte*>(&e) + sizeof(T) - sizeof(tag), &tag, sizeof(tag));
+        e.*key = static_cast<KeyType>(rng() & mask);
+        data[i] = e;
+    }
+
+    std::vector<T> expected(data.begin(), data.end());
+    std::stable_sort(expected.begin(), expected.end(),
+        [key](T const& a, T const& b) { return a.*key < b.*key; });
+
+    std::pmr::monotonic_buffer_resource mr;
+    RadixSort<T, KeyType, KeyExtractor> sorter(key);
+    std::span<T> sorted = sorter.sort(data, buffer, num_bits, &mr);
+
+    using Sorter = RadixSort<T, KeyType, KeyExtractor>;
+    ENSURE(sorted.size() == n);
+    ENSURE(sorted.data() == (Sorter::result_in_buffer(num_bits) ? buffer.data() : data.data()));
+    ENSURE(std::memcmp(sorted.data(), expected.data(), n * sizeof(T)) == 0);
+}
+
+template <typename T, typename KeyType, typename KeyExtractor>
+void check_sort_in_place(
+    std::size_t n, int num_bits, std::size_t threads, KeyExtractor key, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    KeyType const mask = num_bits >= static_cast<int>(sizeof(KeyType) * 8)
+        ? ~KeyType(0)
+        : static_cast<KeyType>((KeyType(1) << num_bits) - 1);
+
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        T e {};
+        uint32_t const tag = static_cast<uint32_t>(i);
+        std::memcpy(&e, &tag, sizeof(tag));
+        std::memcpy(reinterpret_cast<std::byte*>(&e) + sizeof(T) - sizeof(tag), &tag, sizeof(tag));
+        e.*key = static_cast<KeyType>(rng() & mask);
+        data[i] = e;
+    }
+    std::vector<T> input = data;
+
+    std::pmr::monotonic_buffer_resource mr;
+    RadixSort<T, KeyType, KeyExtractor> sorter(key);
+    sorter.setMaxThreads(threads);
+    std::span<T> sorted = sorter.sort_in_place(data, num_bits, &mr);
+    ENSURE(sorted.data() == data.data());
+    ENSURE(sorted.size() == n);
+
+    // Keys ascend, and the elements are a permutation of the input (order of equal keys is free).
+    ENSURE(std::is_sorted(
+        data.begin(), data.end(), [key](T const& a, T const& b) { return a.*key < b.*key; }));
+    auto const bytes_less
+        = [](T const& a, T const& b) { return std::memcmp(&a, &b, sizeof(T)) < 0; };
+    std::sort(data.begin(), data.end(), bytes_less);
+    std::sort(input.begin(), input.end(), bytes_less);
+    ENSURE(std::memcmp(data.data(), input.data(), n * sizeof(T)) == 0);
+}
+
+} // namespace
+
+TEST_CASE("matches-stable-sort")
+{
+    struct Case {
+        std::size_t n;
+        int bits;
+    };
+    // Small sorts, bucket-local insertion sorts, staged scatters and streaming-sized inputs.
+    Case const cases[] = { { 0, 18 }, { 1, 18 }, { 1000, 14 }, { 100000, 18 }, { 1 << 20, 22 },
+        { 1 << 21, 16 } };
+
+    uint64_t seed = 1;
+    for (Case const& c: cases) {
+        for (std::size_t misalign: { 0, 1 }) {
+            check_sort<Xs_Candidate, uint32_t>(
+                c.n, c.bits, misalign, &Xs_Candidate::match_info, seed++);
+            check_sort<T1Pairing, uint32_t>(c.n, c.bits, misalign, &T1Pairing::match_info, seed++);
+            check_sort<T2Pairing, uint32_t>(c.n, c.bits, misalign, &T2Pairing::match_info, seed++);
+            check_sort<T3Pairing, uint64_t>(
+                c.n, 2 * c.bits, misalign, &T3Pairing::proof_fragment, seed++);
+        }
+    }
+}
+
+TEST_CASE("in-place")
+{
+    struct Case {
+        std::size_t n;
+        int bits;
+    };
+    // Insertion-sort buckets, cache-resident finishes, American flag recursion and, with several
+    // threads, the parallel PARADIS permutation of the top digit.
+    Case const cases[] = { { 0, 18 }, { 1, 18 }, { 1000, 14 }, { 100000, 18 }, { 1 << 20, 22 },
+        { 1 << 20, 8 } };
+
+    uint64_t seed = 100;
+    for (Case const& c: cases) {
+        for (std::size_t threads: { 1, 4 }) {
+            check_sort_in_place<Xs_Candidate, uint32_t>(
+                c.n, c.bits, threads, &Xs_Candidate::match_info, seed++);
+            check_sort_in_place<T1Pairing, uint32_t>(
+                c.n, c.bits, threads, &T1Pairing::match_info, seed++);
+            check_sort_in_place<T2Pairing, uint32_t>(
+                c.n, c.bits, threads, &T2Pairing::match_info, seed++);
+            check_sort_in_place<T3Pairing, uint64_t>(
+                c.n, 2 * c.bits, threads, &T3Pairing::proof_fragment, seed++);
+        }
+    }
+}
+
+TEST_CASE("partition-then-finish")
+{
+    // Buckets finished in any order and in several calls give the sort_in_place result; the
+    // wavefront finishes them section by section.
+    for (std::size_t threads: { 1, 4 }) {
+        std::mt19937_64 rng(7 + threads);
+        std::vector<T1Pairing> data(1 << 18);
+        for (auto& e: data) {
+            e = T1Pairing {
+                .meta_lo = uint32_t(rng()), .meta_hi = 0, .match_info = uint32_t(rng()) & 0xFFFFFu
+            };
+        }
+        auto const key
+            = [](T1Pairing const& a, T1Pairing const& b) { return a.match_info < b.match_info; };
+        std::vector<T1Pairing> expected = data;
+        std::stable_sort(expected.begin(), expected.end(), key);
+
+        std::pmr::monotonic_buffer_resource mr;
+        RadixSort<T1Pairing, uint32_t> sorter;
+        sorter.setMaxThreads(threads);
+
+        auto const buckets = sorter.partition_in_place(data, 20, &mr);
+        ENSURE(buckets.size() == (std::size_t(1) << buckets.bits));
+        ENSURE(buckets.start.back() == data.size());
+        std::size_t const half = buckets.size() / 2;
+        sorter.finish_in_place(data, 20, buckets, half, buckets.size());
+        sorter.finish_in_place(data, 20, buckets, 0, half);
+
+        ENSURE(std::is_sorted(data.begin(), data.end(), key));
+        for (std::size_t i = 0; i < data.size(); ++i)
+            ENSURE(data[i].match_info == expected[i].match_info);
+    }
+}
+
+TEST_CASE("pass-counts")
+{
+    // 8- and 16-byte elements tile a cache line and use 11-bit digits, 12-byte ones 10 bits.
+    ENSURE((RadixSort<Xs_Candidate, uint32_t>::kRadixBits == 11));
+    ENSURE((RadixSort<T2Pairing, uint32_t>::kRadixBits == 11));
+    ENSURE((RadixSort<T1Pairing, uint32_t>::kRadixBits == 10));
+    ENSURE((RadixSort<Xs_Candidate, uint32_t>::num_passes(22) == 2));
+    ENSURE((RadixSort<T1Pairing, uint32_t>::num_passes(22) == 3));
+    ENSURE((RadixSort<Xs_Candidate, uint32_t>::num_passes(28) == 3));
+}
+
+TEST_SUITE_END();
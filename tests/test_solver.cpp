@@ -1,3 +1,6 @@
+#include <sstream>
+#include <string>
+
 #include "common/Utils.hpp"
 #include "plot/PlotFile.hpp"
 #include "pos/ProofFragment.hpp"
@@ -206,3 +209,21 @@ TEST_CASE("solve-partial")
         }
     }
 }
+
+TEST_CASE("solver-summary-counters")
+{
+    ProofSolverTimings timings;
+    std::ostringstream none;
+    timings.printCounters(none);
+    ENSURE(none.str().empty()); // not counted
+
+    timings.hashing_x1s_counters += PerfCounterValues { 4000000, 8000000, 12, 3, true };
+    timings.misc_counters += PerfCounterValues { 1000000, 1000000, 5, 1, true };
+    std::ostringstream os;
+    timings.printCounters(os);
+    std::string const out = os.str();
+    ENSURE(out.find("Hashing x1's") != std::string::npos);
+    ENSURE(out.find("2.00") != std::string::npos); // hashing IPC
+    ENSURE(out.find("5.00") != std::string::npos); // total Mcycles
+    ENSURE(out.find("17") != std::string::npos); // total LLC misses
+}
@@ -0,0 +1,106 @@
+#include "test_util.h"
+
+#include "common/SortedIntersect.hpp"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+TEST_SUITE_BEGIN("sorted-intersect");
+
+namespace {
+using Pairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+// Every (a index, b index) pair with equal keys.
+Pairs naive_join(SortedKeys const& a, SortedKeys const& b)
+{
+    Pairs out;
+    for (std::size_t i = 0; i < a.size; ++i)
+        for (std::size_t j = 0; j < b.size; ++j)
+            if (a[i] == b[j])
+                out.emplace_back(i, j);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+template <typename Intersect>
+Pairs run(Intersect intersect, SortedKeys const& a, SortedKeys const& b)
+{
+    Pairs out;
+    intersect(a, b, [&](std::size_t a_begin, std::size_t a_end, std::size_t j) {
+        for (std::size_t i = a_begin; i < a_end; ++i)
+            out.emplace_back(i, j);
+    });
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+struct Entry {
+    uint64_t payload;
+    uint32_t match_info;
+    uint32_t other;
+};
+} // namespace
+
+TEST_CASE("matches-naive-join")
+{
+    std::mt19937 rng(33);
+    // Key ranges: dense duplicates, sparse, and near the top of the unsigned range.
+    std::tuple<uint32_t, uint32_t> const ranges[]
+        = { { 0, 50 }, { 0, 5000 }, { 0xFFFFFF00u, 0xFFFFFFFFu } };
+
+    printfln("avx2 kernel: %s", intersect_sorted_uses_avx2() ? "yes" : "no");
+    for (auto [lo, hi]: ranges) {
+        // b both of similar length (branchless merge) and much shorter (block skips on a)
+        for (auto [n, b_size]: { std::pair<std::size_t, std::size_t> { 0, 3 }, { 1, 3 }, { 9, 7 },
+                 { 300, 153 }, { 2000, 1003 }, { 2000, 40 }, { 5000, 9 } }) {
+            std::uniform_int_distribution<uint32_t> key(lo, hi);
+            std::vector<uint32_t> a(n), b(b_size);
+            for (auto& k: a)
+                k = key(rng);
+            for (auto& k: b)
+                k = key(rng);
+            std::sort(a.begin(), a.end());
+            std::sort(b.begin(), b.end());
+
+            SortedKeys const ka = SortedKeys::of(a), kb = SortedKeys::of(b);
+            auto const expected = naive_join(ka, kb);
+            auto scalar = [](auto const& x, auto const& y, auto&& e) {
+                intersect_sorted_scalar(x, y, e);
+            };
+            auto dispatched = [](auto const& x, auto const& y, auto&& e) {
+                intersect_sorted(x, y, e);
+            };
+            ENSURE(run(scalar, ka, kb) == expected);
+            ENSURE(run(dispatched, ka, kb) == expected);
+            ENSURE(run(dispatched, kb, ka).size() == expected.size());
+        }
+    }
+}
+
+TEST_CASE("strided-masked-keys")
+{
+    // b is sorted by the masked key only, as R candidates are within a match key.
+    std::mt19937 rng(34);
+    uint32_t const mask = 0x3FF;
+    std::vector<Entry> a(1500), b(1200);
+    for (auto& e: a)
+        e = Entry { rng(), static_cast<uint32_t>(rng() & mask), 0 };
+    for (auto& e: b)
+        e = Entry { rng(), static_cast<uint32_t>((rng() & mask) | (3u << 20)), 0 };
+    auto by_key = [](Entry const& x, Entry const& y) { return x.match_info < y.match_info; };
+    std::sort(a.begin(), a.end(), by_key);
+    std::sort(b.begin(), b.end(), by_key);
+
+    SortedKeys const ka = SortedKeys::match_info_of(std::span<Entry const>(a));
+    SortedKeys const kb = SortedKeys::match_info_of(std::span<Entry const>(b), mask);
+    ENSURE(ka.stride == sizeof(Entry) / 4);
+
+    auto const expected = naive_join(ka, kb);
+    ENSURE(!expected.empty());
+    auto dispatched = [](auto const& x, auto const& y, auto&& e) { intersect_sorted(x, y, e); };
+    ENSURE(run(dispatched, ka, kb) == expected);
+}
+
+TEST_SUITE_END();